@@ -2148,6 +2148,59 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_cache_type_stats
+ *
+ * Purpose:     Wrapper function for H5C_get_cache_type_stats().  Copies
+ *              the per entry type statistics of the cache into the
+ *              supplied array of H5AC_cache_type_stats_t, and returns
+ *              the number of entry types in *ntypes_ptr.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_get_cache_type_stats(const H5AC_t *cache_ptr, size_t nstats,
+    H5AC_cache_type_stats_t *stats, size_t *ntypes_ptr)
+{
+    H5C_type_stats_t int_stats[H5AC_NTYPES];    /* Internal form of the stats */
+    size_t ntypes = 0;                          /* Number of entry types in cache */
+    size_t u;                                   /* Local index variable */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(nstats > H5AC_NTYPES)
+        nstats = H5AC_NTYPES;
+
+    if(H5C_get_cache_type_stats((const H5C_t *)cache_ptr, nstats, int_stats, &ntypes) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_type_stats() failed")
+
+    /* Only the stats for the cache's entry types were filled in */
+    if(nstats > ntypes)
+        nstats = ntypes;
+    if(ntypes_ptr != NULL)
+        *ntypes_ptr = ntypes;
+
+    for(u = 0; u < nstats; u++) {
+        stats[u].name             = int_stats[u].name;
+        stats[u].hits             = int_stats[u].hits;
+        stats[u].misses           = int_stats[u].misses;
+        stats[u].evictions        = int_stats[u].evictions;
+        stats[u].flushes          = int_stats[u].flushes;
+        stats[u].bytes_read       = int_stats[u].bytes_read;
+        stats[u].bytes_written    = int_stats[u].bytes_written;
+        stats[u].deserialize_time = int_stats[u].deserialize_time;
+        stats[u].cur_entries      = int_stats[u].cur_entries;
+        stats[u].cur_size         = int_stats[u].cur_size;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_get_cache_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -164,7 +164,7 @@ extern "C" {
  *
  * incr_mode: Instance of the H5C_cache_incr_mode enumerated type whose
  *      value indicates how we determine whether the cache size should be
- *      increased.  At present there are two possible values:
+ *      increased.  At present there are three possible values:
  *
  *      H5C_incr__off:  Don't attempt to increase the size of the cache
  *              automatically.
@@ -181,15 +181,28 @@ extern "C" {
  *              at its maximum size, or if the cache is not already using
  *              all available space.
  *
+ *      H5C_incr__working_set: Like H5C_incr__threshold, but size the
+ *              increase from an estimate of the working set instead of
+ *              applying a fixed multiplier.  The cache remembers the
+ *              addresses and sizes of a bounded sample of recently evicted
+ *              entries ("ghost" entries).  When the hit rate drops below
+ *              lower_hr_threshold, the cache is grown by the total size of
+ *              the ghost entries that were requested again during the
+ *              epoch -- i.e. by the amount of extra space that would have
+ *              turned those misses into hits.  The increase is still
+ *              limited by increment, max_size and max_increment.  If no
+ *              ghost entries were hit (e.g. a cold cache or a streaming
+ *              access pattern) the cache is not grown.
+ *
  *      Note that you must set decr_mode to H5C_incr__off if you
  *      disable metadata cache entry evictions.
  *
  * lower_hr_threshold: Lower hit rate threshold.  If the increment mode
- *      (incr_mode) is H5C_incr__threshold and the hit rate drops below the
- *      value supplied in this field in an epoch, increment the cache size by
- *      size_increment.  Note that cache size may not be incremented above
- *      max_size, and that the increment may be further restricted by the
- *      max_increment field if it is enabled.
+ *      (incr_mode) is H5C_incr__threshold or H5C_incr__working_set and the
+ *      hit rate drops below the value supplied in this field in an epoch,
+ *      increment the cache size by size_increment.  Note that cache size may
+ *      not be incremented above max_size, and that the increment may be
+ *      further restricted by the max_increment field if it is enabled.
  *
  *      When enabled, this field must contain a value in the range [0.0, 1.0].
  *      Depending on the incr_mode selected, it may also have to be less than
@@ -567,6 +580,69 @@ typedef struct H5AC_cache_image_config_t {
     int                                 entry_ageout;
 } H5AC_cache_image_config_t;
 
+
+/****************************************************************************
+ *
+ * structure H5AC_cache_type_stats_t
+ *
+ * H5AC_cache_type_stats_t is a public structure used to report the
+ * activity of the metadata cache for a single class of metadata cache
+ * entry (object headers, B-tree nodes, heaps, etc.).  An array of these
+ * structures, one per entry class, is returned by H5Fget_mdc_type_stats().
+ *
+ * Unlike the hit rate reported by H5Fget_mdc_hit_rate(), the counters in
+ * this structure are not reset by the automatic cache resize code, and
+ * accumulate from the time the file is opened.
+ *
+ * The fields of the structure are discussed individually below:
+ *
+ * name: Pointer to a string containing the name of the entry class.  The
+ *      string is owned by the library and must not be freed or modified.
+ *
+ * hits: Number of times an entry of this class was protected while it
+ *      was already resident in the cache.
+ *
+ * misses: Number of times an entry of this class was protected while it
+ *      was not resident in the cache, and thus had to be loaded from file.
+ *
+ * evictions: Number of entries of this class that have been evicted from
+ *      the cache.
+ *
+ * flushes: Number of times an entry of this class has been written to
+ *      file.
+ *
+ * bytes_read: Number of bytes read from file to load entries of this
+ *      class.
+ *
+ * bytes_written: Number of bytes written to file when flushing entries of
+ *      this class.
+ *
+ * deserialize_time: Total wall clock time, in seconds, spent decoding
+ *      on-disk images of entries of this class into their in-memory form.
+ *      This field is zero on platforms without gettimeofday(), and in
+ *      builds without metadata cache statistics collection.
+ *
+ * cur_entries: Number of entries of this class currently resident in the
+ *      cache.
+ *
+ * cur_size: Total size in bytes of the entries of this class currently
+ *      resident in the cache.
+ *
+ ****************************************************************************/
+
+typedef struct H5AC_cache_type_stats_t {
+    const char *                        name;
+    int64_t                             hits;
+    int64_t                             misses;
+    int64_t                             evictions;
+    int64_t                             flushes;
+    int64_t                             bytes_read;
+    int64_t                             bytes_written;
+    double                              deserialize_time;
+    size_t                              cur_entries;
+    size_t                              cur_size;
+} H5AC_cache_type_stats_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -167,6 +167,10 @@ static herr_t H5C__serialize_single_entry(H5F_t *f, H5C_t *cache_ptr,
 static herr_t H5C__verify_len_eoa(H5F_t *f, const H5C_class_t * type,
     haddr_t addr, size_t *len, hbool_t actual);
 
+static herr_t H5C__flush_write_batch(H5F_t *f, H5C_t *cache_ptr);
+static herr_t H5C__write_entry_image(H5F_t *f, H5C_t *cache_ptr,
+    H5FD_mem_t mem_type, haddr_t addr, size_t size, const void *image);
+
 #if H5C_DO_SLIST_SANITY_CHECKS
 static hbool_t H5C_entry_in_skip_list(H5C_t * cache_ptr, 
                                       H5C_cache_entry_t *target_ptr);
@@ -322,8 +326,9 @@ H5C_create(size_t		      max_cache_size,
 	cache_ptr->slist_ring_size[i]		= (size_t)0;
     } /* end for */
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++)
-        (cache_ptr->index)[i] = NULL;
+    if(NULL == (cache_ptr->index = (H5C_cache_entry_t **)H5MM_calloc(H5C__HASH_TABLE_LEN * sizeof(H5C_cache_entry_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate cache index")
+    cache_ptr->index_table_len			= H5C__HASH_TABLE_LEN;
 
     cache_ptr->il_len				= 0;
     cache_ptr->il_size				= (size_t)0;
@@ -342,6 +347,15 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->slist_size_increase		= 0;
 #endif /* H5C_DO_SANITY_CHECKS */
 
+    cache_ptr->write_batch_enabled		= FALSE;
+    cache_ptr->write_batch_buf			= NULL;
+    cache_ptr->write_batch_buf_size		= (size_t)0;
+    cache_ptr->write_batch_addr			= HADDR_UNDEF;
+    cache_ptr->write_batch_len			= (size_t)0;
+    cache_ptr->write_batch_type			= H5FD_MEM_DEFAULT;
+    cache_ptr->write_batch_writes		= 0;
+    cache_ptr->write_batch_entries		= 0;
+
     cache_ptr->entries_removed_counter		= 0;
     cache_ptr->last_entry_removed_ptr		= NULL;
     cache_ptr->entry_watched_for_removal        = NULL;
@@ -421,6 +435,14 @@ H5C_create(size_t		      max_cache_size,
 
     cache_ptr->epoch_markers_active		= 0;
 
+    /* Initialize the per entry type statistics */
+    HDmemset(cache_ptr->type_stats, 0, sizeof(cache_ptr->type_stats));
+    for(i = 0; i <= max_type_id; i++)
+        cache_ptr->type_stats[i].name = class_table_ptr[i]->name;
+
+    cache_ptr->ghost_table			= NULL;
+    cache_ptr->ghost_epoch			= 0;
+
     /* no need to initialize the ring buffer itself */
     cache_ptr->epoch_marker_ringbuf_first	= 1;
     cache_ptr->epoch_marker_ringbuf_last	= 0;
@@ -464,6 +486,9 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->num_entries_in_image	= 0;
     cache_ptr->image_entries		= NULL;
     cache_ptr->image_buffer		= NULL;
+    cache_ptr->num_deferred_image_entries	= 0;
+    cache_ptr->deferred_image_entries_used	= 0;
+    cache_ptr->deferred_image_entries	= NULL;
 
     /* initialize free space manager related fields: */
     cache_ptr->rdfsm_settled		= FALSE;
@@ -493,6 +518,8 @@ done:
             if(cache_ptr->tag_list != NULL)
                 H5SL_close(cache_ptr->tag_list);
 
+            cache_ptr->index = (H5C_cache_entry_t **)H5MM_xfree(cache_ptr->index);
+
             cache_ptr->magic = 0;
             cache_ptr = H5FL_FREE(H5C_t, cache_ptr);
         } /* end if */
@@ -865,6 +892,19 @@ H5C_dest(H5F_t * f)
         cache_ptr->tag_list = NULL;
     } /* end if */
 
+    HDassert(cache_ptr->write_batch_len == 0);
+    cache_ptr->write_batch_buf = (uint8_t *)H5MM_xfree(cache_ptr->write_batch_buf);
+
+    /* Discard the cache image retained for deferred entries, if any */
+    if(cache_ptr->deferred_image_entries) {
+        cache_ptr->deferred_image_entries = (H5C_deferred_image_entry_t *)H5MM_xfree(cache_ptr->deferred_image_entries);
+        cache_ptr->num_deferred_image_entries = 0;
+        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+    } /* end if */
+
+    cache_ptr->index = (H5C_cache_entry_t **)H5MM_xfree(cache_ptr->index);
+    cache_ptr->ghost_table = (H5C_ghost_entry_t *)H5MM_xfree(cache_ptr->ghost_table);
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
     if(cache_ptr->get_entry_ptr_from_addr_counter > 0)
@@ -881,6 +921,241 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_dest() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__grow_index
+ *
+ * Purpose:     Double the number of buckets in the cache's index hash
+ *		table, and rehash all entries currently in the index.
+ *
+ *		The entries are located via the index list, so the cost
+ *		is linear in the number of entries in the cache.  Since the
+ *		table is only grown when index_len exceeds
+ *		H5C__HASH_TABLE_MAX_LOAD times the number of buckets, the
+ *		amortized cost per insertion is constant.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__grow_index(H5C_t *cache_ptr)
+{
+    H5C_cache_entry_t **new_index;      /* New hash table */
+    H5C_cache_entry_t *entry_ptr;       /* Entry being rehashed */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->index);
+    HDassert(cache_ptr->index_table_len < H5C__HASH_TABLE_MAX_LEN);
+    HDassert(cache_ptr->index_len == cache_ptr->il_len);
+
+    /* Allocate the larger table */
+    if(NULL == (new_index = (H5C_cache_entry_t **)H5MM_calloc(2 * cache_ptr->index_table_len * sizeof(H5C_cache_entry_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate cache index")
+
+    /* Switch to the new table */
+    H5MM_xfree(cache_ptr->index);
+    cache_ptr->index = new_index;
+    cache_ptr->index_table_len *= 2;
+
+    /* Rehash every entry in the index list into the new table */
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr) {
+        int k = H5C__HASH_FCN(cache_ptr, entry_ptr->addr);
+
+        entry_ptr->ht_prev = NULL;
+        entry_ptr->ht_next = new_index[k];
+        if(new_index[k])
+            new_index[k]->ht_prev = entry_ptr;
+        new_index[k] = entry_ptr;
+
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__grow_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__flush_write_batch
+ *
+ * Purpose:     Write the entry images currently staged in the cache's
+ *		write batch buffer to the file with a single call to
+ *		H5F_block_write(), and mark the buffer empty.
+ *
+ *		Callbacks of entries flushed after an image was staged
+ *		may free file space, but H5F__free() writes the batch
+ *		through H5C_flush_write_batch() before the EOA can shrink,
+ *		so the staged images always lie within the EOA.
+ *
+ *		The function does nothing if the buffer is empty.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__flush_write_batch(H5F_t *f, H5C_t *cache_ptr)
+{
+    haddr_t addr;                       /* Base address of the staged images */
+    size_t len;                         /* Number of bytes staged */
+    haddr_t eoa;                        /* End-of-allocation in the file */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if(cache_ptr->write_batch_len > 0) {
+        HDassert(cache_ptr->write_batch_buf);
+        HDassert(H5F_addr_defined(cache_ptr->write_batch_addr));
+
+        /* Mark the buffer empty before writing, so that the images are
+         * not written twice if the write fails.
+         */
+        addr = cache_ptr->write_batch_addr;
+        len = cache_ptr->write_batch_len;
+        cache_ptr->write_batch_addr = HADDR_UNDEF;
+        cache_ptr->write_batch_len = 0;
+
+        /* Global heap writes are treated as raw data writes by
+         * H5F_block_write(), so use the raw data EOA for them.
+         */
+        if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, (cache_ptr->write_batch_type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : cache_ptr->write_batch_type)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "unable to get file EOA")
+
+        if(H5F_addr_gt(addr + len, eoa))
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "batched entry images extend beyond EOA")
+
+        if(H5F_block_write(f, cache_ptr->write_batch_type, addr, len, cache_ptr->write_batch_buf) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write batched entry images to file")
+        cache_ptr->write_batch_writes++;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__flush_write_batch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_flush_write_batch
+ *
+ * Purpose:     Write the entry images staged in the write batch buffer of
+ *		the cache of F, if any.  Called before file space is
+ *		returned to the file driver, which may reduce the EOA.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_flush_write_batch(H5F_t *f)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(f->shared->cache && f->shared->cache->write_batch_len > 0)
+        if(H5C__flush_write_batch(f, f->shared->cache) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write batched entry images")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_flush_write_batch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__write_entry_image
+ *
+ * Purpose:     Write an entry image to the file.  If write batching is
+ *		enabled, the image is appended to the cache's write batch
+ *		buffer when it directly follows the images already staged
+ *		there; otherwise the staged images are written first, and
+ *		a new batch is started with this image.  Images larger
+ *		than H5C__MAX_WRITE_BATCH_SIZE are always written directly.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__write_entry_image(H5F_t *f, H5C_t *cache_ptr, H5FD_mem_t mem_type,
+    haddr_t addr, size_t size, const void *image)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(size > 0);
+    HDassert(image);
+
+    if(!cache_ptr->write_batch_enabled) {
+        HDassert(cache_ptr->write_batch_len == 0);
+
+        if(H5F_block_write(f, mem_type, addr, size, image) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write image to file")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Write out the current batch if the image can't be appended to it */
+    if(cache_ptr->write_batch_len > 0 &&
+            (mem_type != cache_ptr->write_batch_type
+             || H5F_addr_ne(addr, cache_ptr->write_batch_addr + cache_ptr->write_batch_len)
+             || (cache_ptr->write_batch_len + size) > H5C__MAX_WRITE_BATCH_SIZE))
+        if(H5C__flush_write_batch(f, cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write batched entry images")
+
+    if(size > H5C__MAX_WRITE_BATCH_SIZE) {
+        HDassert(cache_ptr->write_batch_len == 0);
+
+        if(H5F_block_write(f, mem_type, addr, size, image) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write image to file")
+    } /* end if */
+    else {
+        /* Make room for the image */
+        if(cache_ptr->write_batch_len + size > cache_ptr->write_batch_buf_size) {
+            size_t new_size = MAX(2 * cache_ptr->write_batch_buf_size, cache_ptr->write_batch_len + size);
+            uint8_t *new_buf;
+
+            new_size = MIN(new_size, H5C__MAX_WRITE_BATCH_SIZE);
+            if(NULL == (new_buf = (uint8_t *)H5MM_realloc(cache_ptr->write_batch_buf, new_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't grow write batch buffer")
+            cache_ptr->write_batch_buf = new_buf;
+            cache_ptr->write_batch_buf_size = new_size;
+        } /* end if */
+
+        /* Stage the image */
+        if(cache_ptr->write_batch_len == 0) {
+            cache_ptr->write_batch_addr = addr;
+            cache_ptr->write_batch_type = mem_type;
+        } /* end if */
+        HDmemcpy(cache_ptr->write_batch_buf + cache_ptr->write_batch_len, image, size);
+        cache_ptr->write_batch_len += size;
+        cache_ptr->write_batch_entries++;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__write_entry_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_evict
@@ -2253,6 +2528,13 @@ H5C_protect(H5F_t *		f,
     /* first check to see if the target is in cache */
     H5C__SEARCH_INDEX(cache_ptr, addr, entry_ptr, NULL)
 
+    /* If not, check whether its reconstruction from the cache image
+     * was deferred, and reconstruct it now if so.
+     */
+    if(entry_ptr == NULL && cache_ptr->num_deferred_image_entries > cache_ptr->deferred_image_entries_used)
+        if(H5C__load_deferred_image_entry(f, cache_ptr, addr, &entry_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't load deferred cache image entry")
+
     if(entry_ptr != NULL) {
         if(entry_ptr->ring != ring)
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, NULL, "ring type mismatch occured for cache entry")
@@ -2354,6 +2636,9 @@ H5C_protect(H5F_t *		f,
 
         hit = FALSE;
 
+        /* Check whether the miss would have been a hit in a larger cache */
+        H5C__UPDATE_GHOST_STATS_FOR_MISS(cache_ptr, addr)
+
         if(NULL == (thing = H5C_load_entry(f, 
 #ifdef H5_HAVE_PARALLEL
                                            coll_access, 
@@ -2522,6 +2807,8 @@ H5C_protect(H5F_t *		f,
 
     H5C__UPDATE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit)
 
+    H5C__UPDATE_TYPE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit)
+
     ret_value = thing;
 
     if ( ( cache_ptr->evictions_enabled ) &&
@@ -2652,6 +2939,9 @@ H5C_reset_cache_hit_rate_stats(H5C_t * cache_ptr)
 
     cache_ptr->cache_hits		= 0;
     cache_ptr->cache_accesses		= 0;
+    cache_ptr->ghost_epoch++;
+    cache_ptr->ghost_hits		= 0;
+    cache_ptr->ghost_hit_bytes		= 0;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2683,6 +2973,7 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr,
 {
     size_t      new_max_cache_size;
     size_t      new_min_clean_size;
+    unsigned    u;
     herr_t	ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -2721,6 +3012,7 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr,
             break;
 
         case H5C_incr__threshold:
+        case H5C_incr__working_set:
             if((config_ptr->lower_hr_threshold <= (double)0.0f) ||
                      (config_ptr->increment <= (double)1.0f) ||
                      ((config_ptr->apply_max_increment) && (config_ptr->max_increment <= 0)))
@@ -2832,6 +3124,21 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr,
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "error removing all epoch markers")
     }
 
+    /* set up or discard the ghost table used for working set estimation */
+    if(config_ptr->incr_mode == H5C_incr__working_set) {
+        if(NULL == cache_ptr->ghost_table) {
+            if(NULL == (cache_ptr->ghost_table = (H5C_ghost_entry_t *)H5MM_malloc(H5C__GHOST_TABLE_LEN * sizeof(H5C_ghost_entry_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate ghost table")
+            for(u = 0; u < H5C__GHOST_TABLE_LEN; u++) {
+                cache_ptr->ghost_table[u].addr = HADDR_UNDEF;
+                cache_ptr->ghost_table[u].size = 0;
+                cache_ptr->ghost_table[u].epoch = -1;
+            } /* end for */
+        } /* end if */
+    } /* end if */
+    else
+        cache_ptr->ghost_table = (H5C_ghost_entry_t *)H5MM_xfree(cache_ptr->ghost_table);
+
     /* configure flash size increase facility.  We wait until the
      * end of the function, as we need the max_cache_size set before
      * we start to keep things simple.
@@ -3447,10 +3754,12 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t * config_ptr,
 
     if((tests & H5C_RESIZE_CFG__VALIDATE_INCREMENT) != 0) {
         if((config_ptr->incr_mode != H5C_incr__off) &&
-                (config_ptr->incr_mode != H5C_incr__threshold))
+                (config_ptr->incr_mode != H5C_incr__threshold) &&
+                (config_ptr->incr_mode != H5C_incr__working_set))
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid incr_mode")
 
-        if(config_ptr->incr_mode == H5C_incr__threshold) {
+        if((config_ptr->incr_mode == H5C_incr__threshold) ||
+                (config_ptr->incr_mode == H5C_incr__working_set)) {
             if((config_ptr->lower_hr_threshold < (double)0.0f) ||
                     (config_ptr->lower_hr_threshold > (double)1.0f))
                 HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "lower_hr_threshold must be in the range [0.0, 1.0]")
@@ -3461,7 +3770,7 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t * config_ptr,
             /* no need to check max_increment, as it is a size_t,
              * and thus must be non-negative.
              */
-        } /* H5C_incr__threshold */
+        } /* H5C_incr__threshold || H5C_incr__working_set */
 
         switch(config_ptr->flash_incr_mode) {
             case H5C_flash_incr__off:
@@ -3535,7 +3844,8 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t * config_ptr,
 
 
     if ( (tests & H5C_RESIZE_CFG__VALIDATE_INTERACTIONS) != 0 ) {
-        if((config_ptr->incr_mode == H5C_incr__threshold)
+        if(((config_ptr->incr_mode == H5C_incr__threshold) ||
+                    (config_ptr->incr_mode == H5C_incr__working_set))
                 && ((config_ptr->decr_mode == H5C_decr__threshold) ||
                        (config_ptr->decr_mode == H5C_decr__age_out_with_threshold))
                 && (config_ptr->lower_hr_threshold >= config_ptr->upper_hr_threshold))
@@ -4063,6 +4373,70 @@ H5C__auto_adjust_cache_size(H5F_t *f, hbool_t write_permitted)
             }
             break;
 
+        case H5C_incr__working_set:
+            if ( hit_rate < (cache_ptr->resize_ctl).lower_hr_threshold ) {
+
+                if ( ! cache_ptr->size_increase_possible ) {
+
+                    status = increase_disabled;
+
+                } else if ( cache_ptr->max_cache_size >=
+                            (cache_ptr->resize_ctl).max_size ) {
+
+                    HDassert( cache_ptr->max_cache_size == \
+                              (cache_ptr->resize_ctl).max_size );
+                    status = at_max_size;
+
+                } else if ( ( ! cache_ptr->cache_full ) ||
+                            ( cache_ptr->ghost_hits == 0 ) ) {
+
+                    /* Either there is still free space, or none of the
+                     * misses in the epoch would have been hits in a
+                     * larger cache -- in either case, growing the cache
+                     * will not help.
+                     */
+                    status = not_full;
+
+                } else {
+
+                    /* grow by the size of the re-referenced evicted
+                     * entries, but no faster than the threshold mode
+                     */
+                    new_max_cache_size = cache_ptr->max_cache_size +
+                                         cache_ptr->ghost_hit_bytes;
+
+                    if ( new_max_cache_size >
+                         (size_t)(((double)(cache_ptr->max_cache_size)) *
+                                  (cache_ptr->resize_ctl).increment) ) {
+
+                        new_max_cache_size = (size_t)
+                                     (((double)(cache_ptr->max_cache_size)) *
+                                      (cache_ptr->resize_ctl).increment);
+                    }
+
+                    /* clip to max size if necessary */
+                    if ( new_max_cache_size >
+                         (cache_ptr->resize_ctl).max_size ) {
+
+                        new_max_cache_size = (cache_ptr->resize_ctl).max_size;
+                    }
+
+                    /* clip to max increment if necessary */
+                    if ( ( (cache_ptr->resize_ctl).apply_max_increment ) &&
+                         ( (cache_ptr->max_cache_size +
+                            (cache_ptr->resize_ctl).max_increment) <
+                           new_max_cache_size ) ) {
+
+                        new_max_cache_size = cache_ptr->max_cache_size +
+                                         (cache_ptr->resize_ctl).max_increment;
+                    }
+
+                    if ( new_max_cache_size > cache_ptr->max_cache_size )
+                        status = increase;
+                }
+            }
+            break;
+
         default:
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "unknown incr_mode")
     }
@@ -4587,6 +4961,8 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
 
                 bytes_evicted += entry_ptr->size;
 
+                H5C__RECORD_GHOST_ENTRY(cache_ptr, entry_ptr)
+
                 if(H5C__flush_single_entry(f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0 )
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
             } /* end else-if */
@@ -4658,9 +5034,12 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
 
             prev_ptr = entry_ptr->prev;
 
-            if(!(entry_ptr->is_dirty) && !(entry_ptr->prefetched_dirty))
+            if(!(entry_ptr->is_dirty) && !(entry_ptr->prefetched_dirty)) {
+                H5C__RECORD_GHOST_ENTRY(cache_ptr, entry_ptr)
+
                 if(H5C__flush_single_entry(f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush clean entry")
+            } /* end if */
 
             /* just skip the entry if it is dirty, as we can't do
              * anything with it now since we can't write.
@@ -5734,6 +6113,21 @@ H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
      */
     cache_ptr->slist_changed = FALSE;
 
+    /* Entries are flushed in increasing address order, so stage the
+     * images of adjacent entries and write each such run with a single
+     * call.  This is not done when the page buffer is in use (as it
+     * expects whole pages or single entries), when the file is open for
+     * SWMR writes (as the readers depend on the order in which entries
+     * reach the file), or when the entries are written collectively.
+     */
+    HDassert(cache_ptr->write_batch_len == 0);
+    if(NULL == f->shared->page_buf && !(H5F_INTENT(f) & H5F_ACC_SWMR_WRITE)
+#ifdef H5_HAVE_PARALLEL
+            && NULL == cache_ptr->aux_ptr
+#endif /* H5_HAVE_PARALLEL */
+            )
+        cache_ptr->write_batch_enabled = TRUE;
+
     while((cache_ptr->slist_ring_len[ring] > 0) &&
 	    (protected_entries == 0)  &&
 	    (flushed_entries_last_pass)) {
@@ -5909,6 +6303,15 @@ H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
 #endif /* H5C_DO_SANITY_CHECKS */
 
 done:
+    /* Write any images still staged, even on failure, so that the
+     * entries marked clean actually reach the file.
+     */
+    if(cache_ptr->write_batch_enabled) {
+        cache_ptr->write_batch_enabled = FALSE;
+        if(H5C__flush_write_batch(f, cache_ptr) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write batched entry images")
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__flush_ring() */
 
@@ -6129,7 +6532,7 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
                 else
                     mem_type = entry_ptr->type->mem_type;
 
-                if(H5F_block_write(f, mem_type, entry_ptr->addr, entry_ptr->size, entry_ptr->image_ptr) < 0)
+                if(H5C__write_entry_image(f, cache_ptr, mem_type, entry_ptr->addr, entry_ptr->size, entry_ptr->image_ptr) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write image to file")
 #ifdef H5_HAVE_PARALLEL
             }
@@ -6163,6 +6566,9 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
 
         /* only log a flush if we actually wrote to disk */
         H5C__UPDATE_STATS_FOR_FLUSH(cache_ptr, entry_ptr)
+
+        cache_ptr->type_stats[entry_ptr->type->id].flushes++;
+        cache_ptr->type_stats[entry_ptr->type->id].bytes_written += (int64_t)entry_ptr->size;
     } /* end else if */
 
     /* Note that the algorithm below is (very) similar to the set of operations
@@ -6182,6 +6588,8 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
         /* Update stats, while entry is still in the cache */
         H5C__UPDATE_STATS_FOR_EVICTION(cache_ptr, entry_ptr, take_ownership)
 
+        cache_ptr->type_stats[entry_ptr->type->id].evictions++;
+
         /* If the entry's type has a 'notify' callback and the entry is about
          * to be removed from the cache, send a 'before eviction' notice while
          * the entry is still fully integrated in the cache.
@@ -6525,7 +6933,11 @@ H5C_load_entry(H5F_t *              f,
                 haddr_t             addr,
                 void *              udata)
 {
+    H5C_t *     cache_ptr = f->shared->cache;   /* Cache for the file        */
     hbool_t     dirty = FALSE;          /* Flag indicating whether thing was dirtied during deserialize */
+#if H5C_COLLECT_CACHE_STATS
+    double      start_time;             /* Start time of deserialize callback       */
+#endif /* H5C_COLLECT_CACHE_STATS */
     uint8_t *   image = NULL;           /* Buffer for disk image                    */
     void *      thing = NULL;           /* Pointer to thing loaded                  */
     H5C_cache_entry_t *entry = NULL;    /* Alias for thing loaded, as cache entry   */
@@ -6584,6 +6996,12 @@ H5C_load_entry(H5F_t *              f,
     } /* end if */
 #endif /* H5_HAVE_PARALLEL */
 
+    /* Entries loaded by callbacks during a flush may lie within the
+     * range of images staged for a batched write, so write those first.
+     */
+    if(H5C__flush_write_batch(f, cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, NULL, "can't write batched entry images")
+
     /* Get the on-disk entry image */
     if(0 == (type->flags & H5C__CLASS_SKIP_READS)) {
         unsigned tries, max_tries;      /* The # of read attempts               */
@@ -6719,11 +7137,19 @@ H5C_load_entry(H5F_t *              f,
 
         /* Set the final length (in case it wasn't set earlier) */
         len = actual_len;
+
+        cache_ptr->type_stats[type->id].bytes_read += (int64_t)len;
     } /* end if !H5C__CLASS_SKIP_READS */
 
     /* Deserialize the on-disk image into the native memory form */
+#if H5C_COLLECT_CACHE_STATS
+    start_time = H5_get_time();
+#endif /* H5C_COLLECT_CACHE_STATS */
     if(NULL == (thing = type->deserialize(image, len, udata, &dirty)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "Can't deserialize image")
+#if H5C_COLLECT_CACHE_STATS
+    cache_ptr->type_stats[type->id].deserialize_time += H5_get_time() - start_time;
+#endif /* H5C_COLLECT_CACHE_STATS */
 
     entry = (H5C_cache_entry_t *)thing;
 
@@ -6749,7 +7175,7 @@ H5C_load_entry(H5F_t *              f,
     HDassert( ( dirty == FALSE ) || ( type->id == 5 || type->id == 6) );
 
     entry->magic                        = H5C__H5C_CACHE_ENTRY_T_MAGIC;
-    entry->cache_ptr                    = f->shared->cache;
+    entry->cache_ptr                    = cache_ptr;
     entry->addr                         = addr;
     entry->size                         = len;
     HDassert(entry->size < H5C_MAX_ENTRY_SIZE);
@@ -6998,6 +7424,8 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
                     cache_ptr->entries_scanned_to_make_space++;
 #endif /* H5C_COLLECT_CACHE_STATS */
 
+                    H5C__RECORD_GHOST_ENTRY(cache_ptr, entry_ptr)
+
                     if(H5C__flush_single_entry(f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
                 } else {
@@ -7152,6 +7580,8 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
                  && ( ! (entry_ptr->coll_access) )
 #endif /* H5_HAVE_PARALLEL */
                ) {
+                H5C__RECORD_GHOST_ENTRY(cache_ptr, entry_ptr)
+
                 if(H5C__flush_single_entry(f, entry_ptr,
                         H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
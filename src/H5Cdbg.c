@@ -110,7 +110,7 @@ H5C_dump_cache(H5C_t * cache_ptr, const char *  cache_name)
      * Do this, as we want to display cache entries in increasing address
      * order.
      */
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_table_len; i++) {
         entry_ptr = cache_ptr->index[i];
 
         while(entry_ptr != NULL) {
@@ -98,6 +98,8 @@ static size_t H5C__cache_image_block_entry_header_size(const H5F_t *f);
 static size_t H5C__cache_image_block_header_size(const H5F_t *f);
 static herr_t H5C__decode_cache_image_header(const H5F_t *f,
     H5C_t *cache_ptr, const uint8_t **buf);
+static htri_t H5C__decode_deferrable_image_entry(const H5F_t *f,
+    const uint8_t *buf, haddr_t *addr_ptr, size_t *len_ptr);
 #ifndef NDEBUG	/* only used in assertions */
 static herr_t H5C__decode_cache_image_entry(const H5F_t *f,
     const H5C_t *cache_ptr, const uint8_t **buf, unsigned entry_num);
@@ -108,6 +110,8 @@ static herr_t H5C__encode_cache_image_header(const H5F_t *f,
     const H5C_t *cache_ptr, uint8_t **buf);
 static herr_t H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, 
     uint8_t **buf, unsigned entry_num);
+static int H5C__deferred_image_entry_cmp(const void *_entry1,
+    const void *_entry2);
 static herr_t H5C__prep_for_file_close__compute_fd_heights(const H5C_t *cache_ptr);
 static void H5C__prep_for_file_close__compute_fd_heights_real(
     H5C_cache_entry_t  *entry_ptr, uint32_t fd_height);
@@ -472,6 +476,9 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr,
                                          * dirtied during deserialize 
                                          */
     size_t              len;            /* Size of image in file */
+#if H5C_COLLECT_CACHE_STATS
+    double              start_time;     /* Start time of deserialize callback */
+#endif /* H5C_COLLECT_CACHE_STATS */
     void *		thing = NULL;   /* Pointer to thing loaded */
     H5C_cache_entry_t * pf_entry_ptr;   /* pointer to the prefetched entry   */
                                         /* supplied in *entry_ptr_ptr.       */
@@ -572,8 +579,14 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr,
     /* Deserialize the prefetched on-disk image of the entry into the 
      * native memory form 
      */
+#if H5C_COLLECT_CACHE_STATS
+    start_time = H5_get_time();
+#endif /* H5C_COLLECT_CACHE_STATS */
     if(NULL == (thing = type->deserialize(pf_entry_ptr->image_ptr, len, udata, &dirty)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "Can't deserialize image")
+#if H5C_COLLECT_CACHE_STATS
+    cache_ptr->type_stats[type->id].deserialize_time += H5_get_time() - start_time;
+#endif /* H5C_COLLECT_CACHE_STATS */
     ds_entry_ptr = (H5C_cache_entry_t *)thing;
 
     /* In general, an entry should be clean just after it is loaded.
@@ -1154,8 +1167,9 @@ H5C__load_cache_image(H5F_t *f)
 	if(H5C__reconstruct_cache_contents(f, cache_ptr) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't reconstruct cache contents from image block")
 
-	/* Free the image buffer */
-        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+	/* Free the image buffer, unless it holds deferred entries */
+        if(0 == cache_ptr->num_deferred_image_entries)
+            cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
 
         /* Update stats -- must do this now, as we are about
          * to discard the size of the cache image.
@@ -1233,6 +1247,110 @@ H5C_load_cache_image_on_next_protect(H5F_t *f, haddr_t addr, hsize_t len,
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5C_load_cache_image_on_next_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_deferred_image_entry()
+ *
+ * Purpose:     Check whether the reconstruction of the entry at the
+ *		specified address was deferred when the cache image was 
+ *		loaded.  If so, reconstruct the prefetched entry from the
+ *		retained image buffer, insert it in the cache, and return
+ *		a pointer to it in *entry_ptr_ptr.  Otherwise, set 
+ *		*entry_ptr_ptr to NULL.
+ *
+ *		An entry is only reconstructed once -- if it is later
+ *		evicted, it is read from the file like any other entry.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__load_deferred_image_entry(H5F_t *f, H5C_t *cache_ptr, haddr_t addr,
+    H5C_cache_entry_t **entry_ptr_ptr)
+{
+    H5C_deferred_image_entry_t *de_ptr = NULL;  /* Deferred entry found */
+    H5C_cache_entry_t *pf_entry_ptr;    /* Reconstructed entry */
+    const uint8_t *p;                   /* Pointer into image buffer */
+    size_t lo, hi;                      /* Bounds of binary search */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(entry_ptr_ptr);
+
+    *entry_ptr_ptr = NULL;
+
+    if(0 == cache_ptr->num_deferred_image_entries)
+        HGOTO_DONE(SUCCEED)
+    HDassert(cache_ptr->deferred_image_entries);
+    HDassert(cache_ptr->image_buffer);
+
+    /* Look up the address */
+    lo = 0;
+    hi = cache_ptr->num_deferred_image_entries;
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if(H5F_addr_lt(cache_ptr->deferred_image_entries[mid].addr, addr))
+            lo = mid + 1;
+        else if(H5F_addr_gt(cache_ptr->deferred_image_entries[mid].addr, addr))
+            hi = mid;
+        else {
+            de_ptr = &(cache_ptr->deferred_image_entries[mid]);
+            break;
+        } /* end else */
+    } /* end while */
+
+    /* Nothing to do if the entry wasn't deferred, or was already loaded */
+    if(NULL == de_ptr || 0 == de_ptr->offset)
+        HGOTO_DONE(SUCCEED)
+
+    /* Reconstruct the prefetched entry */
+    p = (const uint8_t *)cache_ptr->image_buffer + de_ptr->offset;
+    if(NULL == (pf_entry_ptr = H5C__reconstruct_cache_entry(f, cache_ptr, &p)))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "reconstruction of deferred cache entry failed")
+    HDassert(H5F_addr_eq(pf_entry_ptr->addr, addr));
+    HDassert(!pf_entry_ptr->is_dirty);
+    HDassert(0 == pf_entry_ptr->fd_parent_count);
+    HDassert(0 == pf_entry_ptr->fd_child_count);
+
+    /* Mark the deferred entry as used */
+    de_ptr->offset = 0;
+    cache_ptr->deferred_image_entries_used++;
+
+    /* Make space for the entry if the cache is full */
+    if((cache_ptr->index_size + pf_entry_ptr->size) > cache_ptr->max_cache_size) {
+        hbool_t write_permitted = FALSE;
+
+	if(cache_ptr->check_write_permitted != NULL) {
+	    if((cache_ptr->check_write_permitted)(f, &write_permitted) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, FAIL, "Can't get write_permitted")
+        } /* end if */
+        else
+            write_permitted = cache_ptr->write_permitted;
+
+	if(H5C__make_space_in_cache(f, pf_entry_ptr->size, write_permitted) < 0)
+	    HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, FAIL, "H5C__make_space_in_cache failed")
+    } /* end if */
+
+    /* Insert the prefetched entry in the index and the LRU */
+    H5C__INSERT_IN_INDEX(cache_ptr, pf_entry_ptr, FAIL)
+    H5C__UPDATE_RP_FOR_INSERTION(cache_ptr, pf_entry_ptr, FAIL)
+
+    H5C__UPDATE_STATS_FOR_PREFETCH(cache_ptr, FALSE)
+
+    *entry_ptr_ptr = pf_entry_ptr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_deferred_image_entry() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__image_entry_cmp
@@ -1287,6 +1405,34 @@ H5C__image_entry_cmp(const void *_entry1, const void *_entry2)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__image_entry_cmp() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__deferred_image_entry_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) on deferred image entries.
+ *		Entries are sorted by address.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *		first entry is considered to be respectively less than,
+ *		equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__deferred_image_entry_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5C_deferred_image_entry_t *entry1 = (const H5C_deferred_image_entry_t *)_entry1;
+    const H5C_deferred_image_entry_t *entry2 = (const H5C_deferred_image_entry_t *)_entry2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(entry1);
+    HDassert(entry2);
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(entry1->addr, entry2->addr))
+} /* H5C__deferred_image_entry_cmp() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__prep_image_for_file_close
@@ -3081,6 +3227,12 @@ done:
  *		reconstruct any flush dependencies.  Order the entries 
  *		in the LRU as indicated by the stored lru_ranks.
  *
+ *		If the file is opened R/O, clean entries that are not
+ *		involved in flush dependencies are not reconstructed.
+ *		Instead, their locations in the image buffer are recorded
+ *		so that H5C__load_deferred_image_entry() can reconstruct
+ *		them when they are first protected.
+ *
  * Return:      SUCCEED on success, and FAIL on failure.
  *
  * Programmer:  John Mainzer
@@ -3094,6 +3246,7 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     H5C_cache_entry_t *	pf_entry_ptr;   /* Pointer to prefetched entry */
     H5C_cache_entry_t *	parent_ptr;     /* Pointer to parent of prefetched entry */
     const uint8_t *	p;              /* Pointer into image buffer */
+    hbool_t		defer_entries;  /* Whether to defer reconstruction of entries */
     unsigned		u, v;           /* Local index variable */
     herr_t 		ret_value = SUCCEED;      /* Return value */
 
@@ -3119,8 +3272,42 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     HDassert(cache_ptr->image_data_len <= cache_ptr->image_len);
     HDassert(cache_ptr->num_entries_in_image > 0);
 
+    /* If the file is opened R/O, the image is retained in the file, and
+     * clean entries without flush dependencies can be reconstructed when
+     * they are first protected, rather than now.  Don't do this for
+     * parallel access, where all processes must see the same cache
+     * contents.
+     */
+    HDassert(cache_ptr->deferred_image_entries == NULL);
+    defer_entries = !cache_ptr->delete_image;
+#ifdef H5_HAVE_PARALLEL
+    if(cache_ptr->aux_ptr)
+        defer_entries = FALSE;
+#endif /* H5_HAVE_PARALLEL */
+    if(defer_entries)
+        if(NULL == (cache_ptr->deferred_image_entries = (H5C_deferred_image_entry_t *)H5MM_malloc((size_t)cache_ptr->num_entries_in_image * sizeof(H5C_deferred_image_entry_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for deferred image entries array")
+    cache_ptr->num_deferred_image_entries = 0;
+    cache_ptr->deferred_image_entries_used = 0;
+
     /* Reconstruct entries in image */
     for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
+        /* Check whether the reconstruction of the entry can be deferred */
+        if(defer_entries) {
+            H5C_deferred_image_entry_t *de_ptr = &(cache_ptr->deferred_image_entries[cache_ptr->num_deferred_image_entries]);
+            size_t entry_len;           /* Length of the entry in the image */
+            htri_t can_defer;           /* Whether the entry can be deferred */
+
+            if((can_defer = H5C__decode_deferrable_image_entry(f, p, &de_ptr->addr, &entry_len)) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "can't decode cache image entry")
+            if(can_defer) {
+                de_ptr->offset = (size_t)(p - (const uint8_t *)cache_ptr->image_buffer);
+                cache_ptr->num_deferred_image_entries++;
+                p += entry_len;
+                continue;
+            } /* end if */
+        } /* end if */
+
 	/* Create the prefetched entry described by the ith
          * entry in cache_ptr->image_entrise.
          */
@@ -3182,6 +3369,15 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
         } /* end for */
     } /* end for */
 
+    /* Sort the deferred entries by address for lookup, or discard the
+     * array if no entries were deferred.
+     */
+    if(cache_ptr->num_deferred_image_entries > 0)
+        HDqsort(cache_ptr->deferred_image_entries, (size_t)cache_ptr->num_deferred_image_entries,
+                sizeof(H5C_deferred_image_entry_t), H5C__deferred_image_entry_cmp);
+    else
+        cache_ptr->deferred_image_entries = (H5C_deferred_image_entry_t *)H5MM_xfree(cache_ptr->deferred_image_entries);
+
 #ifndef NDEBUG
     /* Scan the cache entries, and verify that each entry has
      * the expected flush dependency status.
@@ -3251,7 +3447,8 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
          * the following sanity check will have to be revised when
          * we add code to store and restore adaptive resize status.
          */
-	HDassert(lru_rank_holes <= H5C__MAX_EPOCH_MARKERS);
+	HDassert((cache_ptr->num_deferred_image_entries > 0) ||
+                 (lru_rank_holes <= H5C__MAX_EPOCH_MARKERS));
     } /* end block */
 #endif /* NDEBUG */
 
@@ -3453,6 +3650,71 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__reconstruct_cache_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__decode_deferrable_image_entry()
+ *
+ * Purpose:     Examine the header of the cache image entry at the 
+ *		supplied location in the image buffer, and determine
+ *		whether its reconstruction may be deferred.  This is the
+ *		case if the entry is clean, and is neither a parent nor
+ *		a child in a flush dependency.
+ *
+ *		If so, return the address of the entry in *addr_ptr, and
+ *		the length of the entry in the image buffer (header 
+ *		included) in *len_ptr.
+ *
+ * Return:      TRUE if the entry can be deferred, FALSE if not, and
+ *		negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5C__decode_deferrable_image_entry(const H5F_t *f, const uint8_t *buf,
+    haddr_t *addr_ptr, size_t *len_ptr)
+{
+    const uint8_t *	p = buf;
+    uint8_t             flags;
+    hsize_t		size = 0;
+    htri_t		ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(buf);
+    HDassert(addr_ptr);
+    HDassert(len_ptr);
+
+    /* Skip type id, and decode flags */
+    p++;
+    flags = *p++;
+    if(flags & (H5C__MDCI_ENTRY_DIRTY_FLAG | H5C__MDCI_ENTRY_IS_FD_PARENT_FLAG | H5C__MDCI_ENTRY_IS_FD_CHILD_FLAG))
+        HGOTO_DONE(FALSE)
+
+    /* Skip ring, age, flush dependency counts, and LRU rank */
+    p += 1 + 1 + 3 * 2 + 4;
+
+    /* Decode entry offset & length */
+    H5F_addr_decode(f, &p, addr_ptr);
+    if(!H5F_addr_defined(*addr_ptr))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry offset")
+    H5F_DECODE_LENGTH(f, p, size);
+    if(size == 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry size")
+
+    /* Verify expected length of entry header */
+    if((size_t)(p - buf) != H5C__cache_image_block_entry_header_size(f))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "Bad entry image len")
+
+    /* No flush dependency parent addresses follow the header */
+    *len_ptr = (size_t)(p - buf) + (size_t)size;
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__decode_deferrable_image_entry() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__write_cache_image_superblock_msg
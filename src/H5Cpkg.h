@@ -47,7 +47,12 @@
 #define H5C__MAX_EPOCH_MARKERS                  10
 
 /* Cache configuration settings */
-#define H5C__HASH_TABLE_LEN     (64 * 1024) /* must be a power of 2 */
+#define H5C__HASH_TABLE_LEN     (64 * 1024) /* initial size, must be a power of 2 */
+#define H5C__HASH_TABLE_MAX_LOAD 1      /* max. average entries per bucket before growing */
+#define H5C__HASH_TABLE_MAX_LEN (256 * 1024 * 1024) /* must be a power of 2 */
+#define H5C__MAX_WRITE_BATCH_SIZE (1024 * 1024) /* max. bytes staged per batched write */
+#define H5C__GHOST_TABLE_BITS   12      /* log2 of the ghost table length */
+#define H5C__GHOST_TABLE_LEN    (1 << H5C__GHOST_TABLE_BITS)
 #define H5C__H5C_T_MAGIC	0x005CAC0E
 
 /* Initial allocated size of the "flush_dep_parent" array */
@@ -589,9 +594,11 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  * The following macros must handle stats collection when this collection
  * is enabled, and evaluate to the empty string when it is not.
  *
- * The sole exception to this rule is
- * H5C__UPDATE_CACHE_HIT_RATE_STATS(), which is always active as
- * the cache hit rate stats are always collected and available.
+ * The exceptions to this rule are H5C__UPDATE_CACHE_HIT_RATE_STATS(),
+ * H5C__UPDATE_TYPE_STATS_FOR_PROTECT(), H5C__RECORD_GHOST_ENTRY() and
+ * H5C__UPDATE_GHOST_STATS_FOR_MISS(), which are always active as the
+ * cache hit rate, per type, and working set statistics are always
+ * collected and available.
  *
  ***********************************************************************/
 
@@ -601,6 +608,53 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
             (cache_ptr->cache_hits)++;                   \
         }                                                \
 
+#define H5C__UPDATE_TYPE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit)      \
+        if ( hit )                                                         \
+            ((cache_ptr)->type_stats[(entry_ptr)->type->id].hits)++;       \
+        else                                                               \
+            ((cache_ptr)->type_stats[(entry_ptr)->type->id].misses)++;
+
+/* The ghost table is a direct mapped table of the addresses and sizes of
+ * entries recently evicted to make space in the cache.  It only exists
+ * when the working set increment mode is enabled.
+ *
+ * Entry addresses are frequently multiples of large powers of two, so
+ * the address is scrambled with a multiplicative hash before selecting
+ * the slot.
+ *
+ * A ghost entry is counted at most once per epoch, so that an entry that
+ * is repeatedly evicted and reloaded during the epoch contributes its
+ * size only once to the estimate of the shortfall of the cache.
+ */
+#define H5C__GHOST_HASH_FCN(addr)                                          \
+        ((int)(((uint32_t)((addr) ^ ((addr) >> 32)) * (uint32_t)2654435761U) \
+               >> (32 - H5C__GHOST_TABLE_BITS)))
+
+#define H5C__RECORD_GHOST_ENTRY(cache_ptr, entry_ptr)                      \
+if ( (cache_ptr)->ghost_table ) {                                          \
+    H5C_ghost_entry_t * ghost_ptr;                                         \
+                                                                           \
+    ghost_ptr = &((cache_ptr)->ghost_table[H5C__GHOST_HASH_FCN((entry_ptr)->addr)]); \
+    if ( ghost_ptr->addr != (entry_ptr)->addr ) {                          \
+        ghost_ptr->addr = (entry_ptr)->addr;                               \
+        ghost_ptr->epoch = -1;                                             \
+    }                                                                      \
+    ghost_ptr->size = (entry_ptr)->size;                                   \
+}
+
+#define H5C__UPDATE_GHOST_STATS_FOR_MISS(cache_ptr, Addr)                  \
+if ( (cache_ptr)->ghost_table ) {                                          \
+    H5C_ghost_entry_t * ghost_ptr;                                         \
+                                                                           \
+    ghost_ptr = &((cache_ptr)->ghost_table[H5C__GHOST_HASH_FCN(Addr)]);    \
+    if ( ( ghost_ptr->addr == (Addr) ) &&                                  \
+         ( ghost_ptr->epoch != (cache_ptr)->ghost_epoch ) ) {              \
+        ((cache_ptr)->ghost_hits)++;                                       \
+        (cache_ptr)->ghost_hit_bytes += ghost_ptr->size;                   \
+        ghost_ptr->epoch = (cache_ptr)->ghost_epoch;                       \
+    }                                                                      \
+}
+
 #if H5C_COLLECT_CACHE_STATS
 
 #define H5C__UPDATE_MAX_INDEX_SIZE_STATS(cache_ptr)                        \
@@ -978,11 +1032,15 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  *
  ***********************************************************************/
 
-/* H5C__HASH_TABLE_LEN is defined in H5Cpkg.h.  It mut be a power of two. */
+/* The hash table starts out with H5C__HASH_TABLE_LEN buckets (defined
+ * above), and is doubled by H5C__grow_index() whenever the number of entries
+ * in the index exceeds H5C__HASH_TABLE_MAX_LOAD times the number of buckets.
+ * The table length is always a power of two.
+ */
 
-#define H5C__HASH_MASK		((size_t)(H5C__HASH_TABLE_LEN - 1) << 3)
+#define H5C__HASH_MASK(cache_ptr)	((size_t)((cache_ptr)->index_table_len - 1) << 3)
 
-#define H5C__HASH_FCN(x)	(int)((unsigned)((x) & H5C__HASH_MASK) >> 3)
+#define H5C__HASH_FCN(cache_ptr, x)	(int)((unsigned)((x) & H5C__HASH_MASK(cache_ptr)) >> 3)
 
 #if H5C_DO_SANITY_CHECKS
 
@@ -994,8 +1052,8 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (entry_ptr)->ht_next != NULL ) ||                                \
      ( (entry_ptr)->ht_prev != NULL ) ||                                \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) < 0 ) ||             \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >= (int)(cache_ptr)->index_table_len ) || \
      ( (cache_ptr)->index_size !=                                       \
        ((cache_ptr)->clean_index_size +                                 \
 	(cache_ptr)->dirty_index_size) ) ||                             \
@@ -1046,14 +1104,14 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (cache_ptr)->index_size < (entry_ptr)->size ) ||                 \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                       \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
-     ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]         \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) < 0 ) ||             \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >= (int)(cache_ptr)->index_table_len ) || \
+     ( ((cache_ptr)->index)[(H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr))] \
        == NULL ) ||                                                     \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]       \
+     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr))] \
        != (entry_ptr) ) &&                                              \
        ( (entry_ptr)->ht_prev == NULL ) ) ||                            \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))] ==    \
+     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr))] == \
          (entry_ptr) ) &&                                               \
        ( (entry_ptr)->ht_prev != NULL ) ) ||                            \
      ( (cache_ptr)->index_size !=                                       \
@@ -1112,8 +1170,8 @@ if ( ( (cache_ptr) == NULL ) ||                                             \
      ( (cache_ptr)->index_size !=                                           \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( ! H5F_addr_defined(Addr) ) ||                                        \
-     ( H5C__HASH_FCN(Addr) < 0 ) ||                                         \
-     ( H5C__HASH_FCN(Addr) >= H5C__HASH_TABLE_LEN ) ) {                     \
+     ( H5C__HASH_FCN(cache_ptr, Addr) < 0 ) ||                              \
+     ( H5C__HASH_FCN(cache_ptr, Addr) >= (int)(cache_ptr)->index_table_len ) ) { \
     HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "pre HT search SC failed") \
 }
 
@@ -1323,7 +1381,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                            \
     int k;                                                                   \
     H5C__PRE_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                    \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
     if(((cache_ptr)->index)[k] != NULL) {                                    \
         (entry_ptr)->ht_next = ((cache_ptr)->index)[k];                      \
         (entry_ptr)->ht_next->ht_prev = (entry_ptr);                         \
@@ -1352,13 +1410,18 @@ if ( ( (cache_ptr)->index_size !=                                           \
                        (cache_ptr)->il_size, fail_val)                       \
     H5C__UPDATE_STATS_FOR_HT_INSERTION(cache_ptr)                            \
     H5C__POST_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                   \
+    if(((size_t)(cache_ptr)->index_len >                                     \
+            (cache_ptr)->index_table_len * H5C__HASH_TABLE_MAX_LOAD) &&      \
+            ((cache_ptr)->index_table_len < H5C__HASH_TABLE_MAX_LEN))        \
+        if(H5C__grow_index(cache_ptr) < 0)                                   \
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, fail_val, "can't grow cache index") \
 }
 
 #define H5C__DELETE_FROM_INDEX(cache_ptr, entry_ptr, fail_val)               \
 {                                                                            \
     int k;                                                                   \
     H5C__PRE_HT_REMOVE_SC(cache_ptr, entry_ptr)                              \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
     if((entry_ptr)->ht_next)                                                 \
         (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;                \
     if((entry_ptr)->ht_prev)                                                 \
@@ -1397,7 +1460,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     int k;                                                                  \
     int depth = 0;                                                          \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
     entry_ptr = ((cache_ptr)->index)[k];                                    \
     while(entry_ptr) {                                                      \
         if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
@@ -1425,7 +1488,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                           \
     int k;                                                                  \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
     entry_ptr = ((cache_ptr)->index)[k];                                    \
     while(entry_ptr) {                                                      \
         if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
@@ -3451,6 +3514,24 @@ typedef struct H5C_tag_info_t {
     hbool_t corked;             /* Whether this object is corked */
 } H5C_tag_info_t;
 
+/* Location of an entry in a cache image whose reconstruction is deferred
+ * until the entry is first protected (see H5C__reconstruct_cache_contents()).
+ */
+typedef struct H5C_deferred_image_entry_t {
+    haddr_t addr;               /* Address of the entry in the file */
+    size_t offset;              /* Offset of the entry in the image buffer, or 0 once it has been reconstructed */
+} H5C_deferred_image_entry_t;
+
+/* Address and size of an entry recently evicted to make space in the cache
+ * (a "ghost" entry), used to estimate the working set of the cache when
+ * the H5C_incr__working_set increment mode is enabled.
+ */
+typedef struct H5C_ghost_entry_t {
+    haddr_t addr;               /* Address of the evicted entry, or HADDR_UNDEF */
+    size_t size;                /* Size of the evicted entry */
+    int64_t epoch;              /* Epoch in which the entry was last counted, or -1 */
+} H5C_ghost_entry_t;
+
 
 /****************************************************************************
  *
@@ -3677,8 +3758,8 @@ typedef struct H5C_tag_info_t {
  *		index by ring.  Note that the sum of all cells in this array 
  *		must equal the value stored in dirty_index_size above.
  *
- * index:	Array of pointer to H5C_cache_entry_t of size
- *		H5C__HASH_TABLE_LEN.  At present, this value is a power
+ * index:	Dynamically allocated array of pointer to H5C_cache_entry_t
+ *		of size index_table_len.  At present, this value is a power
  *		of two, not the usual prime number.
  *
  *		I hope that the variable size of cache elements, the large
@@ -3692,6 +3773,14 @@ typedef struct H5C_tag_info_t {
  *		changing the H5C__HASH_FCN macro and the deletion of the
  *		H5C__HASH_MASK #define.  No other changes should be required.
  *
+ * index_table_len: Number of buckets in the index hash table.  This is
+ *		initialized to H5C__HASH_TABLE_LEN, and is doubled (and all
+ *		entries rehashed) by H5C__grow_index() whenever index_len
+ *		exceeds H5C__HASH_TABLE_MAX_LOAD buckets' worth of entries,
+ *		so that hash chains stay short in caches holding millions
+ *		of small entries.  The table never shrinks while the cache
+ *		exists.
+ *
  * il_len:	Number of entries on the index list.  
  *
  *		This must always be equal to index_len.  As such, this 
@@ -3837,6 +3926,48 @@ typedef struct H5C_tag_info_t {
  * 		to the slist since the last time this field was set to
  * 		zero.  Note that this value can be negative.
  *
+ *
+ * Since the slist is scanned in increasing address order, runs of dirty
+ * entries that are adjacent in the file are written one after the other
+ * during a flush.  Rather than issuing one write per entry, H5C__flush_ring()
+ * stages the images of such runs in a write batch buffer, and writes each
+ * run to the file with a single call to H5F_block_write().  The staged
+ * images are written before file space is returned to the file driver,
+ * which may move the EOA below them.  The following fields support this.
+ *
+ * write_batch_enabled: Boolean flag indicating whether images written by
+ *		H5C__flush_single_entry() should be staged in the write
+ *		batch buffer instead of being written directly.  This flag
+ *		is only set for the duration of a call to H5C__flush_ring(),
+ *		and only when neither the page buffer, SWMR write access,
+ *		nor the parallel collective write path is in use.
+ *
+ * write_batch_buf: Pointer to the buffer in which entry images are staged.
+ *		The buffer is allocated on first use, and is discarded when
+ *		the cache is destroyed.
+ *
+ * write_batch_buf_size: Size of the buffer pointed to by write_batch_buf.
+ *		This never exceeds H5C__MAX_WRITE_BATCH_SIZE.
+ *
+ * write_batch_addr: Base address in the file of the images currently
+ *		staged in the write batch buffer, or HADDR_UNDEF if the
+ *		buffer is empty.
+ *
+ * write_batch_len: Number of bytes currently staged in the write batch
+ *		buffer.
+ *
+ * write_batch_type: Memory type of the images staged in the write batch
+ *		buffer.  Only images of the same memory type are ever
+ *		staged together.
+ *
+ * write_batch_writes: Number of writes issued from the write batch buffer
+ *		since the cache was created.
+ *
+ * write_batch_entries: Number of entry images that have been written via
+ *		the write batch buffer since the cache was created.  The
+ *		ratio of this field to write_batch_writes gives the average
+ *		number of entries written per call.
+ *
  * Cache entries belonging to a particular object are "tagged" with that
  * object's base object header address.
  *
@@ -4202,6 +4333,44 @@ typedef struct H5C_tag_info_t {
  *	this field will be reset every automatic resize epoch.
  *
  *
+ * Per entry type statistics:
+ *
+ * The following array is always maintained, and is used to report cache
+ * activity by entry type via H5C_get_cache_type_stats().  Unlike the
+ * cache hit rate statistics above, it is never reset.
+ *
+ * type_stats:	Array of H5C_type_stats_t of length
+ *	H5C__MAX_NUM_TYPE_IDS + 1, indexed by entry type id.  The
+ *	cur_entries and cur_size fields of the elements are not maintained,
+ *	as they are computed on demand when the statistics are queried.
+ *
+ *
+ * Working set estimation:
+ *
+ * When the H5C_incr__working_set increment mode is enabled, the cache
+ * remembers the addresses and sizes of entries evicted to make space in
+ * the cache in a small direct mapped table.  A miss on an address found
+ * in the table is a miss that would have been a hit had the cache been
+ * larger, and the sizes of such entries accumulated over an epoch give
+ * the amount by which the cache must grow to hold the working set.
+ * Since the table is of fixed size and colliding entries overwrite one
+ * another, it samples recent evictions rather than recording them all.
+ *
+ * ghost_table:	Pointer to a dynamically allocated array of
+ *	H5C__GHOST_TABLE_LEN instances of H5C_ghost_entry_t, or NULL if
+ *	the working set increment mode is not enabled.
+ *
+ * ghost_epoch: Number of times the cache hit rate statistics have been
+ *	reset.  Used to ensure that each ghost entry is counted at most
+ *	once between resets.
+ *
+ * ghost_hits:	Number of misses on entries found in the ghost table since
+ *	the last time the cache hit rate statistics were reset.
+ *
+ * ghost_hit_bytes: Total size of the entries found in the ghost table
+ *	since the last time the cache hit rate statistics were reset.
+ *
+ *
  * Metadata cache image management related fields.
  *
  * image_ctl:	Instance of H5C_cache_image_ctl_t containing configuration
@@ -4304,6 +4473,26 @@ typedef struct H5C_tag_info_t {
  *		image_len in which the metadata cache image is assembled, 
  *		or NULL if that	buffer does not exist.
  *
+ * When a file is opened R/O, the cache image is neither deleted nor
+ * rewritten, and the image may describe far more metadata than a given
+ * process will touch.  Hence, for R/O opens, clean entries in the image
+ * that have no flush dependencies are not reconstructed as prefetched
+ * entries when the image is loaded.  Instead their locations in the
+ * image buffer (which is retained until the cache is destroyed) are
+ * recorded, and each is reconstructed the first time it is protected.
+ * Since such entries are clean, they could equally well be read from
+ * the file, so the deferred entries are purely an optimization.
+ *
+ * num_deferred_image_entries: Number of entries in the array pointed to
+ *		by deferred_image_entries.
+ *
+ * deferred_image_entries_used: Number of deferred entries that have been
+ *		reconstructed (i.e. protected) since the image was loaded.
+ *
+ * deferred_image_entries: Pointer to a dynamically allocated array of
+ *		H5C_deferred_image_entry_t, sorted by address, or NULL if
+ *		no entries in the cache image were deferred.
+ *
  *
  * Free Space Manager Related fields:
  *
@@ -4700,7 +4889,8 @@ struct H5C_t {
     size_t			clean_index_ring_size[H5C_RING_NTYPES];
     size_t			dirty_index_size;
     size_t			dirty_index_ring_size[H5C_RING_NTYPES];
-    H5C_cache_entry_t *	        index[H5C__HASH_TABLE_LEN];
+    H5C_cache_entry_t **        index;
+    size_t                      index_table_len;
     uint32_t                    il_len;
     size_t                      il_size;
     H5C_cache_entry_t *	        il_head;
@@ -4724,6 +4914,16 @@ struct H5C_t {
     ssize_t			slist_size_increase;
 #endif /* H5C_DO_SANITY_CHECKS */
 
+    /* Fields for batching writes of adjacent entries during flushes */
+    hbool_t                     write_batch_enabled;
+    uint8_t *                   write_batch_buf;
+    size_t                      write_batch_buf_size;
+    haddr_t                     write_batch_addr;
+    size_t                      write_batch_len;
+    H5FD_mem_t                  write_batch_type;
+    int64_t                     write_batch_writes;
+    int64_t                     write_batch_entries;
+
     /* Fields for maintaining list of tagged entries */
     H5SL_t *                    tag_list;
     hbool_t                     ignore_tags;
@@ -4796,6 +4996,15 @@ struct H5C_t {
     int64_t			cache_hits;
     int64_t			cache_accesses;
 
+    /* Fields for per entry type statistics */
+    H5C_type_stats_t		type_stats[H5C__MAX_NUM_TYPE_IDS + 1];
+
+    /* Fields for working set estimation */
+    H5C_ghost_entry_t *		ghost_table;
+    int64_t			ghost_epoch;
+    int64_t			ghost_hits;
+    size_t			ghost_hit_bytes;
+
     /* fields supporting generation of a cache image on file close */
     H5C_cache_image_ctl_t	image_ctl;
     hbool_t			serialization_in_progress;
@@ -4812,6 +5021,9 @@ struct H5C_t {
     uint32_t			num_entries_in_image;
     H5C_image_entry_t *		image_entries;
     void *                      image_buffer;
+    uint32_t			num_deferred_image_entries;
+    uint32_t			deferred_image_entries_used;
+    H5C_deferred_image_entry_t * deferred_image_entries;
 
     /* Free Space Manager Related fields */
     hbool_t 			rdfsm_settled;
@@ -4932,11 +5144,14 @@ H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr,
     unsigned flags);
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f);
+H5_DLL herr_t H5C__load_deferred_image_entry(H5F_t *f, H5C_t *cache_ptr,
+    haddr_t addr, H5C_cache_entry_t **entry_ptr_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_serialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t * f, size_t  space_needed,
     hbool_t write_permitted);
 H5_DLL herr_t H5C__flush_marked_entries(H5F_t * f);
+H5_DLL herr_t H5C__grow_index(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__generate_image(H5F_t *f, H5C_t *cache_ptr,
     H5C_cache_entry_t *entry_ptr);
 H5_DLL herr_t H5C__serialize_cache(H5F_t *f);
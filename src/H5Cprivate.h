@@ -78,10 +78,9 @@
 /* Upper and lower limits on cache size.  These limits are picked
  * out of a hat -- you should be able to change them as necessary.
  *
- * However, if you need a very big cache, you should also increase the
- * size of the hash table (H5C__HASH_TABLE_LEN in H5Cpkg.h).  The current
- * upper bound on cache size is rather large for the current hash table
- * size.
+ * The index hash table grows with the number of entries in the cache
+ * (see H5C__HASH_TABLE_LEN and H5C__HASH_TABLE_MAX_LOAD in H5Cpkg.h),
+ * so a very big cache does not require a larger initial table.
  */
 #define H5C__MAX_MAX_CACHE_SIZE		((size_t)(128 * 1024 * 1024))
 #define H5C__MIN_MAX_CACHE_SIZE		((size_t)(1024))
@@ -1239,6 +1238,11 @@ typedef int H5C_ring_t;
  * The il_next and il_prev fields discussed below were added to support
  * the index list.
  *
+ * Since searching the index walks the hash chains comparing addresses,
+ * ht_next and ht_prev are declared immediately after the addr field
+ * rather than with the other list pointers, keeping the fields touched
+ * by a chain walk together.
+ *
  * ht_next:	Next pointer used by the hash table to store multiple
  *		entries in a single hash bin.  This field points to the
  *		next entry in the doubly linked list of entries in the
@@ -1598,6 +1602,13 @@ typedef struct H5C_cache_entry_t {
     uint32_t			magic;
     H5C_t                      *cache_ptr;
     haddr_t			addr;
+
+    /* fields supporting the hash table (kept next to 'addr', so that a
+     * walk down a hash chain touches a single cache line per entry):
+     */
+    struct H5C_cache_entry_t   *ht_next;
+    struct H5C_cache_entry_t   *ht_prev;
+
     size_t			size;
     void  		       *image_ptr;
     hbool_t			image_up_to_date;
@@ -1632,9 +1643,7 @@ typedef struct H5C_cache_entry_t {
     hbool_t			pinned_from_client;
     hbool_t			pinned_from_cache;
 
-    /* fields supporting the hash table: */
-    struct H5C_cache_entry_t   *ht_next;
-    struct H5C_cache_entry_t   *ht_prev;
+    /* fields supporting the index list: */
     struct H5C_cache_entry_t   *il_next;
     struct H5C_cache_entry_t   *il_prev;
 
@@ -1901,7 +1910,7 @@ typedef struct H5C_image_entry_t {
  *
  * incr_mode: Instance of the H5C_cache_incr_mode enumerated type whose
  *	value indicates how we determine whether the cache size should be
- *	increased.  At present there are two possible values:
+ *	increased.  At present there are three possible values:
  *
  *	H5C_incr__off:	Don't attempt to increase the size of the cache
  *		automatically.
@@ -1918,12 +1927,25 @@ typedef struct H5C_image_entry_t {
  *		at its maximum size, or if the cache is not already using
  *		all available space.
  *
+ *	H5C_incr__working_set: Like H5C_incr__threshold, but size the
+ *		increase from an estimate of the working set instead of
+ *		applying a fixed multiplier.  The cache remembers the
+ *		addresses and sizes of a bounded sample of recently evicted
+ *		entries ("ghost" entries).  When the hit rate drops below
+ *		lower_hr_threshold, the cache is grown by the total size of
+ *		the ghost entries that were requested again during the
+ *		epoch -- i.e. by the amount of extra space that would have
+ *		turned those misses into hits.  The increase is still
+ *		limited by increment, max_size and max_increment.  If no
+ *		ghost entries were hit (e.g. a cold cache or a streaming
+ *		access pattern) the cache is not grown.
+ *
  * lower_hr_threshold: Lower hit rate threshold.  If the increment mode
- *	(incr_mode) is H5C_incr__threshold and the hit rate drops below the
- *	value supplied in this field in an epoch, increment the cache size by
- *	size_increment.  Note that cache size may not be incremented above
- *	max_size, and that the increment may be further restricted by the
- *	max_increment field if it is enabled.
+ *	(incr_mode) is H5C_incr__threshold or H5C_incr__working_set and the
+ *	hit rate drops below the value supplied in this field in an epoch,
+ *	increment the cache size by size_increment.  Note that cache size may
+ *	not be incremented above max_size, and that the increment may be
+ *	further restricted by the max_increment field if it is enabled.
  *
  *	When enabled, this field must contain a value in the range [0.0, 1.0].
  *	Depending on the incr_mode selected, it may also have to be less than
@@ -2219,6 +2241,67 @@ typedef struct H5C_cache_image_ctl_t {
     unsigned				flags;
 } H5C_cache_image_ctl_t;
 
+
+/****************************************************************************
+ *
+ * structure H5C_type_stats_t
+ *
+ * Instances of H5C_type_stats_t are used to collect and report per entry
+ * type (i.e. per H5C_class_t) statistics on the activity of the cache.
+ * Unlike the statistics maintained when H5C_COLLECT_CACHE_STATS is TRUE,
+ * these are always collected, as they are cheap to maintain and are
+ * exposed to the user via H5Fget_mdc_type_stats().
+ *
+ * The cache maintains one instance of this structure for each entry type
+ * id.  The cur_entries and cur_size fields are not maintained by the
+ * cache, but are computed when the statistics are queried.
+ *
+ * The fields of the structure are discussed individually below:
+ *
+ * name:	Pointer to the name of the entry type, as supplied in the
+ *		associated instance of H5C_class_t.
+ *
+ * hits:	Number of protects of entries of this type that were
+ *		satisfied from the cache.
+ *
+ * misses:	Number of protects of entries of this type that required
+ *		the entry to be loaded from file.
+ *
+ * evictions:	Number of entries of this type evicted from the cache.
+ *
+ * flushes:	Number of times an entry of this type has been written
+ *		to file.
+ *
+ * bytes_read:	Number of bytes read from file to load entries of this
+ *		type.
+ *
+ * bytes_written: Number of bytes written to file on flushes of entries
+ *		of this type.
+ *
+ * deserialize_time: Total time in seconds spent in the deserialize
+ *		callback of this type.  Only collected when
+ *		H5C_COLLECT_CACHE_STATS is set.
+ *
+ * cur_entries:	Number of entries of this type currently in the cache.
+ *
+ * cur_size:	Total size of the entries of this type currently in the
+ *		cache.
+ *
+ ****************************************************************************/
+
+typedef struct H5C_type_stats_t {
+    const char *			name;
+    int64_t				hits;
+    int64_t				misses;
+    int64_t				evictions;
+    int64_t				flushes;
+    int64_t				bytes_read;
+    int64_t				bytes_written;
+    double				deserialize_time;
+    size_t				cur_entries;
+    size_t				cur_size;
+} H5C_type_stats_t;
+
 /***************************************/
 /* Library-private Function Prototypes */
 /***************************************/
@@ -2260,6 +2343,8 @@ H5_DLL herr_t H5C_get_cache_size(H5C_t *cache_ptr, size_t *max_size_ptr,
     size_t *min_clean_size_ptr, size_t *cur_size_ptr,
     uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5C_get_cache_hit_rate(H5C_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5C_get_cache_type_stats(const H5C_t *cache_ptr, size_t nstats,
+    H5C_type_stats_t *stats, size_t *ntypes_ptr);
 H5_DLL herr_t H5C_get_entry_status(const H5F_t *f, haddr_t addr,
     size_t *size_ptr, hbool_t *in_cache_ptr, hbool_t *is_dirty_ptr,
     hbool_t *is_protected_ptr, hbool_t *is_pinned_ptr, hbool_t *is_corked_ptr,
@@ -2315,6 +2400,7 @@ H5_DLL herr_t H5C_cache_image_status(H5F_t * f, hbool_t *load_ci_ptr,
     hbool_t *write_ci_ptr);
 H5_DLL hbool_t H5C_cache_image_pending(const H5C_t *cache_ptr);
 H5_DLL herr_t H5C_get_mdc_image_info(H5C_t *cache_ptr, haddr_t *image_addr, hsize_t *image_len);
+H5_DLL herr_t H5C_flush_write_batch(H5F_t *f);
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr,
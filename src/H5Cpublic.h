@@ -36,7 +36,8 @@ extern "C" {
 enum H5C_cache_incr_mode
 {
     H5C_incr__off,
-    H5C_incr__threshold
+    H5C_incr__threshold,
+    H5C_incr__working_set
 };
 
 enum H5C_cache_flash_incr_mode
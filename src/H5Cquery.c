@@ -196,6 +196,66 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_cache_type_stats
+ *
+ * Purpose:	Copy the per entry type statistics of the cache into the
+ *		array of H5C_type_stats_t of length nstats pointed to by
+ *		stats, one element per entry type id, and return the number
+ *		of entry types in *ntypes_ptr.  If stats is NULL or nstats
+ *		is less than the number of entry types, only the first
+ *		nstats types are copied.
+ *
+ *		The cur_entries and cur_size fields are computed by
+ *		scanning the index list.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_cache_type_stats(const H5C_t *cache_ptr, size_t nstats,
+    H5C_type_stats_t *stats, size_t *ntypes_ptr)
+{
+    size_t ntypes;                      /* Number of entry types in cache */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.")
+    if(nstats > 0 && stats == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad stats on entry.")
+
+    ntypes = (size_t)cache_ptr->max_type_id + 1;
+    if(nstats > ntypes)
+        nstats = ntypes;
+
+    if(nstats > 0) {
+        const H5C_cache_entry_t *entry_ptr;
+        size_t u;
+
+        for(u = 0; u < nstats; u++) {
+            stats[u] = cache_ptr->type_stats[u];
+            stats[u].cur_entries = 0;
+            stats[u].cur_size = 0;
+        } /* end for */
+
+        for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+            if((size_t)entry_ptr->type->id < nstats) {
+                stats[entry_ptr->type->id].cur_entries++;
+                stats[entry_ptr->type->id].cur_size += entry_ptr->size;
+            } /* end if */
+    } /* end if */
+
+    if(ntypes_ptr != NULL)
+        *ntypes_ptr = ntypes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_cache_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -112,6 +112,9 @@
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS 0x02u   /* Filters have been disabled since
                                                  * the last flush */
 
+/* # of chunks that the first run of reserved file space holds */
+#define H5D_CHUNK_RESERVE_NCHUNKS 4
+
 
 /******************/
 /* Local Typedefs */
@@ -265,6 +268,8 @@ static int H5D__chunk_format_convert_cb(const H5D_chunk_rec_t *chunk_rec, void *
 static herr_t H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims,
     const hsize_t *curr_dims, const hsize_t *max_dims);
 static void *H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline);
+static void *H5D__chunk_mem_alloc_aligned(size_t size, const H5O_pline_t *pline,
+    size_t align);
 static void *H5D__chunk_mem_xfree(void *chk, const H5O_pline_t *pline);
 static void *H5D__chunk_mem_realloc(void *chk, size_t size,
     const H5O_pline_t *pline);
@@ -290,6 +295,8 @@ static herr_t H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent,
     hbool_t flush);
 static hbool_t H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims,
     const uint32_t *chunk_dims, const hsize_t *chunk_scaled, const hsize_t *dset_dims);
+static haddr_t H5D__chunk_reserve_alloc(H5F_t *f, H5D_chunk_reserve_t *reserve,
+    hsize_t size);
 static void *H5D__chunk_lock(const H5D_io_info_t *io_info,
     H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk);
 static herr_t H5D__chunk_unlock(const H5D_io_info_t *io_info,
@@ -439,7 +446,7 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset,
         /* Otherwise, create the chunk it if it doesn't exist, or reallocate the chunk
          * if its size has changed.
          */
-        if(H5D__chunk_file_alloc(&idx_info, &old_chunk, &udata.chunk_block, &need_insert, scaled) < 0)
+        if(H5D__chunk_file_alloc(&idx_info, &old_chunk, &udata.chunk_block, &need_insert, scaled, &dset->shared->cache.chunk.reserve) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
 
     /* Make sure the address of the chunk is returned. */
@@ -927,6 +934,21 @@ H5D__chunk_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    /* Get the file space reservation for new chunks.  Parallel files place
+     * chunks collectively and paged aggregation already keeps raw data
+     * apart in pages, so don't reserve space for those.  Chunks cut from
+     * a reserved run aren't aligned either, so don't reserve space when
+     * the file aligns its objects.
+     */
+    if(H5P_get(dapl, H5D_ACS_CHUNK_RESERVE_NAME, &rdcc->reserve.max_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk space reservation")
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) || H5F_use_paged_aggr(f)
+            || H5F_get_alignment(f) > 1)
+        rdcc->reserve.max_size = 0;
+    rdcc->reserve.next_size = 0;
+    rdcc->reserve.addr = HADDR_UNDEF;
+    rdcc->reserve.size = 0;
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if(!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -1324,6 +1346,30 @@ done:
  */
 static void *
 H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(size);
+
+    FUNC_LEAVE_NOAPI(H5D__chunk_mem_alloc_aligned(size, pline, (size_t)0))
+} /* H5D__chunk_mem_alloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_mem_alloc_aligned
+ *
+ * Purpose:	Allocate space for a chunk in memory, aligning non-filtered
+ *              chunks on an ALIGN byte boundary so the file driver can
+ *              transfer them without going through a copy buffer.
+ *              Filtered chunks are passed to the I/O pipeline, which
+ *              manages them with malloc()/free(), so they aren't aligned.
+ *
+ * Return:	Pointer to memory for chunk on success/NULL on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_mem_alloc_aligned(size_t size, const H5O_pline_t *pline, size_t align)
 {
     void *ret_value = NULL;		/* Return value */
 
@@ -1334,12 +1380,12 @@ H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline)
     if(pline && pline->nused)
         ret_value = H5MM_malloc(size);
     else
-        ret_value = H5FL_BLK_MALLOC(chunk, size);
+        ret_value = H5FL_BLK_MALLOC_ALIGNED(chunk, size, align);
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_mem_alloc() */
+} /* H5D__chunk_mem_alloc_aligned() */
+
 
-
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_mem_xfree
  *
@@ -1363,19 +1409,20 @@ H5D__chunk_mem_xfree(void *chk, const H5O_pline_t *pline)
         if(pline && pline->nused)
             H5MM_xfree(chk);
         else
-            chk = H5FL_BLK_FREE(chunk, chk);
+            chk = H5FL_BLK_FREE_ALIGNED(chunk, chk);
     } /* end if */
 
     FUNC_LEAVE_NOAPI(NULL)
 } /* H5D__chunk_mem_xfree() */
 
-
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_mem_realloc
  *
  * Purpose:     Reallocate space for a chunk in memory.  This routine allocates
  *              memory space for non-filtered chunks from a block free list
- *              and uses malloc()/free() for filtered chunks.
+ *              and uses malloc()/free() for filtered chunks.  Non-filtered
+ *              chunks keep the alignment they were allocated with.
  *
  * Return:      Pointer to memory for chunk on success/NULL on failure
  *
@@ -1397,7 +1444,7 @@ H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline)
     if(pline->nused > 0)
         ret_value = H5MM_realloc(chk, size);
     else
-        ret_value = H5FL_BLK_REALLOC(chunk, chk, size);
+        ret_value = H5FL_BLK_REALLOC_ALIGNED(chunk, chk, size, 0);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_mem_realloc() */
@@ -2383,7 +2430,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 udata.chunk_block.length = io_info->dset->shared->layout.u.chunk.size;
 
                 /* Allocate the chunk */
-		if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, chunk_info->scaled) < 0)
+		if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, chunk_info->scaled, &io_info->dset->shared->cache.chunk.reserve) < 0)
 		    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
 
                 /* Make sure the address of the chunk is returned. */
@@ -2560,6 +2607,11 @@ H5D__chunk_dest(H5D_t *dset)
     if(nerrors)
         HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
+    /* Return the unused part of the space reserved for new chunks */
+    if(rdcc->reserve.size > 0)
+        if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, rdcc->reserve.addr, rdcc->reserve.size) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free reserved chunk space")
+
     /* Release cache structures */
     if(rdcc->slot)
         rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
@@ -3077,7 +3129,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             /* Create the chunk it if it doesn't exist, or reallocate the chunk
              *  if its size changed.
              */
-            if(H5D__chunk_file_alloc(&idx_info, &(ent->chunk_block), &udata.chunk_block, &need_insert, ent->scaled) < 0)
+            if(H5D__chunk_file_alloc(&idx_info, &(ent->chunk_block), &udata.chunk_block, &need_insert, ent->scaled, &dset->shared->cache.chunk.reserve) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
 
             /* Update the chunk entry's info, in case it was allocated or relocated */
@@ -3538,7 +3590,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
              */
             rdcc->stats.nhits++;
 
-            if(NULL == (chunk = H5D__chunk_mem_alloc(chunk_size, pline)))
+            if(NULL == (chunk = H5D__chunk_mem_alloc_aligned(chunk_size, pline, H5F_MEM_ALIGN(dset->oloc.file))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
 
             /* In the case that some dataset functions look through this data,
@@ -3558,7 +3610,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
                 /* Chunk size on disk isn't [likely] the same size as the final chunk
                  * size in memory, so allocate memory big enough. */
-                if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, (udata->new_unfilt_chunk ? old_pline : pline))))
+                if(NULL == (chunk = H5D__chunk_mem_alloc_aligned(my_chunk_alloc, (udata->new_unfilt_chunk ? old_pline : pline), H5F_MEM_ALIGN(dset->oloc.file))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
                 if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, chunk) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
@@ -3581,7 +3633,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                     if(udata->new_unfilt_chunk) {
                         void *tmp_chunk = chunk;
 
-                        if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline))) {
+                        if(NULL == (chunk = H5D__chunk_mem_alloc_aligned(my_chunk_alloc, pline, H5F_MEM_ALIGN(dset->oloc.file)))) {
                             (void)H5D__chunk_mem_xfree(tmp_chunk, old_pline);
                             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
                         } /* end if */
@@ -3601,7 +3653,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
                 /* Chunk size on disk isn't [likely] the same size as the final chunk
                  * size in memory, so allocate memory big enough. */
-                if(NULL == (chunk = H5D__chunk_mem_alloc(chunk_size, pline)))
+                if(NULL == (chunk = H5D__chunk_mem_alloc_aligned(chunk_size, pline, H5F_MEM_ALIGN(dset->oloc.file))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
 
                 if(H5P_is_fill_value_defined(fill, &fill_status) < 0)
@@ -4253,7 +4305,7 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             udata.filter_mask = filter_mask;
 
             /* Allocate the chunk (with all processes) */
-	    if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled) < 0)
+	    if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled, &io_info->dset->shared->cache.chunk.reserve) < 0)
 		HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
             HDassert(H5F_addr_defined(udata.chunk_block.offset));
 
@@ -5731,7 +5783,7 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
 	udata_dst.common.layout->max_down_chunks, udata_dst.common.scaled);
 
     /* Allocate chunk in the file */
-    if(H5D__chunk_file_alloc(udata->idx_info_dst, NULL, &udata_dst.chunk_block, &need_insert, udata_dst.common.scaled) < 0)
+    if(H5D__chunk_file_alloc(udata->idx_info_dst, NULL, &udata_dst.chunk_block, &need_insert, udata_dst.common.scaled, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
 
     /* Write chunk data to destination file */
@@ -6426,6 +6478,73 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_is_partial_edge_chunk() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_reserve_alloc
+ *
+ * Purpose:     Allocates SIZE bytes for a new chunk from the file space
+ *              reserved for a dataset's new chunks, reserving a new run
+ *              when the current one is too small.
+ *
+ *              The first run holds a few chunks and each new run is
+ *              twice the size of the previous one, up to the limit set
+ *              with H5Pset_chunk_reserve().  The unused end of the
+ *              previous run is returned to the file.
+ *
+ * Return:      Success:    Address of the chunk
+ *              Failure:    HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5D__chunk_reserve_alloc(H5F_t *f, H5D_chunk_reserve_t *reserve, hsize_t size)
+{
+    haddr_t ret_value = HADDR_UNDEF;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(reserve);
+    HDassert(reserve->max_size > 0);
+    HDassert(size > 0);
+
+    if(reserve->size < size) {
+        hsize_t run_size;           /* Size of the new run */
+
+        /* Return the end of the current run */
+        if(reserve->size > 0) {
+            if(H5MF_xfree(f, H5FD_MEM_DRAW, reserve->addr, reserve->size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, HADDR_UNDEF, "unable to free reserved chunk space")
+            reserve->addr = HADDR_UNDEF;
+            reserve->size = 0;
+        } /* end if */
+
+        /* Compute the size of the new run */
+        if(0 == reserve->next_size)
+            reserve->next_size = MIN(reserve->max_size, H5D_CHUNK_RESERVE_NCHUNKS * size);
+        run_size = MAX(reserve->next_size, size);
+
+        if(HADDR_UNDEF == (reserve->addr = H5MF_alloc(f, H5FD_MEM_DRAW, run_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, HADDR_UNDEF, "unable to reserve file space for chunks")
+        reserve->size = run_size;
+
+        /* Double the next run, up to the limit */
+        if(reserve->next_size > reserve->max_size / 2)
+            reserve->next_size = reserve->max_size;
+        else
+            reserve->next_size *= 2;
+    } /* end if */
+
+    /* Take the chunk from the start of the run */
+    ret_value = reserve->addr;
+    reserve->addr += size;
+    reserve->size -= size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_reserve_alloc() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_file_alloc()
@@ -6435,6 +6554,10 @@ done:
  *                chunk if its size changed.
  *		  The coding is moved and modified from each index structure.
  *
+ *              Unless RESERVE is NULL or disabled, new chunks indexed by
+ *              chunk address are taken from the space reserved for the
+ *              dataset's new chunks.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Vailin Choi; June 2014
@@ -6443,7 +6566,8 @@ done:
  */
 herr_t
 H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
-    H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[])
+    H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[],
+    H5D_chunk_reserve_t *reserve)
 {
     hbool_t alloc_chunk = FALSE;	/* Whether to allocate chunk */
     herr_t ret_value = SUCCEED;   	/* Return value         */
@@ -6541,7 +6665,10 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
             case H5D_CHUNK_IDX_SINGLE:
                 HDassert(new_chunk->length > 0);
                 H5_CHECK_OVERFLOW(new_chunk->length, /*From: */uint32_t, /*To: */hsize_t);
-                new_chunk->offset = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, (hsize_t)new_chunk->length);
+                if(reserve && reserve->max_size > 0 && idx_info->storage->idx_type != H5D_CHUNK_IDX_SINGLE)
+                    new_chunk->offset = H5D__chunk_reserve_alloc(idx_info->f, reserve, (hsize_t)new_chunk->length);
+                else
+                    new_chunk->offset = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, (hsize_t)new_chunk->length);
                 if(!H5F_addr_defined(new_chunk->offset))
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
                 *need_insert = TRUE;
@@ -50,17 +50,37 @@
 /* Local Macros */
 /****************/
 
+/* Max. # of pieces gathered before issuing a vector read or write */
+#define H5D_CONTIG_VEC_BATCH    256
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Piece of a selection, for sieve buffer I/O */
+typedef struct H5D_contig_sieve_piece_t {
+    hsize_t dst_off;            /* Offset of piece in dataset */
+    hsize_t src_off;            /* Offset of piece in memory buffer */
+    size_t len;                 /* Length of piece */
+    size_t idx;                 /* Position of piece in the selection */
+} H5D_contig_sieve_piece_t;
+
+/* Pieces of a selection, sorted by offset in the dataset */
+typedef struct H5D_contig_sieve_list_t {
+    H5D_contig_sieve_piece_t *pieces;   /* Array of pieces */
+    size_t npieces;             /* # of pieces in array */
+    size_t curr;                /* Index of piece being operated on */
+    size_t gap_size;            /* Largest hole to read through when loading the sieve buffer */
+} H5D_contig_sieve_list_t;
+
 /* Callback info for sieve buffer readvv operation */
 typedef struct H5D_contig_readvv_sieve_ud_t {
     H5F_t *file;                /* File for dataset */
     H5D_rdcdc_t *dset_contig;   /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig;    /* Contiguous storage info for this I/O operation */
     unsigned char *rbuf;        /* Pointer to buffer to fill */
+    const H5D_contig_sieve_list_t *list;        /* Sorted pieces of the selection */
 } H5D_contig_readvv_sieve_ud_t;
 
 /* Callback info for [plain] readvv operation */
@@ -68,14 +88,29 @@ typedef struct H5D_contig_readvv_ud_t {
     H5F_t *file;                /* File for dataset */
     haddr_t dset_addr;          /* Address of dataset */
     unsigned char *rbuf;        /* Pointer to buffer to fill */
+
+    /* Pieces gathered for a vector read */
+    hbool_t use_vector;         /* Whether to gather pieces into vector reads */
+    uint32_t nvec;              /* # of pieces gathered */
+    H5FD_mem_t types[H5D_CONTIG_VEC_BATCH];     /* Memory types of pieces */
+    haddr_t addrs[H5D_CONTIG_VEC_BATCH];        /* File addresses of pieces */
+    size_t sizes[H5D_CONTIG_VEC_BATCH];         /* Sizes of pieces */
+    void *bufs[H5D_CONTIG_VEC_BATCH];           /* Buffers for pieces */
 } H5D_contig_readvv_ud_t;
 
+/* Callback info for readvv/writevv operations deferred to an I/O vector */
+typedef struct H5D_contig_vec_ud_t {
+    const H5D_io_info_t *io_info;   /* I/O info, with vector to add pieces to */
+    haddr_t dset_addr;          /* Address of dataset */
+} H5D_contig_vec_ud_t;
+
 /* Callback info for sieve buffer writevv operation */
 typedef struct H5D_contig_writevv_sieve_ud_t {
     H5F_t *file;                /* File for dataset */
     H5D_rdcdc_t *dset_contig;   /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig;    /* Contiguous storage info for this I/O operation */
     const unsigned char *wbuf;  /* Pointer to buffer to write */
+    const H5D_contig_sieve_list_t *list;        /* Sorted pieces of the selection */
 } H5D_contig_writevv_sieve_ud_t;
 
 /* Callback info for [plain] writevv operation */
@@ -83,6 +118,14 @@ typedef struct H5D_contig_writevv_ud_t {
     H5F_t *file;                /* File for dataset */
     haddr_t dset_addr;          /* Address of dataset */
     const unsigned char *wbuf;  /* Pointer to buffer to write */
+
+    /* Pieces gathered for a vector write */
+    hbool_t use_vector;         /* Whether to gather pieces into vector writes */
+    uint32_t nvec;              /* # of pieces gathered */
+    H5FD_mem_t types[H5D_CONTIG_VEC_BATCH];     /* Memory types of pieces */
+    haddr_t addrs[H5D_CONTIG_VEC_BATCH];        /* File addresses of pieces */
+    size_t sizes[H5D_CONTIG_VEC_BATCH];         /* Sizes of pieces */
+    const void *bufs[H5D_CONTIG_VEC_BATCH];     /* Buffers for pieces */
 } H5D_contig_writevv_ud_t;
 
 
@@ -107,6 +150,17 @@ static herr_t H5D__contig_flush(H5D_t *dset);
 /* Helper routines */
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset,
     size_t size);
+static herr_t H5D__contig_sieve_gather(const H5D_io_info_t *io_info,
+    H5D_contig_sieve_list_t *list, ssize_t *nbytes,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[]);
+static herr_t H5D__contig_sieve_gather_cb(hsize_t dst_off, hsize_t src_off,
+    size_t len, void *_udata);
+static int H5D__contig_sieve_cmp(const void *_piece1, const void *_piece2);
+static herr_t H5D__contig_vec_cb(hsize_t dst_off, hsize_t src_off, size_t len,
+    void *_udata);
+static size_t H5D__contig_sieve_extent(const H5D_contig_sieve_list_t *list,
+    size_t max_size, hbool_t *has_hole);
 
 
 /*********************/
@@ -140,6 +194,9 @@ const H5D_layout_ops_t H5D_LOPS_CONTIG[1] = {{
 /* Declare a PQ free list to manage the sieve buffer information */
 H5FL_BLK_DEFINE(sieve_buf);
 
+/* Declare a free list to manage sequences of selection pieces */
+H5FL_SEQ_DEFINE_STATIC(H5D_contig_sieve_piece_t);
+
 /* Declare extern the free list to manage blocks of type conversion data */
 H5FL_BLK_EXTERN(type_conv);
 
@@ -675,10 +732,269 @@ done:
 }   /* end H5D__contig_write_one() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_gather_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_sieve_gather(), records a
+ *              piece of the selection.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_gather_cb(hsize_t dst_off, hsize_t src_off, size_t len,
+    void *_udata)
+{
+    H5D_contig_sieve_list_t *list = (H5D_contig_sieve_list_t *)_udata; /* User data for H5VM_opvv() operator */
+    H5D_contig_sieve_piece_t *piece;    /* Piece to record */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    piece = &list->pieces[list->npieces];
+    piece->dst_off = dst_off;
+    piece->src_off = src_off;
+    piece->len = len;
+    piece->idx = list->npieces++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+}   /* end H5D__contig_sieve_gather_cb() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_cmp
+ *
+ * Purpose:	Compares two pieces of a selection by their offsets in the
+ *              dataset, keeping pieces at the same offset in selection
+ *              order so that the last write to an element wins.
+ *
+ * Return:	<0, 0 or >0, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__contig_sieve_cmp(const void *_piece1, const void *_piece2)
+{
+    const H5D_contig_sieve_piece_t *piece1 = (const H5D_contig_sieve_piece_t *)_piece1;
+    const H5D_contig_sieve_piece_t *piece2 = (const H5D_contig_sieve_piece_t *)_piece2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(piece1->dst_off < piece2->dst_off)
+        ret_value = -1;
+    else if(piece1->dst_off > piece2->dst_off)
+        ret_value = 1;
+    else if(piece1->idx < piece2->idx)
+        ret_value = -1;
+    else if(piece1->idx > piece2->idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_sieve_cmp() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_gather
+ *
+ * Purpose:	Collects the pieces of a selection for sieve buffer I/O and
+ *              sorts them by offset in the dataset, so that each load of
+ *              the sieve buffer serves every piece that falls within it,
+ *              however the selection orders them.
+ *
+ *              The caller frees LIST->pieces.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_gather(const H5D_io_info_t *io_info,
+    H5D_contig_sieve_list_t *list, ssize_t *nbytes,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
+{
+    size_t max_pieces;          /* Max. # of pieces the sequences can produce */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(list);
+    HDassert(list->pieces == NULL);
+
+    list->npieces = 0;
+    list->curr = 0;
+    list->gap_size = H5F_SIEVE_GAP_SIZE(io_info->dset->oloc.file);
+
+    /* Each piece uses up at least one dataset or memory sequence */
+    max_pieces = (dset_max_nseq - *dset_curr_seq) + (mem_max_nseq - *mem_curr_seq);
+    if(max_pieces == 0) {
+        *nbytes = 0;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if(NULL == (list->pieces = H5FL_SEQ_MALLOC(H5D_contig_sieve_piece_t, max_pieces)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for selection pieces")
+
+    /* Record the pieces */
+    if((*nbytes = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+            mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+            H5D__contig_sieve_gather_cb, list)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't gather selection pieces")
+
+    /* Sort the pieces, if they aren't in order already */
+    for(u = 1; u < list->npieces; u++)
+        if(list->pieces[u].dst_off < list->pieces[u - 1].dst_off) {
+            HDqsort(list->pieces, list->npieces, sizeof(H5D_contig_sieve_piece_t), H5D__contig_sieve_cmp);
+            break;
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_sieve_gather() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_extent
+ *
+ * Purpose:	Determines how much of the file to load into the sieve
+ *              buffer for the current piece of a selection.  The buffer
+ *              starts at the current piece and covers up to MAX_SIZE
+ *              bytes, but stops at the end of the last piece before a
+ *              hole in the selection larger than the file's sieve gap
+ *              size, so large holes aren't read for nothing.
+ *
+ *              If HAS_HOLE is non-NULL, it is set to whether any part of
+ *              the region isn't covered by the pieces, i.e. whether the
+ *              region must be read before writing the pieces into it.
+ *
+ * Return:	Size of the region to load (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__contig_sieve_extent(const H5D_contig_sieve_list_t *list, size_t max_size,
+    hbool_t *has_hole)
+{
+    const H5D_contig_sieve_piece_t *piece;      /* Current piece */
+    hsize_t start;              /* Offset of start of region */
+    hsize_t end;                /* Offset past the pieces covered so far */
+    hbool_t hole = FALSE;       /* Whether there's a hole between pieces */
+    size_t u;                   /* Local index variable */
+    size_t ret_value = max_size; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(list);
+    HDassert(list->curr < list->npieces);
+
+    piece = &list->pieces[list->curr];
+    start = piece->dst_off;
+    end = start + piece->len;
+
+    /* Walk the following pieces that fit in the region */
+    for(u = list->curr + 1; u < list->npieces; u++) {
+        piece = &list->pieces[u];
+
+        /* Stop the region before a hole that's too large */
+        if(piece->dst_off > end && (piece->dst_off - end) > list->gap_size) {
+            ret_value = (size_t)MIN(end - start, max_size);
+            break;
+        } /* end if */
+
+        /* Stop at the first piece that doesn't fit */
+        if((piece->dst_off + piece->len) - start > max_size)
+            break;
+
+        if(piece->dst_off > end)
+            hole = TRUE;
+        end = MAX(end, piece->dst_off + piece->len);
+    } /* end for */
+
+    if(has_hole)
+        *has_hole = hole || (end - start) < ret_value;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_sieve_extent() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vec_sieve
+ *
+ * Purpose:	Writes out a dataset's sieve buffer if it's dirty, before
+ *              I/O on the dataset is gathered into a vector that bypasses
+ *              the sieve buffer.  If DISCARD is set, the sieve buffer is
+ *              also released, so it can't return stale data later.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_vec_sieve(const H5D_t *dset, hbool_t discard)
+{
+    H5D_rdcdc_t *dset_contig = &(dset->shared->cache.contig); /* Cached information about contiguous data */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(dset_contig->sieve_buf) {
+        /* Flush the sieve buffer, if it's dirty */
+        if(dset_contig->sieve_dirty) {
+            if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+            /* Reset sieve buffer dirty flag */
+            dset_contig->sieve_dirty = FALSE;
+        } /* end if */
+
+        if(discard)
+            dset_contig->sieve_buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset_contig->sieve_buf);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_vec_sieve() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vec_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_readvv() and
+ *              H5D__contig_writevv() when the I/O is gathered into the
+ *              vector of a multi-dataset transfer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vec_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+{
+    H5D_contig_vec_ud_t *udata = (H5D_contig_vec_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5D__io_vec_add(udata->io_info, udata->dset_addr + dst_off, len, src_off) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add piece to I/O vector")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_vec_cb() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
- * Purpose:	Callback operator for H5D__contig_readvv() with sieve buffer.
+ * Purpose:	Reads one piece of a selection through the sieve buffer,
+ *              for H5D__contig_readvv().  The pieces are handled in order
+ *              of their offsets in the dataset.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -742,9 +1058,12 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
             /* Set up the buffer parameters */
             max_data = store_contig->dset_size - dst_off;
 
-            /* Compute the size of the sieve buffer */
+            /* Compute the size of the sieve buffer, stopping before any
+             * hole in the selection that's too large to read through
+             */
             min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
             H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+            dset_contig->sieve_size = H5D__contig_sieve_extent(udata->list, dset_contig->sieve_size, NULL);
 
             /* Read the new sieve buffer */
             if(H5F_block_read(file, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
@@ -819,11 +1138,13 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
 
                 /* Compute the size of the sieve buffer.
                  * Don't read off the end of the file, don't read past
-                 * the end of the data element, and don't read more than
-                 * the buffer size.
+                 * the end of the data element, don't read more than the
+                 * buffer size, and don't read through large holes in the
+                 * selection.
                  */
                 min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size); 
                 H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+                dset_contig->sieve_size = H5D__contig_sieve_extent(udata->list, dset_contig->sieve_size, NULL);
 
                 /* Update local copies of sieve information */
                 sieve_start = dset_contig->sieve_loc;
@@ -868,10 +1189,23 @@ H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if(H5F_block_read(udata->file, H5FD_MEM_DRAW, (udata->dset_addr + dst_off),
-            len, (udata->rbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    if(udata->use_vector) {
+        /* Add the piece to the vector, issuing the read when it's full */
+        udata->types[udata->nvec] = H5FD_MEM_DRAW;
+        udata->addrs[udata->nvec] = udata->dset_addr + dst_off;
+        udata->sizes[udata->nvec] = len;
+        udata->bufs[udata->nvec] = udata->rbuf + src_off;
+        if(++udata->nvec == H5D_CONTIG_VEC_BATCH) {
+            if(H5F_block_read_vector(udata->file, udata->nvec, udata->types, udata->addrs, udata->sizes, udata->bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+            udata->nvec = 0;
+        } /* end if */
+    } /* end if */
+    else
+        /* Read data */
+        if(H5F_block_read(udata->file, H5FD_MEM_DRAW, (udata->dset_addr + dst_off),
+                len, (udata->rbuf + src_off)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -892,7 +1226,8 @@ done:
  *              Friday, May 3, 2001
  *
  * Notes:
- *      Offsets in the sequences must be monotonically increasing
+ *      Offsets in the sequences need not be in order; with the sieve
+ *      buffer, the pieces are sorted before they are read
  *
  *-------------------------------------------------------------------------
  */
@@ -901,10 +1236,13 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
+    H5D_contig_sieve_list_t list;   /* Sorted pieces of the selection, for sieve buffer I/O */
     ssize_t ret_value = -1;     /* Return value */
 
     FUNC_ENTER_STATIC
 
+    list.pieces = NULL;
+
     /* Check args */
     HDassert(io_info);
     HDassert(dset_curr_seq);
@@ -914,8 +1252,28 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the reads are gathered into the vector of a multi-dataset read */
+    if(io_info->vec) {
+        H5D_contig_vec_ud_t udata;      /* User data for H5VM_opvv() operator */
+
+        /* Write out a dirty sieve buffer, so the data in it is read */
+        if(H5D__contig_vec_sieve(io_info->dset, FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush sieve buffer")
+
+        /* Set up user data for H5VM_opvv() */
+        udata.io_info = io_info;
+        udata.dset_addr = io_info->store->contig.dset_addr;
+
+        /* Add the pieces to the vector */
+        if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                H5D__contig_vec_cb, &udata)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't gather vectorized read")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
+    else if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)
+            && (io_info->dset->shared->cache.contig.sieve_buf_size > 0
+                || io_info->dset->shared->cache.contig.sieve_buf)) {
         H5D_contig_readvv_sieve_ud_t udata;     /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -923,12 +1281,21 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
         udata.dset_contig = &(io_info->dset->shared->cache.contig);
         udata.store_contig = &(io_info->store->contig);
         udata.rbuf = (unsigned char *)io_info->u.rbuf;
+        udata.list = &list;
 
-        /* Call generic sequence operation routine */
-        if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
-                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
-                H5D__contig_readvv_sieve_cb, &udata)) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized sieve buffer read")
+        /* Gather the pieces of the selection, sorted by offset in the dataset */
+        if(H5D__contig_sieve_gather(io_info, &list, &ret_value,
+                dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't gather selection pieces")
+
+        /* Read the pieces through the sieve buffer */
+        for(list.curr = 0; list.curr < list.npieces; list.curr++) {
+            const H5D_contig_sieve_piece_t *piece = &list.pieces[list.curr];
+
+            if(H5D__contig_readvv_sieve_cb(piece->dst_off, piece->src_off, piece->len, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized sieve buffer read")
+        } /* end for */
     } /* end if */
     else {
         H5D_contig_readvv_ud_t udata;     /* User data for H5VM_opvv() operator */
@@ -938,14 +1305,28 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.rbuf = (unsigned char *)io_info->u.rbuf;
 
+        /* Gather the pieces into vector reads, unless the I/O could be
+         * collective
+         */
+        udata.use_vector = !H5F_HAS_FEATURE(udata.file, H5FD_FEAT_HAS_MPI);
+        udata.nvec = 0;
+
         /* Call generic sequence operation routine */
         if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
                 mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
                 H5D__contig_readvv_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+
+        /* Read any pieces left in the vector */
+        if(udata.nvec > 0)
+            if(H5F_block_read_vector(udata.file, udata.nvec, udata.types, udata.addrs, udata.sizes, udata.bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
     } /* end else */
 
 done:
+    if(list.pieces)
+        list.pieces = H5FL_SEQ_FREE(H5D_contig_sieve_piece_t, list.pieces);
+
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_readvv() */
 
@@ -953,7 +1334,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_writevv_sieve_cb
  *
- * Purpose:	Callback operator for H5D__contig_writevv() with sieve buffer.
+ * Purpose:	Writes one piece of a selection through the sieve buffer,
+ *              for H5D__contig_writevv().  The pieces are handled in order
+ *              of their offsets in the dataset.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -978,6 +1361,7 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
     haddr_t rel_eoa;	        /* Relative end of file address	*/
     hsize_t max_data;           /* Actual maximum size of data to cache */
     hsize_t min;                /* temporary minimum value (avoids some ugly macro nesting) */
+    hbool_t has_hole;           /* Whether the pieces leave holes in the sieve buffer */
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -1021,12 +1405,15 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
             /* Set up the buffer parameters */
             max_data = store_contig->dset_size - dst_off;
 
-            /* Compute the size of the sieve buffer */
+            /* Compute the size of the sieve buffer, stopping before any
+             * hole in the selection that's too large to read through
+             */
             min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size); 
             H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+            dset_contig->sieve_size = H5D__contig_sieve_extent(udata->list, dset_contig->sieve_size, &has_hole);
 
             /* Check if there is any point in reading the data from the file */
-            if(dset_contig->sieve_size > len) {
+            if(has_hole) {
                 /* Read the new sieve buffer */
                 if(H5F_block_read(file, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
@@ -1140,11 +1527,13 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
 
                     /* Compute the size of the sieve buffer.
                      * Don't read off the end of the file, don't read past
-                     * the end of the data element, and don't read more than
-                     * the buffer size.
+                     * the end of the data element, don't read more than the
+                     * buffer size, and don't read through large holes in the
+                     * selection.
                      */
                     min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size); 
                     H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+                    dset_contig->sieve_size = H5D__contig_sieve_extent(udata->list, dset_contig->sieve_size, &has_hole);
 
                     /* Update local copies of sieve information */
                     sieve_start = dset_contig->sieve_loc;
@@ -1152,7 +1541,7 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
                     sieve_end = sieve_start + sieve_size;
 
                     /* Check if there is any point in reading the data from the file */
-                    if(dset_contig->sieve_size > len) {
+                    if(has_hole) {
                         /* Read the new sieve buffer */
                         if(H5F_block_read(file, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
                             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
@@ -1193,9 +1582,22 @@ H5D__contig_writevv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udat
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if(H5F_block_write(udata->file, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len, (udata->wbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    if(udata->use_vector) {
+        /* Add the piece to the vector, issuing the write when it's full */
+        udata->types[udata->nvec] = H5FD_MEM_DRAW;
+        udata->addrs[udata->nvec] = udata->dset_addr + dst_off;
+        udata->sizes[udata->nvec] = len;
+        udata->bufs[udata->nvec] = udata->wbuf + src_off;
+        if(++udata->nvec == H5D_CONTIG_VEC_BATCH) {
+            if(H5F_block_write_vector(udata->file, udata->nvec, udata->types, udata->addrs, udata->sizes, udata->bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+            udata->nvec = 0;
+        } /* end if */
+    } /* end if */
+    else
+        /* Write data */
+        if(H5F_block_write(udata->file, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len, (udata->wbuf + src_off)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1216,7 +1618,8 @@ done:
  *              Friday, May 2, 2003
  *
  * Notes:
- *      Offsets in the sequences must be monotonically increasing
+ *      Offsets in the sequences need not be in order; with the sieve
+ *      buffer, the pieces are sorted before they are written
  *
  *-------------------------------------------------------------------------
  */
@@ -1225,10 +1628,13 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
+    H5D_contig_sieve_list_t list;   /* Sorted pieces of the selection, for sieve buffer I/O */
     ssize_t ret_value = -1;             /* Return value (Size of sequence in bytes) */
 
     FUNC_ENTER_STATIC
 
+    list.pieces = NULL;
+
     /* Check args */
     HDassert(io_info);
     HDassert(dset_curr_seq);
@@ -1238,8 +1644,28 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the writes are gathered into the vector of a multi-dataset write */
+    if(io_info->vec) {
+        H5D_contig_vec_ud_t udata;      /* User data for H5VM_opvv() operator */
+
+        /* Write out and drop the sieve buffer, which the writes would make stale */
+        if(H5D__contig_vec_sieve(io_info->dset, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush sieve buffer")
+
+        /* Set up user data for H5VM_opvv() */
+        udata.io_info = io_info;
+        udata.dset_addr = io_info->store->contig.dset_addr;
+
+        /* Add the pieces to the vector */
+        if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                H5D__contig_vec_cb, &udata)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't gather vectorized write")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
+    else if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)
+            && (io_info->dset->shared->cache.contig.sieve_buf_size > 0
+                || io_info->dset->shared->cache.contig.sieve_buf)) {
         H5D_contig_writevv_sieve_ud_t udata;    /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1247,12 +1673,21 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
         udata.dset_contig = &(io_info->dset->shared->cache.contig);
         udata.store_contig = &(io_info->store->contig);
         udata.wbuf = (const unsigned char *)io_info->u.wbuf;
+        udata.list = &list;
 
-        /* Call generic sequence operation routine */
-        if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
-                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
-                H5D__contig_writevv_sieve_cb, &udata)) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized sieve buffer write")
+        /* Gather the pieces of the selection, sorted by offset in the dataset */
+        if(H5D__contig_sieve_gather(io_info, &list, &ret_value,
+                dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't gather selection pieces")
+
+        /* Write the pieces through the sieve buffer */
+        for(list.curr = 0; list.curr < list.npieces; list.curr++) {
+            const H5D_contig_sieve_piece_t *piece = &list.pieces[list.curr];
+
+            if(H5D__contig_writevv_sieve_cb(piece->dst_off, piece->src_off, piece->len, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized sieve buffer write")
+        } /* end for */
     } /* end if */
     else {
         H5D_contig_writevv_ud_t udata;     /* User data for H5VM_opvv() operator */
@@ -1262,14 +1697,28 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.wbuf = (const unsigned char *)io_info->u.wbuf;
 
+        /* Gather the pieces into vector writes, unless the I/O could be
+         * collective
+         */
+        udata.use_vector = !H5F_HAS_FEATURE(udata.file, H5FD_FEAT_HAS_MPI);
+        udata.nvec = 0;
+
         /* Call generic sequence operation routine */
         if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
                 mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
                 H5D__contig_writevv_cb, &udata)) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized write")
+
+        /* Write any pieces left in the vector */
+        if(udata.nvec > 0)
+            if(H5F_block_write_vector(udata.file, udata.nvec, udata.types, udata.addrs, udata.sizes, udata.bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
     } /* end else */
 
 done:
+    if(list.pieces)
+        list.pieces = H5FL_SEQ_FREE(H5D_contig_sieve_piece_t, list.pieces);
+
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_writevv() */
 
@@ -106,6 +106,14 @@ static const H5I_class_t H5I_DATASET_CLS[1] = {{
     (H5I_free_t)H5D__close_cb   /* Callback routine for closing objects of this class */
 }};
 
+/* Dataset I/O plan ID class */
+static const H5I_class_t H5I_DATASET_PLAN_CLS[1] = {{
+    H5I_DATASET_PLAN,           /* ID class value */
+    0,                          /* Class flags */
+    0,                          /* # of reserved IDs for class */
+    (H5I_free_t)H5D__plan_close /* Callback routine for closing objects of this class */
+}};
+
 /* Flag indicating "top" of interface has been initialized */
 static hbool_t H5D_top_package_initialize_s = FALSE;
 
@@ -161,6 +169,10 @@ H5D__init_package(void)
     if(H5I_register_type(H5I_DATASET_CLS) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize interface")
 
+    /* Initialize the atom group for the dataset I/O plan IDs */
+    if(H5I_register_type(H5I_DATASET_PLAN_CLS) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize interface")
+
     /* Reset the "default dataset" information */
     HDmemset(&H5D_def_dset, 0, sizeof(H5D_shared_t));
 
@@ -208,7 +220,12 @@ H5D_top_term_package(void)
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     if(H5D_top_package_initialize_s) {
-        if(H5I_nmembers(H5I_DATASET) > 0) {
+        /* Release I/O plans first, they hold references to datasets */
+        if(H5I_nmembers(H5I_DATASET_PLAN) > 0) {
+            (void)H5I_clear_type(H5I_DATASET_PLAN, TRUE, FALSE);
+            n++; /*H5I*/
+        } /* end if */
+        else if(H5I_nmembers(H5I_DATASET) > 0) {
             /* The dataset API uses the "force" flag set to true because it
              * is using the "file objects" (H5FO) API functions to track open
              * objects in the file.  Using the H5FO code means that dataset
@@ -267,10 +284,12 @@ H5D_term_package(void)
     if(H5_PKG_INIT_VAR) {
         /* Sanity checks */
         HDassert(0 == H5I_nmembers(H5I_DATASET));
+        HDassert(0 == H5I_nmembers(H5I_DATASET_PLAN));
         HDassert(FALSE == H5D_top_package_initialize_s);
 
         /* Destroy the dataset object id group */
         n += (H5I_dec_type_ref(H5I_DATASET) > 0);
+        n += (H5I_dec_type_ref(H5I_DATASET_PLAN) > 0);
 
         /* Mark closed */
         if(0 == n)
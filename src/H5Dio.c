@@ -40,6 +40,9 @@
 /* Local Macros */
 /****************/
 
+/* Initial and max. # of pieces gathered in a raw data I/O vector */
+#define H5D_IO_VEC_MIN_PIECES   64
+#define H5D_IO_VEC_MAX_PIECES   (64 * 1024)
 
 /******************/
 /* Local Typedefs */
@@ -61,6 +64,24 @@ static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset,
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
 
+/* Transfer routines */
+static herr_t H5D__read_dset(H5D_t *dataset, hid_t mem_type_id,
+    const H5S_t *mem_space, const H5S_t *file_space, H5D_io_vec_t *vec,
+    void *buf/*out*/);
+static herr_t H5D__write_dset(H5D_t *dataset, hid_t mem_type_id,
+    const H5S_t *mem_space, const H5S_t *file_space, H5D_io_vec_t *vec,
+    const void *buf);
+static herr_t H5D__read_io(H5D_t *dataset, const H5D_type_info_t *type_info,
+    hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
+    H5D_chunk_map_t *fm, H5D_io_vec_t *vec, void *buf/*out*/);
+static herr_t H5D__write_io(H5D_t *dataset, const H5D_type_info_t *type_info,
+    hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
+    H5D_chunk_map_t *fm, H5D_io_vec_t *vec, const void *buf);
+static int H5D__io_vec_cmp(const void *_piece1, const void *_piece2);
+static int H5D__io_vec_idx_cmp(const void *_piece1, const void *_piece2);
+static const H5D_type_info_t *H5D__plan_setup(H5D_plan_t *plan,
+    const hssize_t *offset, hbool_t do_write);
+
 
 /*********************/
 /* Package Variables */
@@ -77,6 +98,12 @@ H5FL_BLK_DEFINE(type_conv);
 /* Declare a free list to manage the H5D_chunk_map_t struct */
 H5FL_DEFINE(H5D_chunk_map_t);
 
+/* Declare a free list to manage the H5D_plan_t struct */
+H5FL_DEFINE_STATIC(H5D_plan_t);
+
+/* Declare a free list to manage sequences of raw data I/O pieces */
+H5FL_SEQ_DEFINE_STATIC(H5D_io_vec_piece_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -309,6 +336,407 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Dread_multi
+ *
+ * Purpose:	Reads (part of) each of COUNT datasets into application
+ *		memory.  Element I of each of the arrays DSET_ID,
+ *		MEM_TYPE_ID, MEM_SPACE_ID, FILE_SPACE_ID and BUF has the
+ *		same meaning as the corresponding argument of H5Dread() for
+ *		dataset I.  All the datasets are read with the transfer
+ *		properties in DXPL_ID.
+ *
+ *		Data that can be read straight from contiguous datasets
+ *		into the application's buffers is gathered across all the
+ *		datasets, sorted by file address and read with as few
+ *		vector requests to the file driver as possible.  Other
+ *		data is read one dataset at a time, as for H5Dread().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+    void *buf[]/*out*/)
+{
+    H5D_t          **dsets = NULL;      /* Datasets to read */
+    const H5S_t    **mem_spaces = NULL; /* Memory dataspaces */
+    const H5S_t    **file_spaces = NULL; /* File dataspaces */
+    hbool_t         direct_read = FALSE; /* Whether direct chunk reads are requested */
+    size_t          u;                  /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* check arguments */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+    if(!dset_id || !mem_type_id || !mem_space_id || !file_space_id || !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid array pointer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Direct chunk reads go through H5Dread() */
+    if(H5CX_get_dcr_flag(&direct_read) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error getting flag for direct chunk read")
+    if(direct_read)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "direct chunk reads are not supported for multiple datasets")
+
+    /* Allocate the arrays of datasets and dataspaces */
+    if(NULL == (dsets = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataset array")
+    if(NULL == (mem_spaces = (const H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataspace array")
+    if(NULL == (file_spaces = (const H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataspace array")
+
+    /* Check each dataset's arguments, before reading any of them */
+    for(u = 0; u < count; u++) {
+        if(NULL == (dsets[u] = (H5D_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+        if(NULL == dsets[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file")
+        if(mem_space_id[u] < 0 || file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+        if(H5S_ALL != mem_space_id[u]) {
+            if(NULL == (mem_spaces[u] = (const H5S_t *)H5I_object_verify(mem_space_id[u], H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(mem_spaces[u]) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "memory selection+offset not within extent")
+        } /* end if */
+        if(H5S_ALL != file_space_id[u]) {
+            if(NULL == (file_spaces[u] = (const H5S_t *)H5I_object_verify(file_space_id[u], H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(file_spaces[u]) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "file selection+offset not within extent")
+        } /* end if */
+    } /* end for */
+
+    /* Read raw data */
+    if(H5D__read_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    H5MM_xfree(dsets);
+    H5MM_xfree(mem_spaces);
+    H5MM_xfree(file_spaces);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dwrite_multi
+ *
+ * Purpose:	Writes (part of) each of COUNT datasets from application
+ *		memory.  The arguments are as for H5Dread_multi(), and
+ *		element I of each array has the same meaning as the
+ *		corresponding argument of H5Dwrite() for dataset I.
+ *
+ *		If the same elements of a dataset are written more than
+ *		once, the last write wins, as it would with a series of
+ *		H5Dwrite() calls.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+    const void *buf[])
+{
+    H5D_t          **dsets = NULL;      /* Datasets to write */
+    const H5S_t    **mem_spaces = NULL; /* Memory dataspaces */
+    const H5S_t    **file_spaces = NULL; /* File dataspaces */
+    hbool_t         direct_write = FALSE; /* Whether direct chunk writes are requested */
+    size_t          u;                  /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* check arguments */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+    if(!dset_id || !mem_type_id || !mem_space_id || !file_space_id || !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid array pointer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Direct chunk writes go through H5Dwrite() */
+    if(H5CX_get_dcw_flag(&direct_write) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error getting flag for direct chunk write")
+    if(direct_write)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "direct chunk writes are not supported for multiple datasets")
+
+    /* Allocate the arrays of datasets and dataspaces */
+    if(NULL == (dsets = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataset array")
+    if(NULL == (mem_spaces = (const H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataspace array")
+    if(NULL == (file_spaces = (const H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataspace array")
+
+    /* Check each dataset's arguments, before writing any of them */
+    for(u = 0; u < count; u++) {
+        if(NULL == (dsets[u] = (H5D_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+        if(NULL == dsets[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file")
+        if(mem_space_id[u] < 0 || file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+        if(H5S_ALL != mem_space_id[u]) {
+            if(NULL == (mem_spaces[u] = (const H5S_t *)H5I_object_verify(mem_space_id[u], H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(mem_spaces[u]) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "memory selection+offset not within extent")
+        } /* end if */
+        if(H5S_ALL != file_space_id[u]) {
+            if(NULL == (file_spaces[u] = (const H5S_t *)H5I_object_verify(file_space_id[u], H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(file_spaces[u]) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "file selection+offset not within extent")
+        } /* end if */
+    } /* end for */
+
+    /* Write raw data */
+    if(H5D__write_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(dsets);
+    H5MM_xfree(mem_spaces);
+    H5MM_xfree(file_spaces);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dplan_create
+ *
+ * Purpose:	Prepares a reusable plan for transferring the elements
+ *		selected in FILE_SPACE_ID of a dataset to or from the
+ *		elements selected in MEM_SPACE_ID of an application buffer,
+ *		converting them to or from MEM_TYPE_ID.  The arguments have
+ *		the same meaning as for H5Dread() and H5Dwrite().
+ *
+ *		The plan keeps its own copies of the datatype, dataspaces
+ *		and transfer property list, so later changes to them do not
+ *		affect it.  The checks and set up that H5Dread() and
+ *		H5Dwrite() perform on every call are done once, and each
+ *		H5Dplan_read() or H5Dplan_write() call only moves the file
+ *		selection to a new offset and performs the transfer.
+ *
+ *		The plan holds a reference to the dataset until it is
+ *		closed with H5Dplan_close().  Transfers fail while the
+ *		dataset's extent differs from the extent of the plan's file
+ *		dataspace, e.g. after H5Dset_extent().
+ *
+ * Return:	Success:	The ID of a new dataset I/O plan
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5Dplan_create(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id)
+{
+    H5D_plan_t      *plan = NULL;       /* New I/O plan */
+    const H5S_t	    *mem_space = NULL;  /* Memory dataspace */
+    const H5S_t	    *file_space = NULL; /* File dataspace */
+    hid_t           ret_value = H5I_INVALID_HID;    /* Return value */
+
+    FUNC_ENTER_API(H5I_INVALID_HID)
+    H5TRACE5("i", "iiiii", dset_id, mem_type_id, mem_space_id, file_space_id,
+             dxpl_id);
+
+    /* check arguments */
+    if(NULL == H5I_object_verify(dset_id, H5I_DATASET))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not a dataset")
+    if(NULL == H5I_object_verify(mem_type_id, H5I_DATATYPE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not a datatype")
+    if(mem_space_id < 0 || file_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not a dataspace")
+    if(H5S_ALL != mem_space_id) {
+        if(NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_space_id, H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not a dataspace")
+
+        /* Check for valid selection */
+        if(H5S_SELECT_VALID(mem_space) != TRUE)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, H5I_INVALID_HID, "memory selection+offset not within extent")
+    } /* end if */
+    if(H5S_ALL != file_space_id)
+        if(NULL == (file_space = (const H5S_t *)H5I_object_verify(file_space_id, H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not a dataspace")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Create the plan */
+    if(NULL == (plan = H5D__plan_create(dset_id, mem_type_id, mem_space, file_space, dxpl_id)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, H5I_INVALID_HID, "unable to create dataset I/O plan")
+
+    /* Register the plan */
+    if((ret_value = H5I_register(H5I_DATASET_PLAN, plan, TRUE)) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register dataset I/O plan")
+
+done:
+    if(ret_value < 0)
+        if(plan && H5D__plan_close(plan) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, H5I_INVALID_HID, "unable to release dataset I/O plan")
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dplan_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dplan_read
+ *
+ * Purpose:	Reads the data described by a dataset I/O plan into
+ *		application memory BUF.
+ *
+ *		OFFSET is the offset of the plan's file selection within
+ *		the dataset, as for H5Soffset_simple(), and replaces any
+ *		offset the file dataspace had when the plan was created.
+ *		A NULL OFFSET transfers the selection without an offset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dplan_read(hid_t plan_id, const hssize_t *offset, void *buf/*out*/)
+{
+    H5D_plan_t      *plan;              /* Dataset I/O plan */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*Hsx", plan_id, offset, buf);
+
+    /* check arguments */
+    if(NULL == (plan = (H5D_plan_t *)H5I_object_verify(plan_id, H5I_DATASET_PLAN)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset I/O plan")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(plan->dxpl_id);
+
+    /* Read raw data */
+    if(H5D__plan_read(plan, offset, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dplan_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dplan_write
+ *
+ * Purpose:	Writes the data described by a dataset I/O plan from
+ *		application memory BUF.  OFFSET is interpreted as for
+ *		H5Dplan_read().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dplan_write(hid_t plan_id, const hssize_t *offset, const void *buf)
+{
+    H5D_plan_t      *plan;              /* Dataset I/O plan */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*Hs*x", plan_id, offset, buf);
+
+    /* check arguments */
+    if(NULL == (plan = (H5D_plan_t *)H5I_object_verify(plan_id, H5I_DATASET_PLAN)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset I/O plan")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(plan->dxpl_id);
+
+    /* Write raw data */
+    if(H5D__plan_write(plan, offset, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dplan_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dplan_close
+ *
+ * Purpose:	Closes a dataset I/O plan and releases its reference to
+ *		the dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dplan_close(hid_t plan_id)
+{
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plan_id);
+
+    /* check arguments */
+    if(NULL == H5I_object_verify(plan_id, H5I_DATASET_PLAN))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset I/O plan")
+
+    /* Decrement the counter on the plan ID.  It will be freed if the count
+     * reaches zero.
+     */
+    if(H5I_dec_app_ref(plan_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement count on dataset I/O plan ID")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dplan_close() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__pre_write
@@ -393,9 +821,36 @@ done:
 herr_t
 H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     const H5S_t *file_space, void *buf/*out*/)
+{
+    herr_t	ret_value = SUCCEED;	/* Return value	*/
+
+    FUNC_ENTER_PACKAGE_VOL
+
+    if(H5D__read_dset(dataset, mem_type_id, mem_space, file_space, NULL, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_NOAPI_VOL(ret_value)
+} /* end H5D__read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_dset
+ *
+ * Purpose:	Reads (part of) a DATASET into application memory BUF, for
+ *		H5D__read() and H5D__read_multi().  If VEC is not NULL,
+ *		contiguous raw data may be added to it instead of being
+ *		read, and is only in BUF once the vector is flushed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__read_dset(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
+    const H5S_t *file_space, H5D_io_vec_t *vec, void *buf/*out*/)
 {
     H5D_chunk_map_t *fm = NULL;         /* Chunk file<->memory mapping */
-    H5D_io_info_t io_info;              /* Dataset I/O info     */
     H5D_type_info_t type_info;          /* Datatype info for operation */
     hbool_t type_info_init = FALSE;     /* Whether the datatype info has been initialized */
     H5S_t * projected_mem_space = NULL; /* If not NULL, ptr to dataspace containing a     */
@@ -411,14 +866,12 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
                                         /* Note that if this variable is used, the        */
                                         /* projected mem space must be discarded at the   */
                                         /* end of the function to avoid a memory leak.    */
-    H5D_storage_t store;                /*union of EFL and chunk pointer in file space */
     hssize_t	snelmts;                /*total number of elmts	(signed) */
     hsize_t	nelmts;                 /*total number of elmts	*/
-    hbool_t     io_op_init = FALSE;     /* Whether the I/O op has been initialized */
     char        fake_char;              /* Temporary variable for NULL buffer pointers */
     herr_t	ret_value = SUCCEED;	/* Return value	*/
 
-    FUNC_ENTER_PACKAGE_VOL_TAG(dataset->oloc.addr)
+    FUNC_ENTER_STATIC_TAG(dataset->oloc.addr)
 
     /* check args */
     HDassert(dataset && dataset->oloc.file);
@@ -505,88 +958,29 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     } /* end if */
 
 
-    /* Retrieve dataset properties */
-    /* <none needed in the general case> */
-
-    /* If space hasn't been allocated and not using external storage,
-     * return fill value to buffer if fill time is upon allocation, or
-     * do nothing if fill time is never.  If the dataset is compact and
-     * fill time is NEVER, there is no way to tell whether part of data
-     * has been overwritten.  So just proceed in reading.
-     */
-    if(nelmts > 0 && dataset->shared->dcpl_cache.efl.nused == 0 &&
-            !(*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage)) {
-        H5D_fill_value_t fill_status;   /* Whether/How the fill value is defined */
+    /* Allocate the chunk map */
+    if(NULL == (fm = H5FL_CALLOC(H5D_chunk_map_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk map")
 
-        /* Retrieve dataset's fill-value properties */
-        if(H5P_is_fill_value_defined(&dataset->shared->dcpl_cache.fill, &fill_status) < 0)
-            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+    /* Perform the transfer */
+    if(H5D__read_io(dataset, &type_info, nelmts, file_space, mem_space, fm, vec, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
-        /* Should be impossible, but check anyway... */
-        if(fill_status == H5D_FILL_VALUE_UNDEFINED &&
-                (dataset->shared->dcpl_cache.fill.fill_time == H5D_FILL_TIME_ALLOC || dataset->shared->dcpl_cache.fill.fill_time == H5D_FILL_TIME_IFSET))
-            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "read failed: dataset doesn't exist, no data can be read")
+done:
+    if(fm)
+        fm = H5FL_FREE(H5D_chunk_map_t, fm);
 
-        /* If we're never going to fill this dataset, just leave the junk in the user's buffer */
-        if(dataset->shared->dcpl_cache.fill.fill_time == H5D_FILL_TIME_NEVER)
-            HGOTO_DONE(SUCCEED)
-
-        /* Go fill the user's selection with the dataset's fill value */
-        if(H5D__fill(dataset->shared->dcpl_cache.fill.buf, dataset->shared->type, buf, type_info.mem_type, mem_space) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "filling buf failed")
-        else
-            HGOTO_DONE(SUCCEED)
-    } /* end if */
-
-    /* Set up I/O operation */
-    io_info.op_type = H5D_IO_OP_READ;
-    io_info.u.rbuf = buf;
-    if(H5D__ioinfo_init(dataset, &type_info, &store, &io_info) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to set up I/O operation")
-
-    /* Sanity check that space is allocated, if there are elements */
-    if(nelmts > 0)
-        HDassert((*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage)
-                || dataset->shared->dcpl_cache.efl.nused > 0
-                || dataset->shared->layout.type == H5D_COMPACT);
-
-    /* Allocate the chunk map */
-    if(NULL == (fm = H5FL_CALLOC(H5D_chunk_map_t)))
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk map")
-
-    /* Call storage method's I/O initialization routine */
-    if(io_info.layout_ops.io_init && (*io_info.layout_ops.io_init)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize I/O info")
-    io_op_init = TRUE;
-
-#ifdef H5_HAVE_PARALLEL
-    /* Adjust I/O info for any parallel I/O */
-    if(H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
-#endif /*H5_HAVE_PARALLEL*/
-
-    /* Invoke correct "high level" I/O routine */
-    if((*io_info.io_ops.multi_read)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
-
-done:
-    /* Shut down the I/O op information */
-    if(io_op_init && io_info.layout_ops.io_term && (*io_info.layout_ops.io_term)(fm) < 0)
-        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info")
-    if(fm)
-        fm = H5FL_FREE(H5D_chunk_map_t, fm);
-
-    /* Shut down datatype info for operation */
-    if(type_info_init && H5D__typeinfo_term(&type_info) < 0)
-        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
+    /* Shut down datatype info for operation */
+    if(type_info_init && H5D__typeinfo_term(&type_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
 
     /* discard projected mem space if it was created */
     if(NULL != projected_mem_space)
         if(H5S_close(projected_mem_space) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
-    FUNC_LEAVE_NOAPI_VOL_TAG(ret_value)
-} /* end H5D__read() */
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__read_dset() */
 
 
 /*-------------------------------------------------------------------------
@@ -605,9 +999,37 @@ done:
 herr_t
 H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     const H5S_t *file_space, const void *buf)
+{
+    herr_t	ret_value = SUCCEED;	/* Return value	*/
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5D__write_dset(dataset, mem_type_id, mem_space, file_space, NULL, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_dset
+ *
+ * Purpose:	Writes (part of) a DATASET from application memory BUF,
+ *		for H5D__write() and H5D__write_multi().  If VEC is not
+ *		NULL, contiguous raw data may be added to it instead of
+ *		being written, and BUF must stay valid until the vector is
+ *		flushed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__write_dset(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
+    const H5S_t *file_space, H5D_io_vec_t *vec, const void *buf)
 {
     H5D_chunk_map_t *fm = NULL;         /* Chunk file<->memory mapping */
-    H5D_io_info_t io_info;              /* Dataset I/O info     */
     H5D_type_info_t type_info;          /* Datatype info for operation */
     hbool_t type_info_init = FALSE;     /* Whether the datatype info has been initialized */
     H5S_t * projected_mem_space = NULL; /* If not NULL, ptr to dataspace containing a     */
@@ -623,14 +1045,12 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
                                         /* Note that if this variable is used, the        */
                                         /* projected mem space must be discarded at the   */
                                         /* end of the function to avoid a memory leak.    */
-    H5D_storage_t store;                /*union of EFL and chunk pointer in file space */
     hssize_t	snelmts;                /*total number of elmts	(signed) */
     hsize_t	nelmts;                 /*total number of elmts	*/
-    hbool_t     io_op_init = FALSE;     /* Whether the I/O op has been initialized */
     char        fake_char;              /* Temporary variable for NULL buffer pointers */
     herr_t	ret_value = SUCCEED;	/* Return value	*/
 
-    FUNC_ENTER_PACKAGE_TAG(dataset->oloc.addr)
+    FUNC_ENTER_STATIC_TAG(dataset->oloc.addr)
 
     /* check args */
     HDassert(dataset && dataset->oloc.file);
@@ -747,15 +1167,203 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
         buf = adj_buf;
     } /* end if */
 
-    /* Retrieve dataset properties */
-    /* <none needed currently> */
+    /* Allocate the chunk map */
+    if(NULL == (fm = H5FL_CALLOC(H5D_chunk_map_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk map")
+
+    /* Perform the transfer */
+    if(H5D__write_io(dataset, &type_info, nelmts, file_space, mem_space, fm, vec, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+#ifdef OLD_WAY
+/*
+ * This was taken out because it can be called in a parallel program with
+ * independent access, causing the metadata cache to get corrupted. Its been
+ * disabled for all types of access (serial as well as parallel) to make the
+ * modification time consistent for all programs. -QAK
+ *
+ * We should set a value in the dataset's shared information instead and flush
+ * it to the file when the dataset is being closed. -QAK
+ */
+    /*
+     * Update modification time.  We have to do this explicitly because
+     * writing to a dataset doesn't necessarily change the object header.
+     */
+    if(H5O_touch(&(dataset->oloc), FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to update modification time")
+#endif /* OLD_WAY */
+
+done:
+    if(fm)
+        fm = H5FL_FREE(H5D_chunk_map_t, fm);
+
+    /* Shut down datatype info for operation */
+    if(type_info_init && H5D__typeinfo_term(&type_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
+
+    /* discard projected mem space if it was created */
+    if(NULL != projected_mem_space)
+        if(H5S_close(projected_mem_space) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__write_dset() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_io
+ *
+ * Purpose:	Reads the elements selected in FILE_SPACE of a dataset into
+ *		the elements selected in MEM_SPACE of BUF, once the datatype
+ *		info and dataspaces for the transfer have been set up.  VEC
+ *		is as for H5D__read_dset().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__read_io(H5D_t *dataset, const H5D_type_info_t *type_info, hsize_t nelmts,
+    const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm,
+    H5D_io_vec_t *vec, void *buf/*out*/)
+{
+    H5D_io_info_t io_info;              /* Dataset I/O info     */
+    H5D_storage_t store;                /*union of EFL and chunk pointer in file space */
+    hbool_t     io_op_init = FALSE;     /* Whether the I/O op has been initialized */
+    herr_t	ret_value = SUCCEED;	/* Return value	*/
+
+    FUNC_ENTER_STATIC
+
+    /* If space hasn't been allocated and not using external storage,
+     * return fill value to buffer if fill time is upon allocation, or
+     * do nothing if fill time is never.  If the dataset is compact and
+     * fill time is NEVER, there is no way to tell whether part of data
+     * has been overwritten.  So just proceed in reading.
+     */
+    if(nelmts > 0 && dataset->shared->dcpl_cache.efl.nused == 0 &&
+            !(*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage)) {
+        H5D_fill_value_t fill_status;   /* Whether/How the fill value is defined */
+
+        /* Retrieve dataset's fill-value properties */
+        if(H5P_is_fill_value_defined(&dataset->shared->dcpl_cache.fill, &fill_status) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+
+        /* Should be impossible, but check anyway... */
+        if(fill_status == H5D_FILL_VALUE_UNDEFINED &&
+                (dataset->shared->dcpl_cache.fill.fill_time == H5D_FILL_TIME_ALLOC || dataset->shared->dcpl_cache.fill.fill_time == H5D_FILL_TIME_IFSET))
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "read failed: dataset doesn't exist, no data can be read")
+
+        /* If we're never going to fill this dataset, just leave the junk in the user's buffer */
+        if(dataset->shared->dcpl_cache.fill.fill_time == H5D_FILL_TIME_NEVER)
+            HGOTO_DONE(SUCCEED)
+
+        /* Go fill the user's selection with the dataset's fill value */
+        if(H5D__fill(dataset->shared->dcpl_cache.fill.buf, dataset->shared->type, buf, type_info->mem_type, mem_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "filling buf failed")
+        else
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Set up I/O operation */
+    io_info.op_type = H5D_IO_OP_READ;
+    io_info.u.rbuf = buf;
+    if(H5D__ioinfo_init(dataset, type_info, &store, &io_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to set up I/O operation")
+
+    /* Defer contiguous raw data I/O to the vector of a multi-dataset
+     * transfer, when the data goes straight between the file and the
+     * application's buffer
+     */
+    if(vec && dataset->shared->layout.type == H5D_CONTIGUOUS
+            && type_info->is_conv_noop && type_info->is_xform_noop
+            && !H5F_HAS_FEATURE(dataset->oloc.file, H5FD_FEAT_HAS_MPI))
+        io_info.vec = vec;
+
+    /* Sanity check that space is allocated, if there are elements */
+    if(nelmts > 0)
+        HDassert((*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage)
+                || dataset->shared->dcpl_cache.efl.nused > 0
+                || dataset->shared->layout.type == H5D_COMPACT);
+
+    /* Call storage method's I/O initialization routine */
+    if(io_info.layout_ops.io_init && (*io_info.layout_ops.io_init)(&io_info, type_info, nelmts, file_space, mem_space, fm) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize I/O info")
+    io_op_init = TRUE;
+
+#ifdef H5_HAVE_PARALLEL
+    /* Adjust I/O info for any parallel I/O */
+    if(H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, type_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
+#endif /*H5_HAVE_PARALLEL*/
+
+    /* Invoke correct "high level" I/O routine */
+    if((*io_info.io_ops.multi_read)(&io_info, type_info, nelmts, file_space, mem_space, fm) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    /* Shut down the I/O op information */
+    if(io_op_init && io_info.layout_ops.io_term && (*io_info.layout_ops.io_term)(fm) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_io
+ *
+ * Purpose:	Writes the elements selected in MEM_SPACE of BUF to the
+ *		elements selected in FILE_SPACE of a dataset, once the
+ *		datatype info and dataspaces for the transfer have been set
+ *		up.  VEC is as for H5D__write_dset().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__write_io(H5D_t *dataset, const H5D_type_info_t *type_info, hsize_t nelmts,
+    const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm,
+    H5D_io_vec_t *vec, const void *buf)
+{
+    H5D_io_info_t io_info;              /* Dataset I/O info     */
+    H5D_storage_t store;                /*union of EFL and chunk pointer in file space */
+    hbool_t     io_op_init = FALSE;     /* Whether the I/O op has been initialized */
+    herr_t	ret_value = SUCCEED;	/* Return value	*/
+
+    FUNC_ENTER_STATIC
 
     /* Set up I/O operation */
     io_info.op_type = H5D_IO_OP_WRITE;
     io_info.u.wbuf = buf;
-    if(H5D__ioinfo_init(dataset, &type_info, &store, &io_info) < 0)
+    if(H5D__ioinfo_init(dataset, type_info, &store, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up I/O operation")
 
+    /* Defer contiguous raw data I/O to the vector of a multi-dataset
+     * transfer, when the data goes straight between the file and the
+     * application's buffer
+     */
+    if(vec && dataset->shared->layout.type == H5D_CONTIGUOUS
+            && type_info->is_conv_noop && type_info->is_xform_noop
+            && !H5F_HAS_FEATURE(dataset->oloc.file, H5FD_FEAT_HAS_MPI))
+        io_info.vec = vec;
+    /* Otherwise, write out the pieces already gathered for the dataset
+     * first, so the writes reach the file in the order they were made.
+     * Then drop the dataset's sieve buffer, which doesn't hold them.
+     */
+    else if(vec) {
+        size_t u;                       /* Local index variable */
+
+        for(u = 0; u < vec->npieces; u++)
+            if(vec->pieces[u].dset_shared == dataset->shared)
+                break;
+        if(u < vec->npieces) {
+            if(H5D__io_vec_flush(vec) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush raw data I/O vector")
+            if(dataset->shared->layout.type == H5D_CONTIGUOUS && H5D__contig_vec_sieve(dataset, TRUE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush sieve buffer")
+        } /* end if */
+    } /* end if */
+
     /* Allocate data space and initialize it if it hasn't been. */
     if(nelmts > 0 && dataset->shared->dcpl_cache.efl.nused == 0 &&
             !(*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage)) {
@@ -777,61 +1385,705 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
     } /* end if */
 
-    /* Allocate the chunk map */
-    if(NULL == (fm = H5FL_CALLOC(H5D_chunk_map_t)))
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk map")
-
     /* Call storage method's I/O initialization routine */
-    if(io_info.layout_ops.io_init && (*io_info.layout_ops.io_init)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
+    if(io_info.layout_ops.io_init && (*io_info.layout_ops.io_init)(&io_info, type_info, nelmts, file_space, mem_space, fm) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize I/O info")
     io_op_init = TRUE;
 
 #ifdef H5_HAVE_PARALLEL
     /* Adjust I/O info for any parallel I/O */
-    if(H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
+    if(H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
 #endif /*H5_HAVE_PARALLEL*/
 
     /* Invoke correct "high level" I/O routine */
-    if((*io_info.io_ops.multi_write)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
+    if((*io_info.io_ops.multi_write)(&io_info, type_info, nelmts, file_space, mem_space, fm) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
 
-#ifdef OLD_WAY
-/*
- * This was taken out because it can be called in a parallel program with
- * independent access, causing the metadata cache to get corrupted. Its been
- * disabled for all types of access (serial as well as parallel) to make the
- * modification time consistent for all programs. -QAK
+done:
+    /* Shut down the I/O op information */
+    if(io_op_init && io_info.layout_ops.io_term && (*io_info.layout_ops.io_term)(fm) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
  *
- * We should set a value in the dataset's shared information instead and flush
- * it to the file when the dataset is being closed. -QAK
+ * Purpose:	Reads (part of) each of COUNT datasets into application
+ *		memory.  See H5Dread_multi() for details.  A NULL
+ *		dataspace stands for H5S_ALL.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
  */
-    /*
-     * Update modification time.  We have to do this explicitly because
-     * writing to a dataset doesn't necessarily change the object header.
+herr_t
+H5D__read_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[],
+    const H5S_t *mem_space[], const H5S_t *file_space[], void *buf[]/*out*/)
+{
+    H5D_io_vec_t vec;                   /* Raw data reads gathered across the datasets */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(count == 0 || (dset && mem_type_id && mem_space && file_space && buf));
+
+    HDmemset(&vec, 0, sizeof(vec));
+    vec.op_type = H5D_IO_OP_READ;
+
+    /* Read each dataset, gathering reads of contiguous raw data */
+    for(u = 0; u < count; u++)
+        if(H5D__read_dset(dset[u], mem_type_id[u], mem_space[u], file_space[u], &vec, buf[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+    /* Read the gathered raw data */
+    if(H5D__io_vec_flush(&vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    if(vec.pieces)
+        vec.pieces = H5FL_SEQ_FREE(H5D_io_vec_piece_t, vec.pieces);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) each of COUNT datasets from application
+ *		memory.  See H5Dwrite_multi() for details.  A NULL
+ *		dataspace stands for H5S_ALL.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[],
+    const H5S_t *mem_space[], const H5S_t *file_space[], const void *buf[])
+{
+    H5D_io_vec_t vec;                   /* Raw data writes gathered across the datasets */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(count == 0 || (dset && mem_type_id && mem_space && file_space && buf));
+
+    HDmemset(&vec, 0, sizeof(vec));
+    vec.op_type = H5D_IO_OP_WRITE;
+
+    /* Write each dataset, gathering writes of contiguous raw data */
+    for(u = 0; u < count; u++)
+        if(H5D__write_dset(dset[u], mem_type_id[u], mem_space[u], file_space[u], &vec, buf[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+    /* Write the gathered raw data */
+    if(H5D__io_vec_flush(&vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    if(vec.pieces)
+        vec.pieces = H5FL_SEQ_FREE(H5D_io_vec_piece_t, vec.pieces);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_add
+ *
+ * Purpose:	Adds a piece of raw data I/O to the vector of IO_INFO,
+ *		instead of performing it.  The piece is LEN bytes at file
+ *		address ADDR, and BUF_OFF bytes into the I/O operation's
+ *		buffer.  Pieces in a different file than those already
+ *		gathered cause the vector to be flushed first, as does a
+ *		full vector.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_vec_add(const H5D_io_info_t *io_info, haddr_t addr, size_t len,
+    hsize_t buf_off)
+{
+    H5D_io_vec_t *vec = io_info->vec;   /* Vector to add piece to */
+    H5F_t *file = io_info->dset->oloc.file; /* File for piece */
+    H5D_io_vec_piece_t *piece;          /* Piece to add */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(vec);
+    HDassert(vec->op_type == io_info->op_type);
+    HDassert(len > 0);
+
+    /* Flush the pieces gathered so far, if they're in another file or
+     * there are already enough of them
      */
-    if(H5O_touch(&(dataset->oloc), FALSE) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to update modification time")
-#endif /* OLD_WAY */
+    if((vec->file && !H5F_SAME_SHARED(vec->file, file)) || vec->npieces == H5D_IO_VEC_MAX_PIECES)
+        if(H5D__io_vec_flush(vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't flush raw data I/O vector")
+    vec->file = file;
+
+    /* Make room for the piece */
+    if(vec->npieces == vec->nalloc) {
+        size_t nalloc = MAX(H5D_IO_VEC_MIN_PIECES, 2 * vec->nalloc);    /* New # of pieces to allocate */
+        H5D_io_vec_piece_t *pieces;     /* Reallocated array of pieces */
+
+        if(NULL == (pieces = H5FL_SEQ_REALLOC(H5D_io_vec_piece_t, vec->pieces, nalloc)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data I/O vector")
+        vec->pieces = pieces;
+        vec->nalloc = nalloc;
+    } /* end if */
+
+    /* Record the piece */
+    piece = &vec->pieces[vec->npieces];
+    piece->addr = addr;
+    piece->len = len;
+    piece->idx = vec->npieces++;
+    piece->dset_shared = io_info->dset->shared;
+    if(io_info->op_type == H5D_IO_OP_READ)
+        piece->u.rbuf = (uint8_t *)io_info->u.rbuf + buf_off;
+    else
+        piece->u.wbuf = (const uint8_t *)io_info->u.wbuf + buf_off;
 
 done:
-    /* Shut down the I/O op information */
-    if(io_op_init && io_info.layout_ops.io_term && (*io_info.layout_ops.io_term)(fm) < 0)
-        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info")
-    if(fm)
-        fm = H5FL_FREE(H5D_chunk_map_t, fm);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_add() */
 
-    /* Shut down datatype info for operation */
-    if(type_info_init && H5D__typeinfo_term(&type_info) < 0)
-        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
 
-    /* discard projected mem space if it was created */
-    if(NULL != projected_mem_space)
-        if(H5S_close(projected_mem_space) < 0)
-            HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_cmp
+ *
+ * Purpose:	Compares two pieces of raw data I/O by their file
+ *		addresses, keeping pieces at the same address in the order
+ *		they were added so that the last write to an element wins.
+ *
+ * Return:	<0, 0 or >0, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__io_vec_cmp(const void *_piece1, const void *_piece2)
+{
+    const H5D_io_vec_piece_t *piece1 = (const H5D_io_vec_piece_t *)_piece1;
+    const H5D_io_vec_piece_t *piece2 = (const H5D_io_vec_piece_t *)_piece2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_lt(piece1->addr, piece2->addr))
+        ret_value = -1;
+    else if(H5F_addr_gt(piece1->addr, piece2->addr))
+        ret_value = 1;
+    else if(piece1->idx < piece2->idx)
+        ret_value = -1;
+    else if(piece1->idx > piece2->idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_idx_cmp
+ *
+ * Purpose:	Compares two pieces of raw data I/O by the order they were
+ *		added in.
+ *
+ * Return:	<0, 0 or >0, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__io_vec_idx_cmp(const void *_piece1, const void *_piece2)
+{
+    const H5D_io_vec_piece_t *piece1 = (const H5D_io_vec_piece_t *)_piece1;
+    const H5D_io_vec_piece_t *piece2 = (const H5D_io_vec_piece_t *)_piece2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(piece1->idx < piece2->idx)
+        ret_value = -1;
+    else if(piece1->idx > piece2->idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_idx_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_flush
+ *
+ * Purpose:	Performs the raw data I/O gathered in a vector and empties
+ *		it.  The pieces are sorted by file address, pieces that are
+ *		adjacent both in the file and in memory are merged, and the
+ *		rest are handed to the file layer as a single vector
+ *		request.  Writes whose pieces overlap in the file are kept
+ *		in the order they were added instead, since the file layer
+ *		writes a vector's pieces in order and the last write to an
+ *		element must win.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_vec_flush(H5D_io_vec_t *vec)
+{
+    H5FD_mem_t *types = NULL;           /* Memory types of pieces */
+    haddr_t *addrs = NULL;              /* File addresses of pieces */
+    size_t *sizes = NULL;               /* Sizes of pieces */
+    void **rbufs = NULL;                /* Buffers for pieces read */
+    const void **wbufs = NULL;          /* Buffers for pieces written */
+    size_t nvec;                        /* # of pieces after merging */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(vec);
+
+    /* Check for nothing to do */
+    if(0 == vec->npieces)
+        HGOTO_DONE(SUCCEED)
+    HDassert(vec->file);
+
+    /* Sort the pieces by file address */
+    HDqsort(vec->pieces, vec->npieces, sizeof(H5D_io_vec_piece_t), H5D__io_vec_cmp);
+
+    /* Put overlapping writes back in the order they were made */
+    if(vec->op_type == H5D_IO_OP_WRITE)
+        for(u = 1; u < vec->npieces; u++)
+            if(H5F_addr_gt(vec->pieces[u - 1].addr + vec->pieces[u - 1].len, vec->pieces[u].addr)) {
+                HDqsort(vec->pieces, vec->npieces, sizeof(H5D_io_vec_piece_t), H5D__io_vec_idx_cmp);
+                break;
+            } /* end if */
+
+    /* Allocate the arrays for the vector request */
+    if(NULL == (types = (H5FD_mem_t *)H5MM_malloc(vec->npieces * sizeof(H5FD_mem_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for vector types")
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(vec->npieces * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for vector addresses")
+    if(NULL == (sizes = (size_t *)H5MM_malloc(vec->npieces * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for vector sizes")
+    if(vec->op_type == H5D_IO_OP_READ) {
+        if(NULL == (rbufs = (void **)H5MM_malloc(vec->npieces * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for vector buffers")
+    } /* end if */
+    else
+        if(NULL == (wbufs = (const void **)H5MM_malloc(vec->npieces * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for vector buffers")
+
+    /* Fill in the vector, merging pieces that continue the previous one
+     * both in the file and in memory
+     */
+    for(u = 0, nvec = 0; u < vec->npieces; u++) {
+        const H5D_io_vec_piece_t *piece = &vec->pieces[u];
+
+        if(nvec > 0 && H5F_addr_eq(addrs[nvec - 1] + sizes[nvec - 1], piece->addr)
+                && (rbufs ? ((uint8_t *)rbufs[nvec - 1] + sizes[nvec - 1] == piece->u.rbuf)
+                        : ((const uint8_t *)wbufs[nvec - 1] + sizes[nvec - 1] == piece->u.wbuf)))
+            sizes[nvec - 1] += piece->len;
+        else {
+            types[nvec] = H5FD_MEM_DRAW;
+            addrs[nvec] = piece->addr;
+            sizes[nvec] = piece->len;
+            if(rbufs)
+                rbufs[nvec] = piece->u.rbuf;
+            else
+                wbufs[nvec] = piece->u.wbuf;
+            nvec++;
+        } /* end else */
+    } /* end for */
+
+    /* Perform the I/O */
+    H5_CHECK_OVERFLOW(nvec, size_t, uint32_t);
+    if(vec->op_type == H5D_IO_OP_READ) {
+        if(H5F_block_read_vector(vec->file, (uint32_t)nvec, types, addrs, sizes, rbufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+    } /* end if */
+    else
+        if(H5F_block_write_vector(vec->file, (uint32_t)nvec, types, addrs, sizes, wbufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
+done:
+    /* Empty the vector */
+    vec->npieces = 0;
+    vec->file = NULL;
+
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(rbufs);
+    H5MM_xfree(wbufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__plan_create
+ *
+ * Purpose:	Creates a dataset I/O plan.  See H5Dplan_create() for
+ *		details.  A NULL MEM_SPACE or FILE_SPACE stands for H5S_ALL.
+ *
+ * Return:	Success:	Pointer to the new plan
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5D_plan_t *
+H5D__plan_create(hid_t dset_id, hid_t mem_type_id, const H5S_t *mem_space,
+    const H5S_t *file_space, hid_t dxpl_id)
+{
+    H5D_plan_t *plan = NULL;            /* New I/O plan */
+    H5D_t *dataset;                     /* Dataset for plan */
+    H5T_t *mem_type = NULL;             /* Copy of memory datatype */
+    hssize_t snelmts;                   /* Number of elements (signed) */
+    H5D_plan_t *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Allocate the plan */
+    if(NULL == (plan = H5FL_CALLOC(H5D_plan_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for dataset I/O plan")
+    plan->dset_id = H5I_INVALID_HID;
+    plan->mem_type_id = H5I_INVALID_HID;
+    plan->dxpl_id = H5I_INVALID_HID;
+
+    /* Hold a reference to the dataset for the lifetime of the plan */
+    if(NULL == (dataset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a dataset")
+    if(H5I_inc_ref(dset_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINC, NULL, "can't increment count on dataset ID")
+    plan->dset_id = dset_id;
+    plan->dset = dataset;
+
+#ifdef H5_HAVE_PARALLEL
+    /* Plans only perform independent I/O, through a non-MPI file driver */
+    if(H5F_HAS_FEATURE(dataset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "I/O plans are not supported with MPI-based drivers")
+    else {
+        H5FD_mpio_xfer_t io_xfer_mode;      /* MPI I/O transfer mode */
+
+        /* Get I/O transfer mode */
+        if(H5CX_get_io_xfer_mode(&io_xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get MPI-I/O transfer mode")
+
+        /* Collective access is not permissible without a MPI based VFD */
+        if(io_xfer_mode == H5FD_MPIO_COLLECTIVE)
+            HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "collective access for MPI-based drivers only")
+    } /* end else */
+#endif /*H5_HAVE_PARALLEL*/
+
+    /* Keep a private copy of the memory datatype */
+    if(NULL == (mem_type = H5T_copy((H5T_t *)H5I_object(mem_type_id), H5T_COPY_TRANSIENT)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, NULL, "unable to copy memory datatype")
+    if((plan->mem_type_id = H5I_register(H5I_DATATYPE, mem_type, FALSE)) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTREGISTER, NULL, "unable to register memory datatype")
+    mem_type = NULL;
+
+    /* Keep a private copy of the transfer property list */
+    if(H5P_DATASET_XFER_DEFAULT == dxpl_id)
+        plan->dxpl_id = dxpl_id;
+    else {
+        H5P_genplist_t *plist;          /* Property list for DXPL */
 
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a property list")
+        if((plan->dxpl_id = H5P_copy_plist(plist, FALSE)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL, "unable to copy transfer property list")
+    } /* end else */
+
+    /* Keep private copies of the dataspaces */
+    if(!file_space)
+        file_space = dataset->shared->space;
+    if(!mem_space)
+        mem_space = file_space;
+    if(NULL == (plan->file_space = H5S_copy(file_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, NULL, "unable to copy file dataspace")
+    if(NULL == (plan->mem_space = H5S_copy(mem_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, NULL, "unable to copy memory dataspace")
+
+    /* Make certain that the number of elements in each selection is the same */
+    if((snelmts = H5S_GET_SELECT_NPOINTS(plan->mem_space)) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "memory dataspace has invalid selection")
+    H5_CHECKED_ASSIGN(plan->nelmts, hsize_t, snelmts, hssize_t);
+    if(plan->nelmts != (hsize_t)H5S_GET_SELECT_NPOINTS(plan->file_space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "src and dest dataspaces have different sizes")
+
+    /* Make sure that both selections have their extents set */
+    if(!(H5S_has_extent(plan->file_space)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "file dataspace does not have extent set")
+    if(!(H5S_has_extent(plan->mem_space)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "memory dataspace does not have extent set")
+
+    /* Project the memory dataspace to the rank of the file dataspace, as
+     * H5D__read() and H5D__write() do, and remember where the projected
+     * selection starts in the application's buffer.
+     */
+    if(TRUE == H5S_select_shape_same(plan->mem_space, plan->file_space) &&
+            H5S_GET_EXTENT_NDIMS(plan->mem_space) != H5S_GET_EXTENT_NDIMS(plan->file_space)) {
+        H5S_t *projected_mem_space = NULL;  /* Projected memory dataspace */
+        const uint8_t *base_buf = (const uint8_t *)plan;   /* Stand-in for the application's buffer */
+        const void *adj_buf = NULL;     /* Start of projected selection in buffer */
+
+        if(H5S_select_construct_projection(plan->mem_space, &projected_mem_space,
+                (unsigned)H5S_GET_EXTENT_NDIMS(plan->file_space), base_buf, &adj_buf, H5T_get_size((const H5T_t *)H5I_object(plan->mem_type_id))) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "unable to construct projected memory dataspace")
+        HDassert(projected_mem_space);
+        HDassert(adj_buf);
+        plan->mem_buf_off = (size_t)((const uint8_t *)adj_buf - base_buf);
+
+        /* Switch to using projected memory dataspace */
+        if(H5S_close(plan->mem_space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, NULL, "unable to release memory dataspace")
+        plan->mem_space = projected_mem_space;
+    } /* end if */
+
+    /* Allocate the chunk map */
+    if(NULL == (plan->fm = H5FL_CALLOC(H5D_chunk_map_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate chunk map")
+
+    /* Set return value */
+    ret_value = plan;
+
+done:
+    if(NULL == ret_value) {
+        if(mem_type && H5T_close(mem_type) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, NULL, "unable to release memory datatype")
+        if(plan && H5D__plan_close(plan) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, NULL, "unable to release dataset I/O plan")
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__plan_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__plan_setup
+ *
+ * Purpose:	Moves the file selection of a dataset I/O plan to OFFSET
+ *		and sets up the plan's datatype info for reads or writes,
+ *		the first time the plan is used in that direction.
+ *
+ * Return:	Success:	Pointer to the datatype info for the transfer
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5D_type_info_t *
+H5D__plan_setup(H5D_plan_t *plan, const hssize_t *offset, hbool_t do_write)
+{
+    H5D_t *dataset = plan->dset;        /* Dataset for plan */
+    unsigned dir = do_write ? 1 : 0;    /* Index of datatype info to use */
+    int rank;                           /* Rank of file dataspace */
+    const H5D_type_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* The plan's file dataspace must still match the dataset's extent */
+    if((rank = H5S_GET_EXTENT_NDIMS(plan->file_space)) != H5S_GET_EXTENT_NDIMS(dataset->shared->space))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, NULL, "dataset rank differs from the plan's file dataspace")
+    if(rank > 0) {
+        hsize_t plan_dims[H5S_MAX_RANK];    /* Dimensions of plan's file dataspace */
+        hsize_t dset_dims[H5S_MAX_RANK];    /* Current dimensions of dataset */
+
+        if(H5S_get_simple_extent_dims(plan->file_space, plan_dims, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, NULL, "can't get file dataspace dimensions")
+        if(H5S_get_simple_extent_dims(dataset->shared->space, dset_dims, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, NULL, "can't get dataset dimensions")
+        if(HDmemcmp(plan_dims, dset_dims, (size_t)rank * sizeof(hsize_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, NULL, "dataset extent has changed since the plan was created")
+    } /* end if */
+
+    /* Move the file selection */
+    if(rank > 0) {
+        hssize_t zero_offset[H5S_MAX_RANK];     /* Offset to use when none is given */
+
+        if(NULL == offset) {
+            HDmemset(zero_offset, 0, sizeof(zero_offset));
+            offset = zero_offset;
+        } /* end if */
+        if(H5S_select_offset(plan->file_space, offset) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, NULL, "can't set offset of file selection")
+    } /* end if */
+
+    /* Check for valid selection */
+    if(H5S_SELECT_VALID(plan->file_space) != TRUE)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, NULL, "file selection+offset not within extent")
+
+    /* Set up datatype info for this direction the first time it's used */
+    if(!plan->type_info_init[dir]) {
+        if(do_write) {
+            /* All filters in the DCPL must have encoding enabled. */
+            if(!dataset->shared->checked_filters) {
+                if(H5Z_can_apply(dataset->shared->dcpl_id, dataset->shared->type_id) < 0)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANAPPLY, NULL, "can't apply filters")
+
+                dataset->shared->checked_filters = TRUE;
+            } /* end if */
+
+            /* Check if we are allowed to write to this file */
+            if(0 == (H5F_INTENT(dataset->oloc.file) & H5F_ACC_RDWR))
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, NULL, "no write intent on file")
+        } /* end if */
+
+        if(H5D__typeinfo_init(dataset, plan->mem_type_id, do_write, &plan->type_info[dir]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "unable to set up type info")
+        plan->type_info_init[dir] = TRUE;
+    } /* end if */
+
+    /* Reset the chunk map for the transfer */
+    HDmemset(plan->fm, 0, sizeof(*plan->fm));
+
+    /* Set return value */
+    ret_value = &plan->type_info[dir];
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__plan_setup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__plan_read
+ *
+ * Purpose:	Reads the data described by a dataset I/O plan into BUF.
+ *		See H5Dplan_read() for details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__plan_read(H5D_plan_t *plan, const hssize_t *offset, void *buf/*out*/)
+{
+    const H5D_type_info_t *type_info;   /* Datatype info for operation */
+    char        fake_char;              /* Temporary variable for NULL buffer pointers */
+    herr_t	ret_value = SUCCEED;	/* Return value	*/
+
+    FUNC_ENTER_PACKAGE_TAG(plan->dset->oloc.addr)
+
+    /* Set up the plan for this transfer */
+    if(NULL == (type_info = H5D__plan_setup(plan, offset, FALSE)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up dataset I/O plan")
+
+    /* Check for a NULL buffer */
+    if(NULL == buf) {
+        /* Check for any elements selected (which is invalid) */
+        if(plan->nelmts > 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no output buffer")
+        buf = &fake_char;
+    } /* end if */
+    else
+        buf = (uint8_t *)buf + plan->mem_buf_off;
+
+    /* Perform the transfer */
+    if(H5D__read_io(plan->dset, type_info, plan->nelmts, plan->file_space, plan->mem_space, plan->fm, NULL, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
-} /* end H5D__write() */
+} /* end H5D__plan_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__plan_write
+ *
+ * Purpose:	Writes the data described by a dataset I/O plan from BUF.
+ *		See H5Dplan_write() for details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__plan_write(H5D_plan_t *plan, const hssize_t *offset, const void *buf)
+{
+    const H5D_type_info_t *type_info;   /* Datatype info for operation */
+    char        fake_char;              /* Temporary variable for NULL buffer pointers */
+    herr_t	ret_value = SUCCEED;	/* Return value	*/
+
+    FUNC_ENTER_PACKAGE_TAG(plan->dset->oloc.addr)
+
+    /* Set up the plan for this transfer */
+    if(NULL == (type_info = H5D__plan_setup(plan, offset, TRUE)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up dataset I/O plan")
+
+    /* Check for a NULL buffer */
+    if(NULL == buf) {
+        /* Check for any elements selected (which is invalid) */
+        if(plan->nelmts > 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no output buffer")
+        buf = &fake_char;
+    } /* end if */
+    else
+        buf = (const uint8_t *)buf + plan->mem_buf_off;
+
+    /* Perform the transfer */
+    if(H5D__write_io(plan->dset, type_info, plan->nelmts, plan->file_space, plan->mem_space, plan->fm, NULL, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__plan_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__plan_close
+ *
+ * Purpose:	Releases a dataset I/O plan and its reference to the
+ *		dataset.  Also used as the free callback for plan IDs.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__plan_close(H5D_plan_t *plan)
+{
+    unsigned u;                         /* Local index variable */
+    herr_t	ret_value = SUCCEED;	/* Return value	*/
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(plan);
+
+    /* Shut down datatype info */
+    for(u = 0; u < 2; u++)
+        if(plan->type_info_init[u] && H5D__typeinfo_term(&plan->type_info[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
+
+    if(plan->fm)
+        plan->fm = H5FL_FREE(H5D_chunk_map_t, plan->fm);
+    if(plan->mem_space && H5S_close(plan->mem_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release memory dataspace")
+    if(plan->file_space && H5S_close(plan->file_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release file dataspace")
+    if(plan->dxpl_id > 0 && plan->dxpl_id != H5P_DATASET_XFER_DEFAULT && H5I_dec_ref(plan->dxpl_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release transfer property list")
+    if(plan->mem_type_id > 0 && H5I_dec_ref(plan->mem_type_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release memory datatype")
+    if(plan->dset_id > 0 && H5I_dec_ref(plan->dset_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataset")
+
+    plan = H5FL_FREE(H5D_plan_t, plan);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__plan_close() */
 
 
 /*-------------------------------------------------------------------------
@@ -863,6 +2115,7 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info,
     /* Set up "normal" I/O fields */
     io_info->dset = dset;
     io_info->store = store;
+    io_info->vec = NULL;
 
     /* Set I/O operations to initial values */
     io_info->layout_ops = *dset->shared->layout.ops;
@@ -1044,11 +2297,13 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write,
          * supplied one through the xfer properties. Instead of allocating a
          * buffer which is the exact size, we allocate the target size.  The
          * malloc() is usually less resource-intensive if we allocate/free the
-         * same size over and over.
+         * same size over and over.  The buffer is aligned as the file driver
+         * prefers, so that data gathered from the file into it can skip any
+         * copy buffer in the driver.
          */
         if(NULL == (type_info->tconv_buf = (uint8_t *)tconv_buf)) {
             /* Allocate temporary buffer */
-            if(NULL == (type_info->tconv_buf = H5FL_BLK_MALLOC(type_conv, target_size)))
+            if(NULL == (type_info->tconv_buf = H5FL_BLK_MALLOC_ALIGNED(type_conv, target_size, H5F_MEM_ALIGN(dset->oloc.file))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
             type_info->tconv_buf_allocated = TRUE;
         } /* end if */
@@ -1240,7 +2495,7 @@ H5D__typeinfo_term(const H5D_type_info_t *type_info)
     /* Check for releasing datatype conversion & background buffers */
     if(type_info->tconv_buf_allocated) {
         HDassert(type_info->tconv_buf);
-        (void)H5FL_BLK_FREE(type_conv, type_info->tconv_buf);
+        (void)H5FL_BLK_FREE_ALIGNED(type_conv, type_info->tconv_buf);
     } /* end if */
     if(type_info->bkg_buf_allocated) {
         HDassert(type_info->bkg_buf);
@@ -49,12 +49,14 @@
     (io_info)->dset = ds;                                               \
     (io_info)->store = str;                                             \
     (io_info)->op_type = H5D_IO_OP_WRITE;                               \
-    (io_info)->u.wbuf = buf
+    (io_info)->u.wbuf = buf;                                            \
+    (io_info)->vec = NULL
 #define H5D_BUILD_IO_INFO_RD(io_info, ds, str, buf)                     \
     (io_info)->dset = ds;                                               \
     (io_info)->store = str;                                             \
     (io_info)->op_type = H5D_IO_OP_READ;                                \
-    (io_info)->u.rbuf = buf
+    (io_info)->u.rbuf = buf;                                            \
+    (io_info)->vec = NULL
 
 /* Flags for marking aspects of a dataset dirty */
 #define H5D_MARK_SPACE  0x01
@@ -202,6 +204,27 @@ typedef enum H5D_io_op_type_t {
     H5D_IO_OP_WRITE         /* Write operation */
 } H5D_io_op_type_t;
 
+/* Piece of raw data I/O deferred to a vector request */
+typedef struct H5D_io_vec_piece_t {
+    haddr_t addr;               /* File address of piece */
+    size_t len;                 /* Length of piece */
+    size_t idx;                 /* Order the piece was added in */
+    const struct H5D_shared_t *dset_shared; /* Shared info of dataset the piece is in */
+    union {
+        void *rbuf;             /* Pointer to buffer for read */
+        const void *wbuf;       /* Pointer to buffer to write */
+    } u;
+} H5D_io_vec_piece_t;
+
+/* Raw data I/O gathered across the datasets of a multi-dataset transfer */
+typedef struct H5D_io_vec_t {
+    H5D_io_op_type_t op_type;   /* Whether the pieces are read or written */
+    H5F_t *file;                /* File the gathered pieces are in */
+    size_t npieces;             /* # of pieces gathered */
+    size_t nalloc;              /* # of pieces allocated */
+    H5D_io_vec_piece_t *pieces; /* Array of pieces */
+} H5D_io_vec_t;
+
 typedef struct H5D_io_info_t {
     const H5D_t *dset;          /* Pointer to dataset being operated on */
 #ifdef H5_HAVE_PARALLEL
@@ -216,6 +239,7 @@ typedef struct H5D_io_info_t {
         void *rbuf;             /* Pointer to buffer for read */
         const void *wbuf;       /* Pointer to buffer to write */
     } u;
+    H5D_io_vec_t *vec;          /* Vector to defer contiguous raw data I/O to, or NULL */
 } H5D_io_info_t;
 
 
@@ -365,6 +389,21 @@ typedef struct H5D_chunk_map_t {
 #endif /* H5_HAVE_PARALLEL */
 } H5D_chunk_map_t;
 
+/* Prepared I/O plan for repeating a transfer with the same selections */
+typedef struct H5D_plan_t {
+    hid_t dset_id;              /* ID of dataset (plan holds a reference) */
+    H5D_t *dset;                /* Dataset to operate on */
+    hid_t mem_type_id;          /* ID of plan's copy of the memory datatype */
+    hid_t dxpl_id;              /* ID of plan's copy of the transfer property list */
+    H5S_t *mem_space;           /* Memory dataspace (projected to the file rank, if needed) */
+    H5S_t *file_space;          /* File dataspace, offset moved for each transfer */
+    hsize_t nelmts;             /* Number of elements selected in each dataspace */
+    size_t mem_buf_off;         /* Offset of projected memory selection in buffer */
+    hbool_t type_info_init[2];  /* Whether datatype info for reads/writes is set up */
+    H5D_type_info_t type_info[2];   /* Datatype info for reads ([0]) & writes ([1]) */
+    H5D_chunk_map_t *fm;        /* Chunk map, reused for each transfer */
+} H5D_plan_t;
+
 /* Cached information about a particular chunk */
 typedef struct H5D_chunk_cached_t {
     hbool_t     valid;                          /*whether cache info is valid*/
@@ -387,6 +426,14 @@ typedef struct H5D_virtual_held_file_t {
 
 /* The raw data chunk cache */
 struct H5D_rdcc_ent_t;  /* Forward declaration of struct used below */
+/* File space reserved for the new chunks of a dataset */
+typedef struct H5D_chunk_reserve_t {
+    hsize_t     max_size;       /* Largest run to reserve at once (0 when disabled) */
+    hsize_t     next_size;      /* Size of the next run to reserve */
+    haddr_t     addr;           /* Address of the unused part of the current run */
+    hsize_t     size;           /* Size of the unused part of the current run */
+} H5D_chunk_reserve_t;
+
 typedef struct H5D_rdcc_t {
     struct {
         unsigned    ninits;    /* Number of chunk creations        */
@@ -407,6 +454,7 @@ typedef struct H5D_rdcc_t {
     H5SL_t        *sel_chunks;    /* Skip list containing information for each chunk selected */
     H5S_t         *single_space;  /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t    *single_chunk_info;  /* Pointer to single chunk's info */
+    H5D_chunk_reserve_t reserve;    /* File space reserved for new chunks */
 
     /* Cached information about scaled dataspace dimensions */
     hsize_t             scaled_dims[H5S_MAX_RANK];          /* The scaled dim sizes */
@@ -589,6 +637,20 @@ H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, void *buf/*out*/);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, const void *buf);
+H5_DLL herr_t H5D__read_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[],
+    const H5S_t *mem_space[], const H5S_t *file_space[], void *buf[]/*out*/);
+H5_DLL herr_t H5D__write_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[],
+    const H5S_t *mem_space[], const H5S_t *file_space[], const void *buf[]);
+H5_DLL herr_t H5D__io_vec_add(const H5D_io_info_t *io_info, haddr_t addr,
+    size_t len, hsize_t buf_off);
+H5_DLL herr_t H5D__io_vec_flush(H5D_io_vec_t *vec);
+H5_DLL H5D_plan_t *H5D__plan_create(hid_t dset_id, hid_t mem_type_id,
+    const H5S_t *mem_space, const H5S_t *file_space, hid_t dxpl_id);
+H5_DLL herr_t H5D__plan_read(H5D_plan_t *plan, const hssize_t *offset,
+    void *buf/*out*/);
+H5_DLL herr_t H5D__plan_write(H5D_plan_t *plan, const hssize_t *offset,
+    const void *buf);
+H5_DLL herr_t H5D__plan_close(H5D_plan_t *plan);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info,
@@ -637,6 +699,7 @@ H5_DLL herr_t H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage
     H5F_t *f_dst, H5O_storage_contig_t *storage_dst, H5T_t *src_dtype,
     H5O_copy_t *cpy_info);
 H5_DLL herr_t H5D__contig_delete(H5F_t *f, const H5O_storage_t *store);
+H5_DLL herr_t H5D__contig_vec_sieve(const H5D_t *dset, hbool_t discard);
 
 /* Functions that operate on chunked dataset storage */
 H5_DLL htri_t H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr,
@@ -649,7 +712,8 @@ H5_DLL herr_t H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
 H5_DLL herr_t H5D__chunk_allocated(const H5D_t *dset, hsize_t *nbytes);
 H5_DLL herr_t H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_t old_dim[]);
 H5_DLL herr_t H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
-    H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[]);
+    H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[],
+    H5D_chunk_reserve_t *reserve);
 H5_DLL herr_t H5D__chunk_update_old_edge_chunks(H5D_t *dset, hsize_t old_dim[]);
 H5_DLL herr_t H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim);
 H5_DLL herr_t H5D__chunk_set_sizes(H5D_t *dset);
@@ -760,6 +824,7 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__chunk_addr_test(hid_t did, const hsize_t *offset, haddr_t *addr);
 #endif /* H5D_TESTING */
 
 #endif /*_H5Dpkg_H*/
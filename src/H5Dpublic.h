@@ -157,6 +157,19 @@ H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+    void *buf[]/*out*/);
+H5_DLL herr_t H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+    const void *buf[]);
+H5_DLL hid_t H5Dplan_create(hid_t dset_id, hid_t mem_type_id,
+    hid_t mem_space_id, hid_t file_space_id, hid_t plist_id);
+H5_DLL herr_t H5Dplan_read(hid_t plan_id, const hssize_t *offset,
+    void *buf/*out*/);
+H5_DLL herr_t H5Dplan_write(hid_t plan_id, const hssize_t *offset,
+    const void *buf);
+H5_DLL herr_t H5Dplan_close(hid_t plan_id);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
@@ -32,17 +32,28 @@
 #include "H5Dpkg.h"		/* Datasets				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5MMprivate.h"	/* Memory management			*/
 
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Max. # of elements of a point selection sorted together */
+#define H5D_SELECT_SORT_NELMTS  (16 * 1024)
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Element of a selection, for sorting the elements by their file offset */
+typedef struct H5D_select_elmt_t {
+    hsize_t file_off;           /* Offset of element in the file */
+    hsize_t mem_off;            /* Offset of element in memory */
+    size_t idx;                 /* Position of element in the selections */
+} H5D_select_elmt_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -50,6 +61,11 @@
 
 static herr_t H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
     size_t nelmts, const H5S_t *file_space, const H5S_t *mem_space);
+static int H5D__select_elmt_cmp(const void *_elmt1, const void *_elmt2);
+static herr_t H5D__select_io_sorted(const H5D_io_info_t *io_info,
+    size_t elmt_size, size_t nelmts, const H5S_t *file_space,
+    H5S_sel_iter_t *file_iter, const H5S_t *mem_space, H5S_sel_iter_t *mem_iter,
+    size_t vec_size, hsize_t *vec_off, size_t *vec_len);
 
 
 /*********************/
@@ -184,6 +200,18 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
         mem_iter_init = 1;	/* Memory selection iteration info has been initialized */
 
+        /* Points selected out of order in the file are sorted first, so
+         * that the file is accessed in order and neighboring points are
+         * accessed together.
+         */
+        if(H5S_GET_SELECT_TYPE(file_space) == H5S_SEL_POINTS
+                && !H5S_point_is_sorted(file_space)) {
+            if(H5D__select_io_sorted(io_info, elmt_size, nelmts, file_space,
+                    file_iter, mem_space, mem_iter, vec_size, file_off, file_len) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "sorted I/O failed")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
         /* Initialize sequence counts */
         curr_mem_seq = curr_file_seq = 0;
         mem_nseq = file_nseq = 0;
@@ -192,8 +220,11 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
         while(nelmts > 0) {
             /* Check if more file sequences are needed */
             if(curr_file_seq >= file_nseq) {
-                /* Get sequences for file selection */
-                if(H5S_SELECT_GET_SEQ_LIST(file_space, H5S_GET_SEQ_LIST_SORTED, file_iter, vec_size, nelmts, &file_nseq, &file_nelem, file_off, file_len) < 0)
+                /* Get sequences for file selection.  These don't need to be
+                 * in order: the contiguous layout's sieve buffer sorts them
+                 * itself, and the other layouts don't depend on the order.
+                 */
+                if(H5S_SELECT_GET_SEQ_LIST(file_space, 0, file_iter, vec_size, nelmts, &file_nseq, &file_nelem, file_off, file_len) < 0)
                     HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
 
                 /* Start at the beginning of the sequences again */
@@ -255,6 +286,204 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__select_io() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__select_elmt_cmp
+ *
+ * Purpose:	Compare two selection elements by their file offset, for
+ *              HDqsort().  Elements at the same offset stay in the order
+ *              they were selected in.
+ *
+ * Return:	<0, 0 or >0, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__select_elmt_cmp(const void *_elmt1, const void *_elmt2)
+{
+    const H5D_select_elmt_t *elmt1 = (const H5D_select_elmt_t *)_elmt1;
+    const H5D_select_elmt_t *elmt2 = (const H5D_select_elmt_t *)_elmt2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(elmt1->file_off < elmt2->file_off)
+        ret_value = -1;
+    else if(elmt1->file_off > elmt2->file_off)
+        ret_value = 1;
+    else if(elmt1->idx < elmt2->idx)
+        ret_value = -1;
+    else if(elmt1->idx > elmt2->idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__select_elmt_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__select_io_sorted
+ *
+ * Purpose:	Perform I/O directly from application memory and a file,
+ *              accessing the file in order.
+ *
+ *              The selections are processed in batches of up to
+ *              H5D_SELECT_SORT_NELMTS elements, to bound the memory used.
+ *              The offsets of the elements of a batch in both selections
+ *              are gathered and sorted by their offset in the file,
+ *              keeping the file and memory offsets of each element
+ *              together so that the data still ends up at the right place
+ *              in memory.  Elements next to each other in the file are
+ *              then combined into a single file sequence.  On writes,
+ *              only the last of several elements of a batch at the same
+ *              place in the file is written, as it would have overwritten
+ *              the others; batches are written in order, so later batches
+ *              overwrite earlier ones.
+ *
+ *              The iterators must be initialized and at the start of the
+ *              selections.  VEC_OFF and VEC_LEN are scratch space for
+ *              VEC_SIZE sequences.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__select_io_sorted(const H5D_io_info_t *io_info, size_t elmt_size,
+    size_t nelmts, const H5S_t *file_space, H5S_sel_iter_t *file_iter,
+    const H5S_t *mem_space, H5S_sel_iter_t *mem_iter, size_t vec_size,
+    hsize_t *vec_off, size_t *vec_len)
+{
+    H5D_select_elmt_t *elmts = NULL;    /* Offsets of selected elements */
+    hsize_t *mem_off = NULL;    /* Pointer to sequence offsets in memory */
+    hsize_t *file_off = NULL;   /* Pointer to sequence offsets in the file */
+    size_t *mem_len = NULL;     /* Pointer to sequence lengths in memory */
+    size_t *file_len = NULL;    /* Pointer to sequence lengths in the file */
+    size_t curr_mem_seq;        /* Current memory sequence to operate on */
+    size_t curr_file_seq;       /* Current file sequence to operate on */
+    size_t mem_nseq = 0;        /* Number of sequences generated in memory */
+    size_t file_nseq = 0;       /* Number of sequences generated in the file */
+    size_t nseq;                /* Number of sequences from selection */
+    size_t nelem;               /* Number of elements in sequences from selection */
+    size_t batch_nelmts;        /* Number of elements in the current batch */
+    size_t max_nelmts;          /* Max. number of elements in a batch */
+    size_t u, v;                /* Local index variables */
+    size_t w;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(io_info);
+    HDassert(nelmts > 0);
+    HDassert(file_iter);
+    HDassert(mem_iter);
+    HDassert(vec_off);
+    HDassert(vec_len);
+
+    /* Allocate space for the element & sequence information */
+    max_nelmts = MIN(nelmts, H5D_SELECT_SORT_NELMTS);
+    if(NULL == (elmts = (H5D_select_elmt_t *)H5MM_malloc(max_nelmts * sizeof(H5D_select_elmt_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate selection element array")
+    if(NULL == (mem_len = H5FL_SEQ_MALLOC(size_t, max_nelmts)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O length vector array")
+    if(NULL == (mem_off = H5FL_SEQ_MALLOC(hsize_t, max_nelmts)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O offset vector array")
+    if(NULL == (file_len = H5FL_SEQ_MALLOC(size_t, max_nelmts)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O length vector array")
+    if(NULL == (file_off = H5FL_SEQ_MALLOC(hsize_t, max_nelmts)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O offset vector array")
+
+    /* Loop, until all elements are processed */
+    while(nelmts > 0) {
+        batch_nelmts = MIN(nelmts, max_nelmts);
+
+        /* Get the offset of each element of the batch in the file */
+        for(u = 0; u < batch_nelmts; ) {
+            if(H5S_SELECT_GET_SEQ_LIST(file_space, 0, file_iter, vec_size, batch_nelmts - u, &nseq, &nelem, vec_off, vec_len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            HDassert(nelem > 0);
+            for(v = 0; v < nseq; v++)
+                for(w = 0; w < vec_len[v]; w += elmt_size, u++) {
+                    elmts[u].file_off = vec_off[v] + w;
+                    elmts[u].idx = u;
+                } /* end for */
+        } /* end for */
+
+        /* Get the offset of each element of the batch in memory */
+        for(u = 0; u < batch_nelmts; ) {
+            if(H5S_SELECT_GET_SEQ_LIST(mem_space, 0, mem_iter, vec_size, batch_nelmts - u, &nseq, &nelem, vec_off, vec_len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            HDassert(nelem > 0);
+            for(v = 0; v < nseq; v++)
+                for(w = 0; w < vec_len[v]; w += elmt_size, u++)
+                    elmts[u].mem_off = vec_off[v] + w;
+        } /* end for */
+
+        /* Sort the elements by their offset in the file */
+        HDqsort(elmts, batch_nelmts, sizeof(H5D_select_elmt_t), H5D__select_elmt_cmp);
+
+        /* Build the sequences, combining elements which are next to each other */
+        mem_nseq = file_nseq = 0;
+        for(u = 0; u < batch_nelmts; u++) {
+            /* Skip elements which are overwritten by later ones */
+            if(io_info->op_type == H5D_IO_OP_WRITE && (u + 1) < batch_nelmts
+                    && elmts[u].file_off == elmts[u + 1].file_off)
+                continue;
+
+            if(file_nseq > 0 && (file_off[file_nseq - 1] + file_len[file_nseq - 1]) == elmts[u].file_off)
+                file_len[file_nseq - 1] += elmt_size;
+            else {
+                file_off[file_nseq] = elmts[u].file_off;
+                file_len[file_nseq] = elmt_size;
+                file_nseq++;
+            } /* end else */
+
+            if(mem_nseq > 0 && (mem_off[mem_nseq - 1] + mem_len[mem_nseq - 1]) == elmts[u].mem_off)
+                mem_len[mem_nseq - 1] += elmt_size;
+            else {
+                mem_off[mem_nseq] = elmts[u].mem_off;
+                mem_len[mem_nseq] = elmt_size;
+                mem_nseq++;
+            } /* end else */
+        } /* end for */
+
+        /* Perform I/O on memory and file sequences */
+        curr_mem_seq = curr_file_seq = 0;
+        while(curr_file_seq < file_nseq) {
+            if(io_info->op_type == H5D_IO_OP_READ) {
+                if((*io_info->layout_ops.readvv)(io_info,
+                        file_nseq, &curr_file_seq, file_len, file_off,
+                        mem_nseq, &curr_mem_seq, mem_len, mem_off) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_READERROR, FAIL, "read error")
+            } /* end if */
+            else {
+                HDassert(io_info->op_type == H5D_IO_OP_WRITE);
+                if((*io_info->layout_ops.writevv)(io_info,
+                        file_nseq, &curr_file_seq, file_len, file_off,
+                        mem_nseq, &curr_mem_seq, mem_len, mem_off) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_WRITEERROR, FAIL, "write error")
+            } /* end else */
+        } /* end while */
+
+        nelmts -= batch_nelmts;
+    } /* end while */
+
+done:
+    /* Release arrays, if allocated */
+    if(elmts)
+        elmts = (H5D_select_elmt_t *)H5MM_xfree(elmts);
+    if(file_len)
+        file_len = H5FL_SEQ_FREE(size_t, file_len);
+    if(file_off)
+        file_off = H5FL_SEQ_FREE(hsize_t, file_off);
+    if(mem_len)
+        mem_len = H5FL_SEQ_FREE(size_t, mem_len);
+    if(mem_off)
+        mem_off = H5FL_SEQ_FREE(hsize_t, mem_off);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__select_io_sorted() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__select_read
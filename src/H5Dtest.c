@@ -29,6 +29,7 @@
 /* Headers */
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
+#include "H5CXprivate.h"        /* API Contexts                         */
 #include "H5Dpkg.h"		/* Datasets 				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Iprivate.h"		/* IDs			  		*/
@@ -308,3 +309,74 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5D__current_cache_size_test() */
 
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__chunk_addr_test
+ PURPOSE
+    Get the file address of a chunk in a chunked dataset
+ USAGE
+    herr_t H5D__chunk_addr_test(did, offset, addr)
+        hid_t did;              IN: Dataset to query
+        const hsize_t *offset;  IN: Logical offset of the chunk in the dataset
+        haddr_t *addr;          OUT: Pointer to location to place address
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Looks up the chunk containing OFFSET in the dataset's chunk index and
+    returns its address, or HADDR_UNDEF if the chunk isn't allocated.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__chunk_addr_test(hid_t did, const hsize_t *offset, haddr_t *addr)
+{
+    H5D_t	*dset;          /* Pointer to dataset to query */
+    H5D_chunk_ud_t udata;       /* Chunk lookup information */
+    hsize_t     scaled[H5O_LAYOUT_NDIMS];   /* Scaled coordinates of chunk */
+    haddr_t     prev_tag = HADDR_UNDEF; /* Previous metadata tag */
+    hbool_t     api_ctx_pushed = FALSE; /* Whether API context pushed */
+    unsigned    u;              /* Local index variable */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    HDassert(offset);
+    HDassert(addr);
+
+    /* Compute the scaled coordinates of the chunk */
+    for(u = 0; u < dset->shared->ndims; u++)
+        scaled[u] = offset[u] / dset->shared->layout.u.chunk.dim[u];
+    scaled[dset->shared->ndims] = 0;
+
+    /* Push API context */
+    if(H5CX_push() < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set API context")
+    api_ctx_pushed = TRUE;
+
+    /* Set up metadata tagging */
+    H5AC_tag(dset->oloc.addr, &prev_tag);
+
+    /* Look up the chunk */
+    if(H5D__chunk_lookup(dset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+    *addr = udata.chunk_block.offset;
+
+    /* Reset metadata tagging */
+    H5AC_tag(prev_tag, NULL);
+
+done:
+    if(api_ctx_pushed && H5CX_pop() < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't reset API context")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5D__chunk_addr_test() */
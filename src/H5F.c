@@ -599,6 +599,7 @@ H5Fflush(hid_t object_id, H5F_scope_t scope)
         case H5I_ERROR_CLASS:
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
+        case H5I_DATASET_PLAN:
         case H5I_NTYPES:
         default:
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
@@ -1014,6 +1015,51 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_mdc_type_stats
+ *
+ * Purpose:     Retrieves per entry type statistics (hits, misses,
+ *        evictions, bytes read and written, deserialization time, and
+ *        current residency) from the metadata cache associated with
+ *        the specified file.  The statistics for up to NSTATS entry
+ *        types are copied into the array STATS.  If STATS is NULL,
+ *        only the number of entry types is returned.
+ *
+ *        Unlike the hit rate statistics, these statistics are not
+ *        reset by the automatic cache resize code.
+ *
+ * Return:      Success:        non-negative, the number of entry types
+ *              Failure:        negative
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5Fget_mdc_type_stats(hid_t file_id, size_t nstats,
+    H5AC_cache_type_stats_t *stats/*out*/)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    size_t     ntypes = 0;              /* Number of entry types */
+    ssize_t    ret_value = -1;          /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("Zs", "izx", file_id, nstats, stats);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(stats && nstats == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nstats must be > 0")
+
+    /* Go get the per type statistics */
+    if(H5AC_get_cache_type_stats(file->shared->cache, stats ? nstats : 0, stats, &ntypes) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5AC_get_cache_type_stats() failed.")
+
+    ret_value = (ssize_t)ntypes;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_mdc_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_size
@@ -1592,6 +1638,98 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_page_buffering_stats() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fprefetch_pages
+ *
+ * Purpose:     Loads the pages holding the NADDRS file addresses in
+ *              ADDRS into the page buffer, with as few vector reads as
+ *              possible, so a later access to them hits in the page
+ *              buffer.  TYPE is the type of the data at the addresses.
+ *
+ *              This is a hint: pages that are already buffered, or that
+ *              don't fit without writing out dirty pages, are skipped.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fprefetch_pages(hid_t file_id, H5F_mem_t type, size_t naddrs, const haddr_t addrs[])
+{
+    H5F_t      *file;                   /* File object for file ID */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iFmz*a", file_id, type, naddrs, addrs);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == file->shared->page_buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "page buffering not enabled on file")
+    if(type < H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory type")
+    if(naddrs > 0 && NULL == addrs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL address list")
+
+    /* Load the pages */
+    if(H5PB_prefetch(file, (H5FD_mem_t)type, naddrs, addrs) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_READERROR, FAIL, "can't prefetch pages")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fprefetch_pages() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fset_page_buffer_size
+ *
+ * Purpose:     Changes the page buffer of an open file, with the same
+ *              arguments as H5Pset_page_buffer_size().
+ *
+ *              Shrinking the page buffer evicts its least recently used
+ *              pages, writing them out if they are dirty.  A size of
+ *              zero flushes and disables page buffering.  A file opened
+ *              without page buffering gets a new, empty page buffer,
+ *              provided it uses the paged file space strategy.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fset_page_buffer_size(hid_t file_id, size_t buf_size, unsigned min_meta_perc,
+    unsigned min_raw_perc)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "izIuIu", file_id, buf_size, min_meta_perc, min_raw_perc);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(min_meta_perc > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Minimum metadata fractions must be between 0 and 100 inclusive")
+    if(min_raw_perc > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Minimum rawdata fractions must be between 0 and 100 inclusive")
+    if(min_meta_perc + min_raw_perc > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Sum of minimum metadata and raw data fractions can't be bigger than 100")
+
+    /* Set up collective metadata if appropriate */
+    if(H5CX_set_loc(file_id) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't set collective metadata read info")
+
+    /* Call the internal routine */
+    if(H5F__set_page_buffer_size(file, buf_size, min_meta_perc, min_raw_perc) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set page buffer size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fset_page_buffer_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_image_info
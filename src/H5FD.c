@@ -505,7 +505,8 @@ H5FD_sb_load(H5FD_t *file, const char *name, const uint8_t *buf)
     /* Check if driver matches driver information saved. Unfortunately, we can't push this
      * function to each specific driver because we're checking if the driver is correct.
      */
-    if(!HDstrncmp(name, "NCSAfami", (size_t)8) && HDstrcmp(file->cls->name, "family"))
+    if((!HDstrncmp(name, "NCSAfami", (size_t)8) || !HDstrncmp(name, "NCSAfams", (size_t)8))
+            && HDstrcmp(file->cls->name, "family"))
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "family driver should be used")
     if(!HDstrncmp(name, "NCSAmult", (size_t)8) && HDstrcmp(file->cls->name, "multi"))
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "multi driver should be used")
@@ -1444,6 +1445,138 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDread_vector
+ *
+ * Purpose:	Reads COUNT pieces from FILE according to the data transfer
+ *		property list DXPL_ID (which may be the constant
+ *		H5P_DEFAULT).  Piece I is SIZES[I] bytes of memory type
+ *		TYPES[I] at address ADDRS[I] and is stored in BUFS[I].
+ *
+ *		Drivers that provide a read_vector callback receive the
+ *		whole vector in one call, other drivers see one read call
+ *		per piece.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/)
+{
+    haddr_t    *rel_addrs = NULL;       /* Addresses relative to the base address */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xiIu*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes,
+             bufs);
+
+    /* Check args */
+    if(!file || !file->cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file pointer")
+    if(count > 0 && (!types || !addrs || !sizes || !bufs))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null vector")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null result buffer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if(file->base_addr > 0 && count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address vector")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* Do the real work */
+    if(H5FD_read_vector(file, count, types, rel_addrs ? rel_addrs : addrs, sizes, bufs) < 0)
+	HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDwrite_vector
+ *
+ * Purpose:	Writes COUNT pieces to FILE according to the data transfer
+ *		property list DXPL_ID (which may be the constant
+ *		H5P_DEFAULT).  Piece I is SIZES[I] bytes of memory type
+ *		TYPES[I] from BUFS[I], written at address ADDRS[I].
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    haddr_t    *rel_addrs = NULL;       /* Addresses relative to the base address */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xiIu*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes,
+             bufs);
+
+    /* Check args */
+    if(!file || !file->cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file pointer")
+    if(count > 0 && (!types || !addrs || !sizes || !bufs))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null vector")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null buffer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if(file->base_addr > 0 && count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address vector")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* The real work */
+    if(H5FD_write_vector(file, count, types, rel_addrs ? rel_addrs : addrs, sizes, bufs) < 0)
+	HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file vector write request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FDflush
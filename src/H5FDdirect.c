@@ -171,7 +171,9 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD_direct_truncate,      	/*truncate    */
     H5FD_direct_lock,          	/*lock                  */
     H5FD_direct_unlock,        	/*unlock                */
-    H5FD_FLMAP_DICHOTOMY       	/*fl_map                */
+    H5FD_FLMAP_DICHOTOMY,       /*fl_map                */
+    NULL,                       /*read_vector           */
+    NULL                        /*write_vector          */
 };
 
 /* Declare a free list to manage the H5FD_direct_t struct */
@@ -565,6 +567,10 @@ H5FD_direct_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxadd
     if(buf2)
         HDfree(buf2);
 
+    /* Let the library know which buffers can skip the copy buffer */
+    if(file->fa.must_align)
+        file->pub.mem_align = file->fa.mboundary;
+
     /* Set return value */
     ret_value=(H5FD_t*)file;
 
@@ -853,7 +859,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+H5FD_direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
          size_t size, void *buf/*out*/)
 {
     H5FD_direct_t  *file = (H5FD_direct_t*)_file;
@@ -892,6 +898,29 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     _fbsize = file->fa.fbsize;
     _cbsize = file->fa.cbsize;
 
+    /* If only the ends of the request are misaligned and the part of the
+     * buffer that lines up with the first whole file block is aligned in
+     * memory, read the whole blocks straight into the buffer and only go
+     * through the copy buffer for the partial blocks at either end.
+     */
+    if(_must_align && !((addr%_fbsize==0) && (size%_fbsize==0) && ((size_t)buf%_boundary==0))) {
+        size_t head = (size_t)((_fbsize - addr % _fbsize) % _fbsize);  /* Bytes before the first whole block */
+
+        if(size >= head + _fbsize && (((size_t)buf + head) % _boundary) == 0) {
+            size_t mid = ((size - head) / _fbsize) * _fbsize;           /* Bytes in whole blocks */
+            size_t tail = size - (head + mid);                          /* Bytes after the last whole block */
+
+            if(head > 0 && H5FD_direct_read(_file, type, dxpl_id, addr, head, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read start of request")
+            if(H5FD_direct_read(_file, type, dxpl_id, addr + head, mid, (unsigned char *)buf + head) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read aligned blocks")
+            if(tail > 0 && H5FD_direct_read(_file, type, dxpl_id, addr + head + mid, tail, (unsigned char *)buf + head + mid) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read end of request")
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
     /* if the data is aligned or the system doesn't require data to be aligned,
      * read it directly from the file.  If not, read a bigger
      * and aligned data first, then copy the data into memory buffer.
@@ -1038,7 +1067,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+H5FD_direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     size_t size, const void *buf)
 {
     H5FD_direct_t  *file = (H5FD_direct_t*)_file;
@@ -1080,6 +1109,27 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     _fbsize = file->fa.fbsize;
     _cbsize = file->fa.cbsize;
 
+    /* As for reads, write whole blocks straight from an aligned buffer and
+     * only read-modify-write the partial blocks at either end.
+     */
+    if(_must_align && !((addr%_fbsize==0) && (size%_fbsize==0) && ((size_t)buf%_boundary==0))) {
+        size_t head = (size_t)((_fbsize - addr % _fbsize) % _fbsize);  /* Bytes before the first whole block */
+
+        if(size >= head + _fbsize && (((size_t)buf + head) % _boundary) == 0) {
+            size_t mid = ((size - head) / _fbsize) * _fbsize;           /* Bytes in whole blocks */
+            size_t tail = size - (head + mid);                          /* Bytes after the last whole block */
+
+            if(head > 0 && H5FD_direct_write(_file, type, dxpl_id, addr, head, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write start of request")
+            if(H5FD_direct_write(_file, type, dxpl_id, addr + head, mid, (const unsigned char *)buf + head) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write aligned blocks")
+            if(tail > 0 && H5FD_direct_write(_file, type, dxpl_id, addr + head + mid, tail, (const unsigned char *)buf + head + mid) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write end of request")
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
     /* if the data is aligned or the system doesn't require data to be aligned,
      * write it directly to the file.  If not, read a bigger and aligned data
      * first, update buffer with user data, then write the data out.
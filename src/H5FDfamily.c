@@ -30,6 +30,12 @@
  *		can be quite time consuming on file systems that don't
  *		implement holes, like nfs).
  *
+ *		Alternatively the family can be striped: the address space
+ *		is dealt out round-robin to a fixed number of members in
+ *		units of the stripe size, RAID-0 style, so that a large
+ *		request is spread over all the members (which may live on
+ *		different disks) instead of landing on one of them.
+ *
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -63,6 +69,8 @@ typedef struct H5FD_family_t {
     haddr_t	eoa;		/*end of allocated addresses		*/
     char	*name;		/*name generator printf format		*/
     unsigned	flags;		/*flags for opening additional members	*/
+    hsize_t	stripe_size;	/*bytes per stripe, if striped		*/
+    unsigned	stripe_count;	/*number of members striped over, or 0	*/
 
     /* Information from properties set by 'h5repart' tool */
     hsize_t	mem_newsize;	/*new member size passed in as private
@@ -76,6 +84,8 @@ typedef struct H5FD_family_t {
 typedef struct H5FD_family_fapl_t {
     hsize_t	memb_size;	/*size of each member			*/
     hid_t	memb_fapl_id;	/*file access property list of each memb*/
+    hsize_t	stripe_size;	/*bytes per stripe			*/
+    unsigned	stripe_count;	/*members to stripe over, 0 if not	*/
 } H5FD_family_fapl_t;
 
 /* Callback prototypes */
@@ -139,7 +149,9 @@ static const H5FD_class_t H5FD_family_g = {
     H5FD_family_truncate,			/*truncate		*/
     H5FD_family_lock,                           /*lock                  */
     H5FD_family_unlock,                         /*unlock                */
-    H5FD_FLMAP_DICHOTOMY                        /*fl_map                */
+    H5FD_FLMAP_DICHOTOMY,                       /*fl_map                */
+    NULL,                                       /*read_vector           */
+    NULL                                        /*write_vector          */
 };
 
 
@@ -258,7 +270,7 @@ herr_t
 H5Pset_fapl_family(hid_t fapl_id, hsize_t msize, hid_t memb_fapl_id)
 {
     herr_t ret_value;
-    H5FD_family_fapl_t	fa={0, -1};
+    H5FD_family_fapl_t	fa={0, -1, 0, 0};
     H5P_genplist_t *plist;      /* Property list pointer */
 
     FUNC_ENTER_API(FAIL)
@@ -336,6 +348,101 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_family_stripe
+ *
+ * Purpose:	Stripes the family of files set up on FAPL_ID by
+ *		H5Pset_fapl_family() across STRIPE_COUNT members.
+ *		Consecutive STRIPE_SIZE byte pieces of the address space go
+ *		to consecutive members, wrapping around after the last one,
+ *		and the member size given to H5Pset_fapl_family() no longer
+ *		limits how large a member may grow.
+ *
+ *		A STRIPE_COUNT of zero turns striping off again.  The
+ *		layout is recorded in the file and the same layout must be
+ *		used to open it again.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_family_stripe(hid_t fapl_id, hsize_t stripe_size, unsigned stripe_count)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_family_fapl_t *old_fa;
+    H5FD_family_fapl_t fa;
+    herr_t      ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ihIu", fapl_id, stripe_size, stripe_count);
+
+    /* Check arguments */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_FAMILY != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (old_fa = (const H5FD_family_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(stripe_count > 0 && 0 == stripe_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe size must be positive")
+    if(stripe_count > 0 && stripe_size > HSIZET_MAX / stripe_count)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe size too large")
+
+    /* Update the driver specific information */
+    fa = *old_fa;
+    fa.stripe_size = stripe_count > 0 ? stripe_size : 0;
+    fa.stripe_count = stripe_count;
+
+    ret_value = H5P_set_driver(plist, H5FD_FAMILY, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_family_stripe() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_family_stripe
+ *
+ * Purpose:	Returns the stripe layout set with
+ *		H5Pset_fapl_family_stripe().  A STRIPE_COUNT of zero means
+ *		the family is not striped.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_family_stripe(hid_t fapl_id, hsize_t *stripe_size/*out*/,
+    unsigned *stripe_count/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_family_fapl_t	*fa;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, stripe_size, stripe_count);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_FAMILY != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_family_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(stripe_size)
+        *stripe_size = fa->stripe_size;
+    if(stripe_count)
+        *stripe_count = fa->stripe_count;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_family_stripe() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_family_fapl_get
@@ -368,6 +475,8 @@ H5FD_family_fapl_get(H5FD_t *_file)
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
     fa->memb_size = file->memb_size;
+    fa->stripe_size = file->stripe_size;
+    fa->stripe_count = file->stripe_count;
     if(NULL == (plist = (H5P_genplist_t *)H5I_object(file->memb_fapl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
     fa->memb_fapl_id = H5P_copy_plist(plist, FALSE);
@@ -490,13 +599,20 @@ done:
  *-------------------------------------------------------------------------
  */
 static hsize_t
-H5FD_family_sb_size(H5FD_t H5_ATTR_UNUSED *_file)
+H5FD_family_sb_size(H5FD_t *_file)
 {
+    const H5FD_family_t	*file = (const H5FD_family_t*)_file;
+    hsize_t ret_value = 8;      /* Return value */
+
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     /* 8 bytes field for the size of member file size field should be
-     * enough for now. */
-    FUNC_LEAVE_NOAPI(8)
+     * enough for now.  Striped families add the 8 byte stripe size and
+     * the 4 byte stripe count. */
+    if(file->stripe_count > 0)
+        ret_value += 8 + 4;
+
+    FUNC_LEAVE_NOAPI(ret_value)
 }
 
 
@@ -527,8 +643,9 @@ H5FD_family_sb_encode(H5FD_t *_file, char *name/*out*/, unsigned char *buf/*out*
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
-    /* Name and version number */
-    HDstrncpy(name, "NCSAfami", (size_t)9);
+    /* Name and version number.  Striped families use a different name,
+     * so that older libraries refuse them instead of misreading them. */
+    HDstrncpy(name, file->stripe_count > 0 ? "NCSAfams" : "NCSAfami", (size_t)9);
     name[8] = '\0';
 
     /* Store member file size.  Use the member file size from the property here.
@@ -541,6 +658,12 @@ H5FD_family_sb_encode(H5FD_t *_file, char *name/*out*/, unsigned char *buf/*out*
      */
     UINT64ENCODE(buf, (uint64_t)file->pmem_size);
 
+    /* Store the stripe layout */
+    if(file->stripe_count > 0) {
+        UINT64ENCODE(buf, (uint64_t)file->stripe_size);
+        UINT32ENCODE(buf, file->stripe_count);
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5FD_family_sb_encode() */
 
@@ -564,10 +687,12 @@ H5FD_family_sb_encode(H5FD_t *_file, char *name/*out*/, unsigned char *buf/*out*
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_family_sb_decode(H5FD_t *_file, const char H5_ATTR_UNUSED *name, const unsigned char *buf)
+H5FD_family_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf)
 {
     H5FD_family_t	*file = (H5FD_family_t*)_file;
     uint64_t            msize;
+    uint64_t            stripe_size = 0;
+    unsigned            stripe_count = 0;
     herr_t ret_value = SUCCEED;   /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -575,6 +700,21 @@ H5FD_family_sb_decode(H5FD_t *_file, const char H5_ATTR_UNUSED *name, const unsi
     /* Read member file size. Skip name template for now although it's saved. */
     UINT64DECODE(buf, msize);
 
+    /* Read the stripe layout of a striped family */
+    if(!HDstrncmp(name, "NCSAfams", (size_t)8)) {
+        UINT64DECODE(buf, stripe_size);
+        UINT32DECODE(buf, stripe_count);
+    } /* end if */
+
+    /* Check if the stripe layout from file access property is correct.
+     * (Unlike the member size, the layout can't be picked up from the
+     * file, since the superblock was located using the layout from the
+     * property.) */
+    if(stripe_count != file->stripe_count || (stripe_count > 0 && stripe_size != file->stripe_size))
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "Family stripe layout should be %u stripes of %lu bytes.  But the layout from file access property is %u stripes of %lu bytes", stripe_count, (unsigned long)stripe_size, file->stripe_count, (unsigned long)file->stripe_size)
+    if(stripe_count > 0 && file->mem_newsize)
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "can't change the member size of a striped family")
+
     /* For h5repart only. Private property of new member size is used to signal
      * h5repart is being used to change member file size.  h5repart will open
      * files for read and write.  When the files are closed, metadata will be
@@ -676,6 +816,8 @@ H5FD_family_open(const char *name, unsigned flags, hid_t fapl_id,
         } /* end else */
         file->memb_size = fa->memb_size; /* Actual member size to be updated later */
         file->pmem_size = fa->memb_size; /* Member size passed in through property */
+        file->stripe_size = fa->stripe_size;
+        file->stripe_count = fa->stripe_count;
     } /* end else */
     file->name = H5MM_strdup(name);
     file->flags = flags;
@@ -730,7 +872,13 @@ H5FD_family_open(const char *name, unsigned flags, hid_t fapl_id,
      * smaller than the size specified through H5Pset_fapl_family().  Update the actual
      * member size.
      */
-    if ((eof=H5FDget_eof(file->memb[0], H5FD_MEM_DEFAULT))) file->memb_size = eof;
+    if(file->stripe_count > 0) {
+        /* Members of a striped family have no fixed size, but there can't
+         * be more of them than stripes. */
+        if(file->nmembs > file->stripe_count)
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, NULL, "more member files than stripes")
+    } /* end if */
+    else if ((eof=H5FDget_eof(file->memb[0], H5FD_MEM_DEFAULT))) file->memb_size = eof;
 
     ret_value=(H5FD_t *)file;
 
@@ -926,6 +1074,63 @@ H5FD_family_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_family_memb_open
+ *
+ * Purpose:	Makes sure member U of the family is open, creating it if
+ *		necessary.  MEMB_NAME is a scratch buffer for the member's
+ *		name.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_family_memb_open(H5FD_family_t *file, unsigned u, char *memb_name)
+{
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Enlarge member array */
+    if(u >= file->amembs) {
+        unsigned n = MAX(64, 2 * file->amembs);
+        H5FD_t **x = (H5FD_t **)H5MM_realloc(file->memb, n * sizeof(H5FD_t *));
+
+        if(!x)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory block")
+        file->amembs = n;
+        file->memb = x;
+        file->nmembs = u;
+    } /* end if */
+
+    /* Create another file if necessary.  Striped members have no size
+     * limit of their own. */
+    if(u >= file->nmembs || !file->memb[u]) {
+        haddr_t maxaddr = HADDR_UNDEF;
+
+        if(0 == file->stripe_count) {
+            H5_CHECK_OVERFLOW(file->memb_size, hsize_t, haddr_t);
+            maxaddr = (haddr_t)file->memb_size;
+        } /* end if */
+
+        file->nmembs = MAX(file->nmembs, u+1);
+        HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, file->name, u);
+        H5E_BEGIN_TRY {
+            file->memb[u] = H5FDopen(memb_name, file->flags | H5F_ACC_CREAT,
+                         file->memb_fapl_id, maxaddr);
+        } H5E_END_TRY;
+        if(NULL == file->memb[u])
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_family_memb_open() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5FD_family_set_eoa
  *
@@ -960,32 +1165,33 @@ H5FD_family_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t abs_eoa)
     if(NULL == (memb_name = (char *)H5MM_malloc(H5FD_FAM_MEMB_NAME_BUF_SIZE)))
         HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to allocate member name")
 
-    for(u = 0; addr || u < file->nmembs; u++) {
+    /* A striped family always has all of its members.  Each one holds its
+     * stripe from every full row of stripes below the EOA, plus its part
+     * of the last, partial, row. */
+    if(file->stripe_count > 0) {
+        hsize_t row_size = file->stripe_size * file->stripe_count;
+        hsize_t rem = abs_eoa % row_size;
 
-        /* Enlarge member array */
-        if(u >= file->amembs) {
-            unsigned n = MAX(64, 2 * file->amembs);
-            H5FD_t **x = (H5FD_t **)H5MM_realloc(file->memb, n * sizeof(H5FD_t *));
+        for(u = 0; u < file->stripe_count; u++) {
+            haddr_t memb_eoa = (abs_eoa / row_size) * file->stripe_size;
 
-            if(!x)
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory block")
-            file->amembs = n;
-            file->memb = x;
-            file->nmembs = u;
-        } /* end if */
+            if(rem > (hsize_t)u * file->stripe_size)
+                memb_eoa += MIN(file->stripe_size, rem - (hsize_t)u * file->stripe_size);
 
-        /* Create another file if necessary */
-        if(u >= file->nmembs || !file->memb[u]) {
-            file->nmembs = MAX(file->nmembs, u+1);
-            HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, file->name, u);
-            H5E_BEGIN_TRY {
-                H5_CHECK_OVERFLOW(file->memb_size, hsize_t, haddr_t);
-                file->memb[u] = H5FDopen(memb_name, file->flags | H5F_ACC_CREAT,
-                             file->memb_fapl_id, (haddr_t)file->memb_size);
-            } H5E_END_TRY;
-            if(NULL == file->memb[u])
+            if(H5FD_family_memb_open(file, u, memb_name) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
-        } /* end if */
+            if(H5FD_set_eoa(file->memb[u], type, memb_eoa) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to set file eoa")
+        } /* end for */
+
+        file->eoa = abs_eoa;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    for(u = 0; addr || u < file->nmembs; u++) {
+        /* Create another file if necessary */
+        if(H5FD_family_memb_open(file, u, memb_name) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
 
         /* Set the EOA marker for the member */
         /* (Note compensating for base address addition in internal routine) */
@@ -1042,6 +1248,28 @@ H5FD_family_get_eof(const H5FD_t *_file, H5FD_mem_t type)
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
+    /*
+     * The end of a striped family is the end of the highest stripe
+     * that any member has data for.
+     */
+    if(file->stripe_count > 0) {
+        unsigned u;             /* Local index variable */
+
+        for(u = 0; u < file->nmembs; u++) {
+            haddr_t memb_eof;
+
+            if(file->memb[u] && (memb_eof = H5FD_get_eof(file->memb[u], type)) > 0) {
+                haddr_t row = (memb_eof - 1) / file->stripe_size;
+                haddr_t end = (row * file->stripe_count + u) * file->stripe_size
+                        + (memb_eof - 1) % file->stripe_size + 1;
+
+                eof = MAX(eof, end);
+            } /* end if */
+        } /* end for */
+
+        HGOTO_DONE(eof + file->pub.base_addr)
+    } /* end if */
+
     /*
      * Find the last member that has a non-zero EOF and break out of the loop
      * with `i' equal to that member. If all members have zero EOF then exit
@@ -1067,6 +1295,7 @@ H5FD_family_get_eof(const H5FD_t *_file, H5FD_mem_t type)
     /* Set return value */
     ret_value = eof;
 
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
@@ -1102,9 +1331,15 @@ H5FD_family_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
     if(H5P_get(plist, H5F_ACS_FAMILY_OFFSET_NAME, &offset) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get offset for family driver")
 
-    if(offset > (file->memb_size * file->nmembs))
-        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "offset is bigger than file size")
-    memb = (int)(offset/file->memb_size);
+    if(file->stripe_count > 0)
+        memb = (int)((offset / file->stripe_size) % file->stripe_count);
+    else {
+        if(offset > (file->memb_size * file->nmembs))
+            HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "offset is bigger than file size")
+        memb = (int)(offset/file->memb_size);
+    } /* end else */
+    if((unsigned)memb >= file->nmembs || NULL == file->memb[memb])
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "member file isn't open")
 
     ret_value = H5FD_get_vfd_handle(file->memb[memb], fapl, file_handle);
 
@@ -1113,6 +1348,154 @@ done:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_family_stripe_io
+ *
+ * Purpose:	Reads SIZE bytes at address ADDR of a striped family into
+ *		RBUF or, when RBUF is NULL, writes them from WBUF.
+ *
+ *		The request is cut at stripe boundaries and the pieces are
+ *		grouped by member, so that each member receives one vector
+ *		request for all of its stripes instead of one request per
+ *		stripe.  A member's stripes are adjacent in the member, so
+ *		drivers with vector support turn them into a single system
+ *		call (sec2) or a single batch of asynchronous requests
+ *		(io_uring).  A request within one stripe goes straight to
+ *		that stripe's member.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_family_stripe_io(H5FD_family_t *file, H5FD_mem_t type, hid_t dxpl_id,
+    haddr_t addr, size_t size, void *rbuf, const void *wbuf)
+{
+    haddr_t     first;                  /* First stripe of the request */
+    size_t      npieces;                /* Number of pieces of the request */
+    size_t     *start = NULL;           /* Index of each member's first piece */
+    size_t     *next = NULL;            /* Index of each member's next piece */
+    H5FD_mem_t *types = NULL;           /* Memory types of the pieces */
+    haddr_t    *addrs = NULL;           /* Member addresses of the pieces */
+    size_t     *sizes = NULL;           /* Sizes of the pieces */
+    void      **rbufs = NULL;           /* Buffers of the pieces when reading */
+    const void **wbufs = NULL;          /* Buffers of the pieces when writing */
+    size_t      pos;                    /* Position in the caller's buffer */
+    size_t      v;                      /* Local index variable */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file->stripe_count > 0);
+    HDassert(size > 0);
+
+    /* Count the stripes that the request touches */
+    first = addr / file->stripe_size;
+    H5_CHECKED_ASSIGN(npieces, size_t, ((addr + size - 1) / file->stripe_size - first) + 1, haddr_t);
+
+    /* A request within one stripe needs no vectors */
+    if(1 == npieces) {
+        haddr_t sub = (first / file->stripe_count) * file->stripe_size + addr % file->stripe_size;
+
+        H5_CHECKED_ASSIGN(u, unsigned, first % file->stripe_count, haddr_t);
+        HDassert(u < file->nmembs && file->memb[u]);
+
+        if(rbuf) {
+            if(H5FDread(file->memb[u], type, dxpl_id, sub, size, rbuf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+        } /* end if */
+        else
+            if(H5FDwrite(file->memb[u], type, dxpl_id, sub, size, wbuf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Allocate the vectors */
+    if(NULL == (start = (size_t *)H5MM_calloc(2 * (file->stripe_count + 1) * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate member index")
+    next = start + file->stripe_count + 1;
+    if(NULL == (types = (H5FD_mem_t *)H5MM_malloc(npieces * sizeof(H5FD_mem_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate type vector")
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(npieces * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address vector")
+    if(NULL == (sizes = (size_t *)H5MM_malloc(npieces * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate size vector")
+    if(rbuf) {
+        if(NULL == (rbufs = (void **)H5MM_malloc(npieces * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate buffer vector")
+    } /* end if */
+    else
+        if(NULL == (wbufs = (const void **)H5MM_malloc(npieces * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate buffer vector")
+
+    /* Give each member a run of entries in the vectors, large enough for
+     * its pieces */
+    for(v = 0; v < npieces; v++)
+        start[((first + v) % file->stripe_count) + 1]++;
+    for(u = 0; u < file->stripe_count; u++) {
+        start[u + 1] += start[u];
+        next[u] = start[u];
+    } /* end for */
+
+    /* Cut the request into pieces, filling each member's pieces in stripe
+     * order so that they are in increasing address order in the member */
+    for(v = 0, pos = 0; v < npieces; v++) {
+        haddr_t stripe = first + v;
+        haddr_t off = (0 == v ? addr % file->stripe_size : 0);
+        hsize_t tempreq = file->stripe_size - off;
+        size_t idx = next[stripe % file->stripe_count]++;
+
+        /* Prevent size_t overflow on platforms with 4 byte size_t's */
+	if(tempreq > SIZET_MAX)
+	    tempreq = SIZET_MAX;
+
+        types[idx] = type;
+        addrs[idx] = (stripe / file->stripe_count) * file->stripe_size + off;
+        sizes[idx] = MIN(size - pos, (size_t)tempreq);
+        if(rbufs)
+            rbufs[idx] = (unsigned char *)rbuf + pos;
+        else
+            wbufs[idx] = (const unsigned char *)wbuf + pos;
+        pos += sizes[idx];
+    } /* end for */
+    HDassert(pos == size);
+
+    /* Issue one vector request per member */
+    for(u = 0; u < file->stripe_count; u++) {
+        uint32_t count;
+
+        if(start[u + 1] == start[u])
+            continue;
+        H5_CHECKED_ASSIGN(count, uint32_t, start[u + 1] - start[u], size_t);
+        HDassert(u < file->nmembs && file->memb[u]);
+
+        if(rbufs) {
+            if(H5FDread_vector(file->memb[u], dxpl_id, count, types + start[u],
+                    addrs + start[u], sizes + start[u], rbufs + start[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+        } /* end if */
+        else
+            if(H5FDwrite_vector(file->memb[u], dxpl_id, count, types + start[u],
+                    addrs + start[u], sizes + start[u], wbufs + start[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+    } /* end for */
+
+done:
+    H5MM_xfree(start);
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(rbufs);
+    H5MM_xfree(wbufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_family_stripe_io() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5FD_family_read
  *
@@ -1154,6 +1537,13 @@ H5FD_family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, si
     if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+    /* Striped families read from all the members touched at once */
+    if(file->stripe_count > 0) {
+        if(size > 0 && H5FD_family_stripe_io(file, type, dxpl_id, addr, size, _buf, NULL) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "striped read failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Read from each member */
     while(size > 0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
@@ -1223,6 +1613,13 @@ H5FD_family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
     if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+    /* Striped families write to all the members touched at once */
+    if(file->stripe_count > 0) {
+        if(size > 0 && H5FD_family_stripe_io(file, type, dxpl_id, addr, size, NULL, _buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "striped write failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Write to each member */
     while (size>0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
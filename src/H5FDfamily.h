@@ -31,6 +31,10 @@ H5_DLL herr_t H5Pset_fapl_family(hid_t fapl_id, hsize_t memb_size,
 			  hid_t memb_fapl_id);
 H5_DLL herr_t H5Pget_fapl_family(hid_t fapl_id, hsize_t *memb_size/*out*/,
 			  hid_t *memb_fapl_id/*out*/);
+H5_DLL herr_t H5Pset_fapl_family_stripe(hid_t fapl_id, hsize_t stripe_size,
+			  unsigned stripe_count);
+H5_DLL herr_t H5Pget_fapl_family_stripe(hid_t fapl_id, hsize_t *stripe_size/*out*/,
+			  unsigned *stripe_count/*out*/);
 
 #ifdef __cplusplus
 }
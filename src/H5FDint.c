@@ -38,6 +38,7 @@
 #include "H5Fprivate.h"         /* File access				*/
 #include "H5FDpkg.h"		/* File Drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 
 
 /****************/
@@ -261,6 +262,162 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_read_vector
+ *
+ * Purpose:	Private version of H5FDread_vector()
+ *
+ *              Reads COUNT pieces, each described by an entry in the
+ *              TYPES, ADDRS, SIZES and BUFS arrays.  The addresses are
+ *              relative to the base address.  If the driver provides a
+ *              read_vector callback the whole vector is handed to it,
+ *              otherwise the pieces are read one at a time with the
+ *              driver's read callback.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/)
+{
+    hid_t dxpl_id;                      /* DXPL for operation */
+    haddr_t *abs_addrs = NULL;          /* Absolute addresses for the driver */
+    uint32_t u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file && file->cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check each piece against the EOA, as in H5FD_read() */
+    if(!(file->access_flags & H5F_ACC_SWMR_READ))
+        for(u = 0; u < count; u++) {
+            haddr_t     eoa;
+
+            HDassert(bufs[u]);
+            if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+            if((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+        } /* end for */
+
+    /* Convert to absolute addresses, if necessary */
+    if(file->base_addr > 0) {
+        if(NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address vector")
+        for(u = 0; u < count; u++)
+            abs_addrs[u] = addrs[u] + file->base_addr;
+    } /* end if */
+    else
+        abs_addrs = addrs;
+
+    /* Dispatch to driver */
+    if(file->cls->read_vector) {
+        if((file->cls->read_vector)(file, dxpl_id, count, types, abs_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read vector request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0)
+                if((file->cls->read)(file, types[u], dxpl_id, abs_addrs[u], sizes[u], bufs[u]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+
+done:
+    if(abs_addrs && abs_addrs != addrs)
+        abs_addrs = (haddr_t *)H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_write_vector
+ *
+ * Purpose:	Private version of H5FDwrite_vector()
+ *
+ *              Writes COUNT pieces, with the same conventions as
+ *              H5FD_read_vector().
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    hid_t dxpl_id;                      /* DXPL for operation */
+    haddr_t *abs_addrs = NULL;          /* Absolute addresses for the driver */
+    uint32_t u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file && file->cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check each piece against the EOA, as in H5FD_write() */
+    for(u = 0; u < count; u++) {
+        haddr_t     eoa;
+
+        HDassert(bufs[u]);
+        if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+        if((addrs[u] + file->base_addr + sizes[u]) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu",
+                        (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+    } /* end for */
+
+    /* Convert to absolute addresses, if necessary */
+    if(file->base_addr > 0) {
+        if(NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address vector")
+        for(u = 0; u < count; u++)
+            abs_addrs[u] = addrs[u] + file->base_addr;
+    } /* end if */
+    else
+        abs_addrs = addrs;
+
+    /* Dispatch to driver */
+    if(file->cls->write_vector) {
+        if((file->cls->write_vector)(file, dxpl_id, count, types, abs_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write vector request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0)
+                if((file->cls->write)(file, types[u], dxpl_id, abs_addrs[u], sizes[u], bufs[u]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+done:
+    if(abs_addrs && abs_addrs != addrs)
+        abs_addrs = (haddr_t *)H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_set_eoa
@@ -0,0 +1,1707 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A file driver that keeps many requests in flight at once with
+ *          the Linux io_uring interface.  Each read or write, and each
+ *          piece of a vector read or write, is split into requests of at
+ *          most the configured buffer size, and up to 'queue_depth' of
+ *          them are submitted together and completed in whatever order
+ *          the device finishes them.
+ *
+ *          The rings are set up with raw system calls, so liburing is not
+ *          needed.  When io_uring is not available, either when building
+ *          or at run time, the same requests are carried out one at a
+ *          time with pread() and pwrite().
+ *
+ *          The file can optionally be opened with O_DIRECT.  In that case
+ *          every request goes through an aligned bounce buffer, and the
+ *          bounce buffers are registered with the ring so the kernel does
+ *          not have to map them for each request.  Writes that do not
+ *          cover whole file blocks read the partial blocks first.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDprivate.h"    /* File drivers             */
+#include "H5FDiouring.h"    /* io_uring file driver     */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+/* The kernel interface header also defines generic names such as BLOCK_SIZE,
+ * so it is only included here rather than in H5private.h.
+ */
+#ifdef H5_HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#endif
+
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+
+/* The io_uring rings are only used when the kernel interface headers are
+ * available; the ring index updates use the GCC atomic builtins.
+ */
+#if defined(H5_HAVE_LINUX_IO_URING_H) && defined(H5_HAVE_SYS_SYSCALL_H) \
+        && defined(H5_HAVE_SYS_MMAN_H) && defined(H5_HAVE_SYS_UIO_H)     \
+        && defined(__NR_io_uring_setup) && defined(__GNUC__)
+#define H5FD_IOURING_HAVE_RING
+#endif
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Largest queue depth and request size accepted */
+#define H5FD_IOURING_QUEUE_DEPTH_MAX    4096
+#define H5FD_IOURING_BUF_SIZE_MAX       ((size_t)1 << 30)
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned    queue_depth;    /* Max. # of requests in flight             */
+    hbool_t     direct;         /* Whether to open the file with O_DIRECT   */
+    size_t      block_size;     /* File block size for direct I/O           */
+    size_t      buf_size;       /* Max. size of a request                   */
+} H5FD_iouring_fapl_t;
+
+/* What an outstanding request is doing */
+typedef enum H5FD_iouring_state_t {
+    H5FD_IOURING_FREE = 0,      /* Not in use                               */
+    H5FD_IOURING_READ,          /* Reading application data                 */
+    H5FD_IOURING_FILL_HEAD,     /* Reading the first block of a partial-block write */
+    H5FD_IOURING_FILL_TAIL,     /* Reading the last block of a partial-block write */
+    H5FD_IOURING_WRITE          /* Writing application data                 */
+} H5FD_iouring_state_t;
+
+/* An outstanding request.  The 'addr', 'buf', 'size' and 'done' fields
+ * describe the transfer currently in progress.  For requests through a
+ * bounce buffer, 'span_addr' and 'span_size' describe the aligned region
+ * of the file held in the bounce buffer, and the application's data is
+ * 'usize' bytes at 'ubuf', stored 'uoff' bytes into the bounce buffer.
+ */
+typedef struct H5FD_iouring_req_t {
+    H5FD_iouring_state_t state; /* What the request is doing                */
+    hbool_t         ready;      /* Whether 'res' holds a completion         */
+    int             res;        /* # of bytes transferred, or -errno        */
+    haddr_t         addr;       /* File address of the transfer             */
+    unsigned char   *buf;       /* Buffer for the transfer                  */
+    size_t          size;       /* Size of the transfer                     */
+    size_t          done;       /* # of bytes of the transfer done so far   */
+    haddr_t         span_addr;  /* File address of the bounce buffer        */
+    size_t          span_size;  /* # of bytes in the bounce buffer          */
+    unsigned char   *ubuf;      /* Application buffer (bounce buffer only)  */
+    size_t          uoff;       /* Offset of the application data           */
+    size_t          usize;      /* Size of the application data             */
+#ifdef H5FD_IOURING_HAVE_RING
+    struct iovec    iov;        /* Vector for readv/writev submissions      */
+#endif /* H5FD_IOURING_HAVE_RING */
+} H5FD_iouring_req_t;
+
+#ifdef H5FD_IOURING_HAVE_RING
+/* The shared submission and completion rings */
+typedef struct H5FD_iouring_ring_t {
+    int             fd;         /* io_uring instance, or -1 when not in use */
+    hbool_t         fixed;      /* Whether the bounce buffers are registered */
+    void            *sq_ptr;    /* Submission ring mapping                  */
+    size_t          sq_size;    /* Size of the submission ring mapping      */
+    void            *cq_ptr;    /* Completion ring mapping                  */
+    size_t          cq_size;    /* Size of the completion ring mapping      */
+    struct io_uring_sqe *sqes;  /* Submission queue entries                 */
+    size_t          sqes_size;  /* Size of the submission entries mapping   */
+    unsigned        *sq_head;   /* Submission ring head (kernel)            */
+    unsigned        *sq_tail;   /* Submission ring tail (driver)            */
+    unsigned        *sq_mask;   /* Submission ring index mask               */
+    unsigned        *sq_array;  /* Submission ring entries                  */
+    unsigned        *cq_head;   /* Completion ring head (driver)            */
+    unsigned        *cq_tail;   /* Completion ring tail (kernel)            */
+    unsigned        *cq_mask;   /* Completion ring index mask               */
+    struct io_uring_cqe *cqes;  /* Completion queue entries                 */
+} H5FD_iouring_ring_t;
+#endif /* H5FD_IOURING_HAVE_RING */
+
+/*
+ * The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  All
+ * I/O is positioned, so no file position is tracked.  'reqs' holds one
+ * entry per request that can be in flight, and for direct I/O 'bufs' holds
+ * one aligned bounce buffer of 'fa.buf_size' bytes per entry.  Since direct
+ * writes cover whole blocks, they can leave the file longer than its data,
+ * which 'padded' records so the file can be trimmed when it is closed.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t          pub;        /* public stuff, must be first      */
+    int             fd;         /* the filesystem file descriptor   */
+    haddr_t         eoa;        /* end of allocated region          */
+    haddr_t         eof;        /* end of file; current file size   */
+    H5FD_iouring_fapl_t fa;     /* file access properties           */
+    H5FD_iouring_req_t *reqs;   /* outstanding requests             */
+    unsigned        ninflight;  /* # of requests in use             */
+    unsigned char   *bufs;      /* bounce buffers for direct I/O    */
+    hbool_t         padded;     /* whether whole-block writes extended the file past its data */
+#ifdef H5FD_IOURING_HAVE_RING
+    H5FD_iouring_ring_t ring;   /* io_uring instance                */
+#endif /* H5FD_IOURING_HAVE_RING */
+    char            filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+    dev_t           device;     /* file device number               */
+    ino_t           inode;      /* file i-node number               */
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Prototypes */
+static herr_t H5FD_iouring_term(void);
+static void *H5FD_iouring_fapl_get(H5FD_t *file);
+static void *H5FD_iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_iouring_close(H5FD_t *_file);
+static int H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_iouring_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD_iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_iouring_unlock(H5FD_t *_file);
+static herr_t H5FD_iouring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD_iouring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[]);
+
+#ifdef H5FD_IOURING_HAVE_RING
+static void H5FD__iouring_ring_init(H5FD_iouring_t *file);
+static void H5FD__iouring_ring_term(H5FD_iouring_t *file);
+#endif /* H5FD_IOURING_HAVE_RING */
+static void H5FD__iouring_start(H5FD_iouring_t *file, unsigned idx);
+static herr_t H5FD__iouring_reap(H5FD_iouring_t *file);
+static hbool_t H5FD__iouring_queue(H5FD_iouring_t *file, hbool_t do_write,
+            haddr_t addr, size_t size, unsigned char *buf, size_t *nused);
+static void H5FD__iouring_complete(H5FD_iouring_t *file, unsigned idx, int *err);
+static herr_t H5FD__iouring_io(H5FD_iouring_t *file, hbool_t do_write, uint32_t count,
+            const haddr_t addrs[], const size_t sizes[], void * const bufs[]);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                  /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD_iouring_term,          /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size           */
+    H5FD_iouring_fapl_get,      /* fapl_get             */
+    H5FD_iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_iouring_open,          /* open                 */
+    H5FD_iouring_close,         /* close                */
+    H5FD_iouring_cmp,           /* cmp                  */
+    H5FD_iouring_query,         /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_iouring_get_eoa,       /* get_eoa              */
+    H5FD_iouring_set_eoa,       /* set_eoa              */
+    H5FD_iouring_get_eof,       /* get_eof              */
+    H5FD_iouring_get_handle,    /* get_handle           */
+    H5FD_iouring_read,          /* read                 */
+    H5FD_iouring_write,         /* write                */
+    NULL,                       /* flush                */
+    H5FD_iouring_truncate,      /* truncate             */
+    H5FD_iouring_lock,          /* lock                 */
+    H5FD_iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    H5FD_iouring_read_vector,   /* read_vector          */
+    H5FD_iouring_write_vector   /* write_vector         */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *
+ *              QUEUE_DEPTH is the maximum number of requests kept in
+ *              flight and BUF_SIZE the maximum size of one request.  When
+ *              DIRECT is set the file is opened with O_DIRECT, and
+ *              BLOCK_SIZE is the alignment the file system requires for
+ *              file offsets, sizes and memory.  Zero selects the default
+ *              for any of the sizes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, hbool_t direct,
+    size_t block_size, size_t buf_size)
+{
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "iIubzz", fapl_id, queue_depth, direct, block_size, buf_size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    fa.queue_depth = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa.direct = direct;
+    fa.block_size = block_size ? block_size : H5FD_IOURING_BLOCK_SIZE_DEF;
+    fa.buf_size = buf_size ? buf_size : H5FD_IOURING_BUF_SIZE_DEF;
+
+    if(fa.queue_depth > H5FD_IOURING_QUEUE_DEPTH_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth too large")
+    if(fa.buf_size > H5FD_IOURING_BUF_SIZE_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer size too large")
+    if(!POWER_OF_TWO(fa.block_size))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block size must be a power of two")
+
+    /* Buffer size must be a multiple of file block size */
+    if(fa.buf_size % fa.block_size != 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer size must be a multiple of block size")
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access property
+ *              list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth/*out*/, hbool_t *direct/*out*/,
+    size_t *block_size/*out*/, size_t *buf_size/*out*/)
+{
+    H5P_genplist_t              *plist;     /* Property list pointer */
+    const H5FD_iouring_fapl_t   *fa;
+    herr_t                      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "ixxxx", fapl_id, queue_depth, direct, block_size, buf_size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(queue_depth)
+        *queue_depth = fa->queue_depth;
+    if(direct)
+        *direct = fa->direct;
+    if(block_size)
+        *block_size = fa->block_size;
+    if(buf_size)
+        *buf_size = fa->buf_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    void            *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set return value */
+    ret_value = H5FD_iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t   *old_fa = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t         *new_fa = NULL;     /* New fapl info */
+    void                        *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(old_fa);
+
+    if(NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    HDmemcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_fapl_copy() */
+
+#ifdef H5FD_IOURING_HAVE_RING
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Sets up an io_uring instance for FILE and maps its rings.
+ *              For direct I/O the bounce buffers are registered with the
+ *              instance as well.
+ *
+ *              Nothing here is an error: when the kernel does not support
+ *              io_uring, or does not allow it, the ring is left unused and
+ *              the driver falls back to pread() and pwrite().  Failing to
+ *              register the buffers only means that requests are submitted
+ *              as readv and writev instead of fixed-buffer operations.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_ring_init(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t     *ring = &file->ring;
+    struct io_uring_params  params;         /* Ring setup parameters */
+    void                    *ptr;           /* Mapped memory */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    HDmemset(ring, 0, sizeof(*ring));
+    HDmemset(&params, 0, sizeof(params));
+    if((ring->fd = (int)HDsyscall(__NR_io_uring_setup, file->fa.queue_depth, &params)) < 0)
+        goto done;
+
+    /* Map the submission and completion rings, which older kernels keep in
+     * separate mappings
+     */
+    ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->sq_size = ring->cq_size = MAX(ring->sq_size, ring->cq_size);
+#endif /* IORING_FEAT_SINGLE_MMAP */
+    if(MAP_FAILED == (ptr = HDmmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, (HDoff_t)IORING_OFF_SQ_RING)))
+        goto done;
+    ring->sq_ptr = ptr;
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ptr = ring->sq_ptr;
+    else
+#endif /* IORING_FEAT_SINGLE_MMAP */
+    {
+        if(MAP_FAILED == (ptr = HDmmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, (HDoff_t)IORING_OFF_CQ_RING)))
+            goto done;
+        ring->cq_ptr = ptr;
+    } /* end else */
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    if(MAP_FAILED == (ptr = HDmmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, (HDoff_t)IORING_OFF_SQES)))
+        goto done;
+    ring->sqes = (struct io_uring_sqe *)ptr;
+
+    ring->sq_head = (unsigned *)((unsigned char *)ring->sq_ptr + params.sq_off.head);
+    ring->sq_tail = (unsigned *)((unsigned char *)ring->sq_ptr + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)((unsigned char *)ring->sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((unsigned char *)ring->sq_ptr + params.sq_off.array);
+    ring->cq_head = (unsigned *)((unsigned char *)ring->cq_ptr + params.cq_off.head);
+    ring->cq_tail = (unsigned *)((unsigned char *)ring->cq_ptr + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)((unsigned char *)ring->cq_ptr + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((unsigned char *)ring->cq_ptr + params.cq_off.cqes);
+
+    /* Register one buffer per request slot */
+    if(file->bufs) {
+        struct iovec    *iov;               /* Buffers to register */
+        unsigned        u;                  /* Local index variable */
+
+        if(NULL != (iov = (struct iovec *)H5MM_malloc(file->fa.queue_depth * sizeof(struct iovec)))) {
+            for(u = 0; u < file->fa.queue_depth; u++) {
+                iov[u].iov_base = file->bufs + (size_t)u * file->fa.buf_size;
+                iov[u].iov_len = file->fa.buf_size;
+            } /* end for */
+            if(HDsyscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS, iov, file->fa.queue_depth) == 0)
+                ring->fixed = TRUE;
+            H5MM_xfree(iov);
+        } /* end if */
+    } /* end if */
+
+done:
+    /* Don't use a partially set up ring */
+    if(ring->fd >= 0 && NULL == ring->sqes)
+        H5FD__iouring_ring_term(file);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_ring_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Unmaps the rings of FILE and closes its io_uring instance.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_ring_term(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    if(ring->sqes)
+        (void)HDmunmap(ring->sqes, ring->sqes_size);
+    if(ring->cq_ptr && ring->cq_ptr != ring->sq_ptr)
+        (void)HDmunmap(ring->cq_ptr, ring->cq_size);
+    if(ring->sq_ptr)
+        (void)HDmunmap(ring->sq_ptr, ring->sq_size);
+    if(ring->fd >= 0)
+        (void)HDclose(ring->fd);
+
+    HDmemset(ring, 0, sizeof(*ring));
+    ring->fd = -1;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_ring_term() */
+
+#endif /* H5FD_IOURING_HAVE_RING */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_start
+ *
+ * Purpose:     Starts the remaining part of the transfer for request IDX.
+ *              With a ring the transfer is only queued and is submitted
+ *              by the next H5FD__iouring_reap() call.  Without one it is
+ *              carried out right away and the request is marked ready.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_start(H5FD_iouring_t *file, unsigned idx)
+{
+    H5FD_iouring_req_t  *req = &file->reqs[idx];
+    unsigned char       *buf;               /* Start of the transfer */
+    size_t              nbytes;             /* Size of the transfer */
+    HDoff_t             offset;             /* File offset of the transfer */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(req->state != H5FD_IOURING_FREE);
+    HDassert(req->done < req->size);
+
+    buf = req->buf + req->done;
+    nbytes = req->size - req->done;
+    offset = (HDoff_t)(req->addr + req->done);
+    req->ready = FALSE;
+
+#ifdef H5FD_IOURING_HAVE_RING
+    if(file->ring.fd >= 0) {
+        H5FD_iouring_ring_t *ring = &file->ring;
+        struct io_uring_sqe *sqe;           /* Submission queue entry */
+        unsigned            tail;           /* Submission ring tail */
+        unsigned            index;          /* Entry index */
+        hbool_t             do_write = (req->state == H5FD_IOURING_WRITE);
+
+        /* Only this process adds entries, so the tail needs no barrier */
+        tail = *ring->sq_tail;
+        index = tail & *ring->sq_mask;
+        sqe = &ring->sqes[index];
+        HDmemset(sqe, 0, sizeof(*sqe));
+        sqe->fd = file->fd;
+        sqe->off = (uint64_t)offset;
+        sqe->user_data = (uint64_t)idx;
+        if(ring->fixed) {
+            sqe->opcode = (uint8_t)(do_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED);
+            sqe->addr = (uint64_t)(uintptr_t)buf;
+            sqe->len = (uint32_t)nbytes;
+            sqe->buf_index = (uint16_t)idx;
+        } /* end if */
+        else {
+            req->iov.iov_base = buf;
+            req->iov.iov_len = nbytes;
+            sqe->opcode = (uint8_t)(do_write ? IORING_OP_WRITEV : IORING_OP_READV);
+            sqe->addr = (uint64_t)(uintptr_t)&req->iov;
+            sqe->len = 1;
+        } /* end else */
+        ring->sq_array[index] = index;
+
+        /* Publish the entry to the kernel */
+        __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    } /* end if */
+    else
+#endif /* H5FD_IOURING_HAVE_RING */
+    {
+        h5_posix_io_ret_t   n;              /* # of bytes transferred */
+
+        if(nbytes > H5_POSIX_MAX_IO_BYTES)
+            nbytes = H5_POSIX_MAX_IO_BYTES;
+        do {
+            if(req->state == H5FD_IOURING_WRITE)
+                n = HDpwrite(file->fd, buf, (h5_posix_io_t)nbytes, offset);
+            else
+                n = HDpread(file->fd, buf, (h5_posix_io_t)nbytes, offset);
+        } while(-1 == n && EINTR == errno);
+
+        req->res = (-1 == n) ? -errno : (int)n;
+        req->ready = TRUE;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_start() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_reap
+ *
+ * Purpose:     Submits the queued transfers of FILE and waits for at least
+ *              one of them to complete, then marks every completed request
+ *              ready.  Must only be called with a ring and with requests
+ *              in flight that are not ready yet.
+ *
+ *              If the ring fails, it is shut down and the driver carries
+ *              on without it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_reap(H5FD_iouring_t *file)
+{
+#ifdef H5FD_IOURING_HAVE_RING
+    H5FD_iouring_ring_t *ring = &file->ring;
+    unsigned            head;               /* Completion ring head */
+    unsigned            tail;               /* Completion ring tail */
+#endif /* H5FD_IOURING_HAVE_RING */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5FD_IOURING_HAVE_RING
+    HDassert(ring->fd >= 0);
+
+    for(;;) {
+        unsigned    to_submit;              /* # of entries not consumed by the kernel */
+
+        to_submit = *ring->sq_tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+        if(HDsyscall(__NR_io_uring_enter, ring->fd, to_submit, 1, IORING_ENTER_GETEVENTS, NULL, 0) >= 0)
+            break;
+        if(EINTR != errno && EAGAIN != errno && EBUSY != errno) {
+            int myerrno = errno;
+
+            /* Closing the ring cancels whatever is still in flight */
+            H5FD__iouring_ring_term(file);
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "io_uring_enter failed: filename = '%s', errno = %d, error message = '%s'", file->filename, myerrno, HDstrerror(myerrno))
+        } /* end if */
+    } /* end for */
+
+    /* Hand each completion to its request */
+    head = *ring->cq_head;
+    tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    while(head != tail) {
+        const struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+        H5FD_iouring_req_t *req = &file->reqs[(unsigned)cqe->user_data];
+
+        HDassert(cqe->user_data < file->fa.queue_depth);
+        HDassert(req->state != H5FD_IOURING_FREE);
+        req->res = cqe->res;
+        req->ready = TRUE;
+        head++;
+    } /* end while */
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+#else /* H5FD_IOURING_HAVE_RING */
+    /* Without a ring every request is ready as soon as it is started */
+    HDassert(0 && "no requests to wait for");
+    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "no requests to wait for")
+#endif /* H5FD_IOURING_HAVE_RING */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_reap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_queue
+ *
+ * Purpose:     Starts a request for the first part of SIZE bytes at ADDR,
+ *              to be read into or written from BUF, in a free request
+ *              slot.  The number of bytes of the region the request
+ *              covers is returned in NUSED.
+ *
+ *              Without direct I/O the request transfers straight to and
+ *              from BUF.  With direct I/O it goes through the slot's bounce
+ *              buffer, covering whole file blocks.  A write that only
+ *              covers part of its first or last block reads those blocks
+ *              first.
+ *
+ *              The kernel may carry out requests in flight in any order,
+ *              so a write doesn't start while another request touching
+ *              the same part of the file is in flight.  Since pieces are
+ *              queued in order, this keeps overlapping writes in order and
+ *              the last write to a byte wins, and keeps a partial-block
+ *              write from reading blocks that an earlier write is still
+ *              changing.
+ *
+ * Return:      TRUE if a request was started, FALSE if it has to wait for
+ *              a request in flight to complete.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD__iouring_queue(H5FD_iouring_t *file, hbool_t do_write, haddr_t addr,
+    size_t size, unsigned char *buf, size_t *nused)
+{
+    H5FD_iouring_req_t  *req = NULL;        /* Request slot */
+    haddr_t             span_addr;          /* Start of the region */
+    haddr_t             span_end;           /* End of the region */
+    size_t              uoff = 0;           /* Offset of the data in the region */
+    size_t              usize;              /* # of bytes of the data covered */
+    hbool_t             head_partial = FALSE, tail_partial = FALSE;
+    unsigned            idx;                /* Index of the request slot */
+    unsigned            u;                  /* Local index variable */
+    hbool_t             ret_value = FALSE;  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(size > 0);
+    HDassert(file->ninflight < file->fa.queue_depth);
+
+    /* Work out the region of the file the request covers */
+    if(file->bufs) {
+        size_t      bsize = file->fa.block_size;
+
+        span_addr = addr & ~((haddr_t)bsize - 1);
+        uoff = (size_t)(addr - span_addr);
+        usize = MIN(size, file->fa.buf_size - uoff);
+        span_end = (addr + usize + bsize - 1) & ~((haddr_t)bsize - 1);
+        head_partial = (uoff != 0);
+        tail_partial = ((addr + usize) != span_end);
+    } /* end if */
+    else {
+        span_addr = addr;
+        usize = MIN(size, file->fa.buf_size);
+        span_end = addr + usize;
+    } /* end else */
+
+    /* Writes wait for the requests in flight that share their region */
+    if(do_write)
+        for(u = 0; u < file->fa.queue_depth; u++)
+            if(file->reqs[u].state != H5FD_IOURING_FREE
+                    && file->reqs[u].span_addr < span_end
+                    && span_addr < (file->reqs[u].span_addr + file->reqs[u].span_size))
+                HGOTO_DONE(FALSE)
+
+    for(idx = 0; file->reqs[idx].state != H5FD_IOURING_FREE; idx++)
+        ;
+    req = &file->reqs[idx];
+    req->span_addr = span_addr;
+    req->span_size = (size_t)(span_end - span_addr);
+    if(file->bufs) {
+        size_t      bsize = file->fa.block_size;
+
+        req->ubuf = buf;
+        req->uoff = uoff;
+        req->usize = usize;
+        req->buf = file->bufs + (size_t)idx * file->fa.buf_size;
+        req->addr = span_addr;
+        req->size = req->span_size;
+        if(!do_write)
+            req->state = H5FD_IOURING_READ;
+        else if(head_partial) {
+            req->state = H5FD_IOURING_FILL_HEAD;
+            req->size = bsize;
+        } /* end if */
+        else if(tail_partial) {
+            req->state = H5FD_IOURING_FILL_TAIL;
+            req->addr = span_end - bsize;
+            req->buf += req->span_size - bsize;
+            req->size = bsize;
+        } /* end if */
+        else {
+            HDmemcpy(req->buf, buf, usize);
+            req->state = H5FD_IOURING_WRITE;
+        } /* end else */
+    } /* end if */
+    else {
+        req->state = do_write ? H5FD_IOURING_WRITE : H5FD_IOURING_READ;
+        req->addr = addr;
+        req->buf = buf;
+        req->size = usize;
+        req->ubuf = NULL;
+    } /* end else */
+    *nused = usize;
+
+    req->done = 0;
+    file->ninflight++;
+    H5FD__iouring_start(file, idx);
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_queue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_complete
+ *
+ * Purpose:     Handles the completion of the current transfer of request
+ *              IDX, restarting it after a partial transfer and moving on
+ *              to its next step when the transfer is done.  Requests that
+ *              are finished are released.
+ *
+ *              A read that reaches the end of the file zero-fills the rest
+ *              of its buffer.  The first error is saved in ERR, as an
+ *              errno value, and releases the request.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_complete(H5FD_iouring_t *file, unsigned idx, int *err)
+{
+    H5FD_iouring_req_t  *req = &file->reqs[idx];
+    size_t              bsize = file->fa.block_size;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(req->ready);
+    req->ready = FALSE;
+
+    if(req->res < 0) {
+        if(-EINTR == req->res || -EAGAIN == req->res) {
+            H5FD__iouring_start(file, idx);
+            goto done;
+        } /* end if */
+        if(0 == *err)
+            *err = -req->res;
+        req->state = H5FD_IOURING_FREE;
+        file->ninflight--;
+        goto done;
+    } /* end if */
+
+    req->done += (size_t)req->res;
+    HDassert(req->done <= req->size);
+    if(req->done < req->size) {
+        if(req->state == H5FD_IOURING_WRITE) {
+            /* A write that makes no progress won't make any later either */
+            if(0 == req->res) {
+                if(0 == *err)
+                    *err = EIO;
+                req->state = H5FD_IOURING_FREE;
+                file->ninflight--;
+            } /* end if */
+            else
+                H5FD__iouring_start(file, idx);
+            goto done;
+        } /* end if */
+
+        /* End of file but not end of format address space.  With direct
+         * I/O a short read always means the end of the file, since the rest
+         * can't be read from an unaligned offset anyway.
+         */
+        if(0 == req->res || file->bufs) {
+            HDmemset(req->buf + req->done, 0, req->size - req->done);
+            req->done = req->size;
+        } /* end if */
+        else {
+            H5FD__iouring_start(file, idx);
+            goto done;
+        } /* end else */
+    } /* end if */
+
+    /* The transfer is complete, move on to the next step */
+    switch(req->state) {
+        case H5FD_IOURING_READ:
+            if(req->ubuf)
+                HDmemcpy(req->ubuf, req->buf + req->uoff, req->usize);
+            req->state = H5FD_IOURING_FREE;
+            file->ninflight--;
+            break;
+
+        case H5FD_IOURING_FILL_HEAD:
+            /* Read the last block too, unless it's the block just read */
+            if(((req->span_addr + req->uoff + req->usize) & ((haddr_t)bsize - 1)) != 0
+                    && req->span_size > bsize) {
+                req->state = H5FD_IOURING_FILL_TAIL;
+                req->addr = req->span_addr + req->span_size - bsize;
+                req->buf = file->bufs + (size_t)idx * file->fa.buf_size + (req->span_size - bsize);
+                req->size = bsize;
+                req->done = 0;
+                H5FD__iouring_start(file, idx);
+                break;
+            } /* end if */
+            /* FALLTHROUGH */
+
+        case H5FD_IOURING_FILL_TAIL:
+            /* Merge the application's data and write the whole region */
+            req->buf = file->bufs + (size_t)idx * file->fa.buf_size;
+            HDmemcpy(req->buf + req->uoff, req->ubuf, req->usize);
+            req->state = H5FD_IOURING_WRITE;
+            req->addr = req->span_addr;
+            req->size = req->span_size;
+            req->done = 0;
+            H5FD__iouring_start(file, idx);
+            break;
+
+        case H5FD_IOURING_WRITE:
+            if((req->addr + req->size) > file->eof) {
+                if(req->ubuf && (req->span_addr + req->uoff + req->usize) < (req->addr + req->size))
+                    file->padded = TRUE;
+                file->eof = req->addr + req->size;
+            } /* end if */
+            req->state = H5FD_IOURING_FREE;
+            file->ninflight--;
+            break;
+
+        case H5FD_IOURING_FREE:
+        default:
+            HDassert(0 && "unknown request state");
+            break;
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_complete() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_io
+ *
+ * Purpose:     Reads or writes COUNT pieces of data.  Piece I is SIZES[I]
+ *              bytes at address ADDRS[I], in buffer BUFS[I].
+ *
+ *              The pieces are split into requests that are kept in flight
+ *              up to the queue depth, and all of them are complete when
+ *              this routine returns, even after an error.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_io(H5FD_iouring_t *file, hbool_t do_write, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], void * const bufs[])
+{
+    uint32_t    piece = 0;                  /* Piece being queued */
+    size_t      piece_off = 0;              /* # of bytes of the piece queued */
+    int         err = 0;                    /* First error seen */
+    unsigned    u;                          /* Local index variable */
+    herr_t      ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(0 == file->ninflight);
+
+    for(;;) {
+        hbool_t     progress = FALSE;       /* Whether any request was ready */
+
+        /* Fill the free request slots */
+        while(0 == err && piece < count && file->ninflight < file->fa.queue_depth) {
+            size_t  nused;                  /* # of bytes queued */
+
+            if(piece_off == sizes[piece]) {
+                piece++;
+                piece_off = 0;
+                continue;
+            } /* end if */
+            if(!H5FD__iouring_queue(file, do_write, addrs[piece] + piece_off, sizes[piece] - piece_off, (unsigned char *)bufs[piece] + piece_off, &nused))
+                break;
+            piece_off += nused;
+        } /* end while */
+
+        /* Handle the requests that are ready */
+        for(u = 0; u < file->fa.queue_depth; u++)
+            if(file->reqs[u].state != H5FD_IOURING_FREE && file->reqs[u].ready) {
+                H5FD__iouring_complete(file, u, &err);
+                progress = TRUE;
+            } /* end if */
+
+        if(0 == file->ninflight && (err || piece == count))
+            break;
+
+        /* Wait for some of the requests in flight */
+        if(!progress && H5FD__iouring_reap(file) < 0) {
+            /* Without the ring the requests in flight are gone */
+            for(u = 0; u < file->fa.queue_depth; u++)
+                file->reqs[u].state = H5FD_IOURING_FREE;
+            file->ninflight = 0;
+            HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "unable to wait for requests")
+        } /* end if */
+    } /* end for */
+
+    if(err)
+        HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "file %s failed: filename = '%s', file descriptor = %d, errno = %d, error message = '%s'", do_write ? "write" : "read", file->filename, file->fd, err, HDstrerror(err))
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file, and sets up the
+ *              requests and the io_uring instance used for its I/O.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t      *file       = NULL;     /* io_uring VFD info        */
+    int                 fd          = -1;       /* File descriptor          */
+    int                 o_flags;                /* Flags for open() call    */
+    h5_stat_t           sb;
+    H5P_genplist_t      *plist;                 /* Property list pointer    */
+    const H5FD_iouring_fapl_t *fa;              /* File access properties   */
+    H5FD_iouring_fapl_t default_fa;             /* Default properties       */
+    H5FD_t              *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist))) {
+        default_fa.queue_depth = H5FD_IOURING_QUEUE_DEPTH_DEF;
+        default_fa.direct = FALSE;
+        default_fa.block_size = H5FD_IOURING_BLOCK_SIZE_DEF;
+        default_fa.buf_size = H5FD_IOURING_BUF_SIZE_DEF;
+        fa = &default_fa;
+    } /* end if */
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if(H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if(H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if(H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+    if(fa->direct) {
+#ifdef O_DIRECT
+        o_flags |= O_DIRECT;
+#else /* O_DIRECT */
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, NULL, "direct I/O not supported on this system")
+#endif /* O_DIRECT */
+    } /* end if */
+
+    /* Open the file */
+    if((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x", name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->fa = *fa;
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+#ifdef H5FD_IOURING_HAVE_RING
+    file->ring.fd = -1;
+#endif /* H5FD_IOURING_HAVE_RING */
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Allocate the requests, and the aligned bounce buffers for direct I/O */
+    if(NULL == (file->reqs = (H5FD_iouring_req_t *)H5MM_calloc(file->fa.queue_depth * sizeof(H5FD_iouring_req_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate requests")
+    if(file->fa.direct) {
+        void    *bufs = NULL;
+
+        if(HDposix_memalign(&bufs, file->fa.block_size, (size_t)file->fa.queue_depth * file->fa.buf_size) != 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate bounce buffers")
+        file->bufs = (unsigned char *)bufs;
+    } /* end if */
+
+#ifdef H5FD_IOURING_HAVE_RING
+    /* Set up the ring, or fall back to pread() and pwrite() */
+    H5FD__iouring_ring_init(file);
+#endif /* H5FD_IOURING_HAVE_RING */
+
+    /* Set return value */
+    ret_value = (H5FD_t*)file;
+
+done:
+    if(NULL == ret_value) {
+        if(fd >= 0)
+            HDclose(fd);
+        if(file) {
+            H5MM_xfree(file->reqs);
+            if(file->bufs)
+                HDfree(file->bufs);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_close
+ *
+ * Purpose:     Closes an HDF5 file and its io_uring instance.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(file);
+    HDassert(0 == file->ninflight);
+
+#ifdef H5FD_IOURING_HAVE_RING
+    H5FD__iouring_ring_term(file);
+#endif /* H5FD_IOURING_HAVE_RING */
+
+    /* Trim the padding of the last block written with direct I/O */
+    if(file->padded && H5F_addr_defined(file->eoa) && file->eoa > 0 && file->eof > file->eoa)
+        if(-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to trim file")
+
+    /* Close the underlying file */
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    H5MM_xfree(file->reqs);
+    if(file->bufs)
+        HDfree(file->bufs);
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t    *f1 = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t    *f2 = (const H5FD_iouring_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Data sieving is left off: reading a whole sieve buffer to
+ *              pick out a few elements serializes what the vector I/O path
+ *              can keep in flight as separate requests.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA;    /* OK to accumulate metadata for faster writes                      */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* get_handle callback returns a POSIX file descriptor              */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default VFD      */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_iouring_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD_iouring_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_iouring_get_handle
+ *
+ * Purpose:        Returns the file handle of io_uring file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t      *file = (H5FD_iouring_t *)_file;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF.  Large reads are split into requests that
+ *              are kept in flight together.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    if(H5FD__iouring_io(file, FALSE, 1, &addr, &size, &buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read from file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF.  Large writes are split into requests that
+ *              are kept in flight together.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addr, (unsigned long long)size)
+
+    if(H5FD__iouring_io(file, TRUE, 1, &addr, &size, (void * const *)&buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write to file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_read_vector
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE.  Piece I is SIZES[I]
+ *              bytes at address ADDRS[I], read into BUFS[I].
+ *
+ *              Requests for all of the pieces are kept in flight together,
+ *              up to the queue depth.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+    H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[], void *bufs[])
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    uint32_t        u;                                      /* Local index variable */
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addrs[u])
+    } /* end for */
+
+    if(H5FD__iouring_io(file, FALSE, count, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read from file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_write_vector
+ *
+ * Purpose:     Writes COUNT pieces of data to FILE.  Piece I is SIZES[I]
+ *              bytes from BUFS[I], written at address ADDRS[I].
+ *
+ *              Requests for all of the pieces are kept in flight together,
+ *              up to the queue depth.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+    H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    uint32_t        u;                                      /* Local index variable */
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+    } /* end for */
+
+    if(H5FD__iouring_io(file, TRUE, count, addrs, sizes, (void * const *)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write to file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the
+ *              end-of-address.  With direct I/O, writes of whole blocks
+ *              can leave the file a little longer than its data.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(!H5F_addr_eq(file->eoa, file->eof)) {
+        if(-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+        file->padded = FALSE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;    /* VFD file struct  */
+    int lock_flags;                             /* file locking flags       */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if(HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to lock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;    /* VFD file struct  */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(HDflock(file->fd, LOCK_UN) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to unlock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_unlock() */
+
+#endif /* H5_HAVE_PREAD && H5_HAVE_PWRITE */
+
@@ -0,0 +1,51 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the io_uring driver.
+ */
+#ifndef H5FDiouring_H
+#define H5FDiouring_H
+
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+#       define H5FD_IOURING	(H5FD_iouring_init())
+#else
+#       define H5FD_IOURING     (-1)
+#endif /* H5_HAVE_PREAD && H5_HAVE_PWRITE */
+
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default values for the queue depth, the file block size used for direct
+ * I/O and the size of each request.  Application can set these values
+ * through the function H5Pset_fapl_iouring. */
+#define H5FD_IOURING_QUEUE_DEPTH_DEF    32
+#define H5FD_IOURING_BLOCK_SIZE_DEF     4096
+#define H5FD_IOURING_BUF_SIZE_DEF       (256 * 1024)
+
+H5_DLL hid_t H5FD_iouring_init(void);
+H5_DLL herr_t H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth,
+                        hbool_t direct, size_t block_size, size_t buf_size);
+H5_DLL herr_t H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth/*out*/,
+                        hbool_t *direct/*out*/, size_t *block_size/*out*/,
+                        size_t *buf_size/*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_PREAD && H5_HAVE_PWRITE */
+
+#endif
@@ -215,7 +215,9 @@ static const H5FD_class_t H5FD_log_g = {
     H5FD_log_truncate,				/*truncate		*/
     H5FD_log_lock,                              /*lock                  */
     H5FD_log_unlock,                            /*unlock                */
-    H5FD_FLMAP_DICHOTOMY			/*fl_map		*/
+    H5FD_FLMAP_DICHOTOMY,                       /*fl_map                */
+    NULL,                                       /*read_vector           */
+    NULL                                        /*write_vector          */
 };
 
 /* Declare a free list to manage the H5FD_log_t struct */
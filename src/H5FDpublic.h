@@ -301,6 +301,16 @@ typedef struct H5FD_class_t {
     herr_t  (*lock)(H5FD_t *file, hbool_t rw);
     herr_t  (*unlock)(H5FD_t *file);
     H5FD_mem_t fl_map[H5FD_MEM_NTYPES];
+    /* Optional vector I/O callbacks, NULL if the driver doesn't provide
+     * them.  Adding them changed the size of this struct, so drivers built
+     * as binaries against an older HDF5 must be rebuilt.
+     */
+    herr_t  (*read_vector)(H5FD_t *file, hid_t dxpl, uint32_t count,
+                           H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                           void *bufs[]/*out*/);
+    herr_t  (*write_vector)(H5FD_t *file, hid_t dxpl, uint32_t count,
+                            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                            const void *bufs[]);
 } H5FD_class_t;
 
 /* A free list is a singly-linked list of address/size pairs. */
@@ -327,6 +337,9 @@ struct H5FD_t {
     hsize_t             threshold;      /* Threshold for alignment  */
     hsize_t             alignment;      /* Allocation alignment     */
     hbool_t             paged_aggr;     /* Paged aggregation for file space is enabled or not */
+
+    /* Memory buffer hints */
+    size_t              mem_align;      /* Memory alignment which lets buffers bypass the driver's copy buffer (0 if none) */
 };
 
 /* Define enum for the source of file image callbacks */
@@ -379,6 +392,12 @@ H5_DLL herr_t H5FDread(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                        haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5FDwrite(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                         haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5FDread_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count,
+                              H5FD_mem_t types[], haddr_t addrs[],
+                              size_t sizes[], void *bufs[]/*out*/);
+H5_DLL herr_t H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count,
+                               H5FD_mem_t types[], haddr_t addrs[],
+                               size_t sizes[], const void *bufs[]);
 H5_DLL herr_t H5FDflush(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDtruncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDlock(H5FD_t *file, hbool_t rw);
@@ -120,6 +120,18 @@ typedef struct H5FD_sec2_t {
                                  HADDR_UNDEF==(A)+(Z) ||                    \
                                 (HDoff_t)((A)+(Z))<(HDoff_t)(A))
 
+/* Whether vector I/O can be done with preadv() / pwritev() */
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV) && defined(H5_HAVE_SYS_UIO_H)
+#define H5FD_SEC2_HAVE_IOV
+
+/* Max. # of iovec entries passed to a single preadv() / pwritev() call */
+#if defined(IOV_MAX) && IOV_MAX < 1024
+#define H5FD_SEC2_IOV_MAX   IOV_MAX
+#else
+#define H5FD_SEC2_IOV_MAX   1024
+#endif
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV && H5_HAVE_SYS_UIO_H */
+
 /* Prototypes */
 static herr_t H5FD_sec2_term(void);
 static H5FD_t *H5FD_sec2_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -135,6 +147,10 @@ static herr_t H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, hadd
             size_t size, void *buf);
 static herr_t H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD_sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD_sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t H5FD_sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_sec2_unlock(H5FD_t *_file);
@@ -171,7 +187,9 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD_sec2_truncate,         /* truncate             */
     H5FD_sec2_lock,             /* lock                 */
     H5FD_sec2_unlock,           /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    H5FD_sec2_read_vector,      /* read_vector          */
+    H5FD_sec2_write_vector      /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_sec2_t struct */
@@ -835,6 +853,292 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_write() */
 
+#ifdef H5FD_SEC2_HAVE_IOV
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_gather_iov
+ *
+ * Purpose:     Collects the run of pieces starting at *IDX that are
+ *              adjacent in the file into the IOV array, stopping when the
+ *              array is full or the run would exceed H5_POSIX_MAX_IO_BYTES.
+ *              Zero-sized pieces are skipped.  On return *IDX is the index
+ *              of the first piece not in the run.
+ *
+ * Return:      Number of iovec entries used
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__sec2_gather_iov(uint32_t count, const haddr_t addrs[],
+    const size_t sizes[], void * const bufs[], uint32_t *idx,
+    struct iovec *iov, size_t *nbytes)
+{
+    haddr_t     end = addrs[*idx];          /* End of the run in the file */
+    int         niov = 0;                   /* # of iovec entries used */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    *nbytes = 0;
+    while(*idx < count && niov < H5FD_SEC2_IOV_MAX && addrs[*idx] == end
+            && (*nbytes + sizes[*idx]) <= (size_t)H5_POSIX_MAX_IO_BYTES) {
+        if(sizes[*idx] > 0) {
+            iov[niov].iov_base = bufs[*idx];
+            iov[niov].iov_len = sizes[*idx];
+            niov++;
+        } /* end if */
+        end += sizes[*idx];
+        *nbytes += sizes[*idx];
+        (*idx)++;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(niov)
+} /* end H5FD__sec2_gather_iov() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_advance_iov
+ *
+ * Purpose:     Drops NBYTES from the front of the iovec array after a
+ *              partial transfer.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__sec2_advance_iov(struct iovec **iov, int *niov, size_t nbytes)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    while(nbytes > 0 && *niov > 0) {
+        if(nbytes >= (*iov)->iov_len) {
+            nbytes -= (*iov)->iov_len;
+            (*iov)++;
+            (*niov)--;
+        } /* end if */
+        else {
+            (*iov)->iov_base = (char *)(*iov)->iov_base + nbytes;
+            (*iov)->iov_len -= nbytes;
+            nbytes = 0;
+        } /* end else */
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__sec2_advance_iov() */
+#endif /* H5FD_SEC2_HAVE_IOV */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_read_vector
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE.  Piece I is SIZES[I]
+ *              bytes at address ADDRS[I], read into BUFS[I].
+ *
+ *              Pieces that are adjacent in the file are read with a
+ *              single preadv() call, which also avoids the seek that
+ *              H5FD_sec2_read() needs.  Without preadv() the pieces are
+ *              read one at a time.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in the caller-
+ *                          supplied buffers.
+ *              Failure:    FAIL, Contents of the buffers are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+    uint32_t        u;                                      /* Local index variable */
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addrs[u])
+    } /* end for */
+
+#ifdef H5FD_SEC2_HAVE_IOV
+    u = 0;
+    while(u < count) {
+        struct iovec    iov_buf[H5FD_SEC2_IOV_MAX];     /* I/O vector for the run */
+        struct iovec    *iov = iov_buf;                 /* Remaining part of the vector */
+        haddr_t         addr = addrs[u];                /* Current file address */
+        size_t          nbytes;                         /* # of bytes left in the run */
+        int             niov;                           /* # of iovec entries left */
+
+        /* A single piece too large for one system call goes through the
+         * scalar routine, which splits it up.
+         */
+        if(sizes[u] > (size_t)H5_POSIX_MAX_IO_BYTES) {
+            if(H5FD_sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read piece")
+            u++;
+            continue;
+        } /* end if */
+
+        niov = H5FD__sec2_gather_iov(count, addrs, sizes, bufs, &u, iov_buf, &nbytes);
+
+        /* Read data, being careful of interrupted system calls, partial
+         * results, and the end of the file.
+         */
+        while(nbytes > 0) {
+            h5_posix_io_ret_t   bytes_read      = -1;   /* # of bytes actually read */
+
+            do {
+                bytes_read = HDpreadv(file->fd, iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_read && EINTR == errno);
+
+            if(-1 == bytes_read) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', # of iovecs = %d, bytes left = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), niov, (unsigned long long)nbytes, (unsigned long long)addr);
+            } /* end if */
+
+            if(0 == bytes_read) {
+                /* end of file but not end of format address space */
+                while(niov > 0) {
+                    HDmemset(iov->iov_base, 0, iov->iov_len);
+                    iov++;
+                    niov--;
+                } /* end while */
+                break;
+            } /* end if */
+
+            HDassert((size_t)bytes_read <= nbytes);
+
+            nbytes -= (size_t)bytes_read;
+            addr += (haddr_t)bytes_read;
+            H5FD__sec2_advance_iov(&iov, &niov, (size_t)bytes_read);
+        } /* end while */
+    } /* end while */
+#else /* H5FD_SEC2_HAVE_IOV */
+    for(u = 0; u < count; u++)
+        if(H5FD_sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read piece")
+#endif /* H5FD_SEC2_HAVE_IOV */
+
+done:
+    if(ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_write_vector
+ *
+ * Purpose:     Writes COUNT pieces of data to FILE.  Piece I is SIZES[I]
+ *              bytes from BUFS[I], written at address ADDRS[I].
+ *
+ *              Pieces that are adjacent in the file are written with a
+ *              single pwritev() call.  Without pwritev() the pieces are
+ *              written one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+    uint32_t        u;                                      /* Local index variable */
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+    } /* end for */
+
+#ifdef H5FD_SEC2_HAVE_IOV
+    u = 0;
+    while(u < count) {
+        struct iovec    iov_buf[H5FD_SEC2_IOV_MAX];     /* I/O vector for the run */
+        struct iovec    *iov = iov_buf;                 /* Remaining part of the vector */
+        haddr_t         addr = addrs[u];                /* Current file address */
+        size_t          nbytes;                         /* # of bytes left in the run */
+        int             niov;                           /* # of iovec entries left */
+
+        /* A single piece too large for one system call goes through the
+         * scalar routine, which splits it up.
+         */
+        if(sizes[u] > (size_t)H5_POSIX_MAX_IO_BYTES) {
+            if(H5FD_sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write piece")
+            u++;
+            continue;
+        } /* end if */
+
+        niov = H5FD__sec2_gather_iov(count, addrs, sizes, (void * const *)bufs, &u, iov_buf, &nbytes);
+
+        /* Write the data, being careful of interrupted system calls and
+         * partial results
+         */
+        while(nbytes > 0) {
+            h5_posix_io_ret_t   bytes_wrote     = -1;   /* # of bytes written   */
+
+            do {
+                bytes_wrote = HDpwritev(file->fd, iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_wrote && EINTR == errno);
+
+            if(-1 == bytes_wrote) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', # of iovecs = %d, bytes left = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), niov, (unsigned long long)nbytes, (unsigned long long)addr);
+            } /* end if */
+
+            HDassert(bytes_wrote > 0);
+            HDassert((size_t)bytes_wrote <= nbytes);
+
+            nbytes -= (size_t)bytes_wrote;
+            addr += (haddr_t)bytes_wrote;
+            H5FD__sec2_advance_iov(&iov, &niov, (size_t)bytes_wrote);
+        } /* end while */
+
+        /* Update eof */
+        if(addr > file->eof)
+            file->eof = addr;
+    } /* end while */
+#else /* H5FD_SEC2_HAVE_IOV */
+    for(u = 0; u < count; u++)
+        if(H5FD_sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write piece")
+#endif /* H5FD_SEC2_HAVE_IOV */
+
+done:
+    if(ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_sec2_truncate
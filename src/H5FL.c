@@ -97,6 +97,15 @@ typedef struct H5FL_blk_gc_list_t {
 /* The head of the list of PQs to garbage collect */
 static H5FL_blk_gc_list_t H5FL_blk_gc_head={0,NULL};
 
+/* Information stored just in front of an aligned block, to locate the
+ * underlying block when the aligned block is released or resized.
+ */
+typedef struct H5FL_blk_align_t {
+    void *block;                /* Underlying (unaligned) block */
+    size_t size;                /* Size requested for the aligned block */
+    size_t align;               /* Alignment of the aligned block */
+} H5FL_blk_align_t;
+
 /* A garbage collection node for factory free lists */
 struct H5FL_fac_gc_node_t {
     H5FL_fac_head_t *list;              /* Pointer to the head of the list to garbage collect */
@@ -1175,6 +1184,150 @@ done:
 } /* end H5FL_blk_realloc() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_blk_malloc_aligned
+ *
+ * Purpose:	Allocates memory for a block whose first byte is aligned on
+ *      an ALIGN byte boundary in memory, for buffers which may be handed
+ *      directly to file drivers that require aligned memory (for example
+ *      the O_DIRECT driver).  The block is carved out of a larger block
+ *      from the HEAD free list (or from malloc() when HEAD is NULL) and
+ *      must be released with H5FL_blk_free_aligned().  An ALIGN of 0 or 1
+ *      requests no particular alignment.
+ *
+ * Return:	Success:	valid pointer to the aligned block
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5FL_blk_malloc_aligned(H5FL_blk_head_t *head, size_t size, size_t align H5FL_TRACK_PARAMS)
+{
+    H5FL_blk_align_t info;      /* Information about the underlying block */
+    size_t misalign;            /* Distance past the previous aligned address */
+    unsigned char *aligned;     /* Aligned block to return */
+    void *ret_value = NULL;     /* Pointer to the block to return to the user */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Double check parameters */
+    HDassert(size);
+
+    if(align < 1)
+        align = 1;
+
+    /* Allocate enough space for the information header and the padding */
+    info.size = size;
+    info.align = align;
+    if(head)
+        info.block = H5FL_blk_malloc(head, size + sizeof(H5FL_blk_align_t) + (align - 1) H5FL_TRACK_INFO_INT);
+    else
+        info.block = H5MM_malloc(size + sizeof(H5FL_blk_align_t) + (align - 1));
+    if(NULL == info.block)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for aligned block")
+
+    /* Move up to the next aligned address past the information header */
+    aligned = (unsigned char *)info.block + sizeof(H5FL_blk_align_t);
+    if(0 != (misalign = (size_t)aligned % align))
+        aligned += align - misalign;
+
+    /* The header may not be suitably aligned for the structure, so copy it */
+    HDmemcpy(aligned - sizeof(H5FL_blk_align_t), &info, sizeof(H5FL_blk_align_t));
+
+    ret_value = aligned;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL_blk_malloc_aligned() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_blk_free_aligned
+ *
+ * Purpose:	Releases memory for a block allocated with
+ *      H5FL_blk_malloc_aligned(), returning the underlying block to the
+ *      HEAD free list (or to free() when HEAD is NULL).
+ *
+ * Return:	Success:	NULL
+ *
+ *		Failure:	never fails
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5FL_blk_free_aligned(H5FL_blk_head_t *head, void *block)
+{
+    H5FL_blk_align_t info;      /* Information about the underlying block */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Double check parameters */
+    HDassert(block);
+
+    /* Locate the underlying block and release it */
+    HDmemcpy(&info, (unsigned char *)block - sizeof(H5FL_blk_align_t), sizeof(H5FL_blk_align_t));
+    if(head)
+        H5FL_blk_free(head, info.block);
+    else
+        H5MM_xfree(info.block);
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5FL_blk_free_aligned() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_blk_realloc_aligned
+ *
+ * Purpose:	Resizes a block allocated with H5FL_blk_malloc_aligned(),
+ *      keeping the contents up to the smaller of the two sizes.  An ALIGN
+ *      of 0 keeps the alignment the block was allocated with.  A NULL
+ *      BLOCK just allocates a fresh aligned block.
+ *
+ * Return:	Success:	valid pointer to the aligned block
+ *
+ *		Failure:	NULL (the original block is not released)
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5FL_blk_realloc_aligned(H5FL_blk_head_t *head, void *block, size_t new_size, size_t align H5FL_TRACK_PARAMS)
+{
+    void *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Double check parameters */
+    HDassert(new_size);
+
+    if(block != NULL) {
+        H5FL_blk_align_t info;      /* Information about the underlying block */
+
+        HDmemcpy(&info, (unsigned char *)block - sizeof(H5FL_blk_align_t), sizeof(H5FL_blk_align_t));
+
+        /* Keep the block's alignment, unless another one was requested */
+        if(0 == align)
+            align = info.align;
+
+        /* Check if we are actually changing the block */
+        if(new_size != info.size || align != info.align) {
+            if(NULL == (ret_value = H5FL_blk_malloc_aligned(head, new_size, align H5FL_TRACK_INFO_INT)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for block")
+            HDmemcpy(ret_value, block, MIN(new_size, info.size));
+            H5FL_blk_free_aligned(head, block);
+        } /* end if */
+        else
+            ret_value = block;
+    } /* end if */
+    /* Not re-allocating, just allocate a fresh block */
+    else
+        ret_value = H5FL_blk_malloc_aligned(head, new_size, align H5FL_TRACK_INFO_INT);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL_blk_realloc_aligned() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5FL__blk_gc_list
  *
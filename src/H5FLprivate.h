@@ -204,6 +204,11 @@ typedef struct H5FL_blk_head_t {
 /* Check if there is a free block available to re-use */
 #define H5FL_BLK_AVAIL(t,size)  H5FL_blk_free_block_avail(&(H5FL_BLK_NAME(t)),size)
 
+/* Allocate, free & re-allocate a block of type 't' whose start is aligned in memory */
+#define H5FL_BLK_MALLOC_ALIGNED(t,size,align) (uint8_t *)H5FL_blk_malloc_aligned(&(H5FL_BLK_NAME(t)),size,align H5FL_TRACK_INFO)
+#define H5FL_BLK_FREE_ALIGNED(t,blk) (uint8_t *)H5FL_blk_free_aligned(&(H5FL_BLK_NAME(t)),blk)
+#define H5FL_BLK_REALLOC_ALIGNED(t,blk,new_size,align) (uint8_t *)H5FL_blk_realloc_aligned(&(H5FL_BLK_NAME(t)),blk,new_size,align H5FL_TRACK_INFO)
+
 #else /* H5_NO_BLK_FREE_LISTS */
 /* Common macro for H5FL_BLK_DEFINE & H5FL_BLK_DEFINE_STATIC */
 #define H5FL_BLK_DEFINE_COMMON(t) int H5_ATTR_UNUSED H5FL_BLK_NAME(t)
@@ -216,6 +221,9 @@ typedef struct H5FL_blk_head_t {
 #define H5FL_BLK_FREE(t,blk) (uint8_t *)H5MM_xfree(blk)
 #define H5FL_BLK_REALLOC(t,blk,new_size) (uint8_t *)H5MM_realloc(blk,new_size)
 #define H5FL_BLK_AVAIL(t,size)  (FALSE)
+#define H5FL_BLK_MALLOC_ALIGNED(t,size,align) (uint8_t *)H5FL_blk_malloc_aligned(NULL,size,align H5FL_TRACK_INFO)
+#define H5FL_BLK_FREE_ALIGNED(t,blk) (uint8_t *)H5FL_blk_free_aligned(NULL,blk)
+#define H5FL_BLK_REALLOC_ALIGNED(t,blk,new_size,align) (uint8_t *)H5FL_blk_realloc_aligned(NULL,blk,new_size,align H5FL_TRACK_INFO)
 #endif /* H5_NO_BLK_FREE_LISTS */
 
 /* Data structure to store each array in free list */
@@ -393,6 +401,9 @@ H5_DLL void * H5FL_blk_calloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARA
 H5_DLL void * H5FL_blk_free(H5FL_blk_head_t *head, void *block);
 H5_DLL void * H5FL_blk_realloc(H5FL_blk_head_t *head, void *block, size_t new_size H5FL_TRACK_PARAMS);
 H5_DLL htri_t H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size);
+H5_DLL void * H5FL_blk_malloc_aligned(H5FL_blk_head_t *head, size_t size, size_t align H5FL_TRACK_PARAMS);
+H5_DLL void * H5FL_blk_free_aligned(H5FL_blk_head_t *head, void *block);
+H5_DLL void * H5FL_blk_realloc_aligned(H5FL_blk_head_t *head, void *block, size_t new_size, size_t align H5FL_TRACK_PARAMS);
 
 /* Regular free lists */
 H5_DLL void * H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS);
@@ -133,6 +133,7 @@ typedef struct H5FS_sinfo_t {
 /* Computed/cached values */
     hbool_t dirty;              /* Whether this info in memory is out of sync w/info in file */
     unsigned nbins;             /* Number of bins                             */
+    uint64_t bin_map;           /* Bit set for each bin holding sections      */
     size_t serial_size;         /* Total size of all serializable sections    */
     size_t tot_size_count;      /* Total number of differently sized sections */
     size_t serial_size_count;   /* Total number of differently sized serializable sections */
@@ -145,6 +145,7 @@ HDfprintf(stderr, "%s: fspace->addr = %a\n", FUNC, fspace->addr);
 
     /* Set non-zero values */
     sinfo->nbins = H5VM_log2_gen(fspace->max_sect_size);
+    HDassert(sinfo->nbins <= 64);       /* (One bit per bin in bin_map) */
     sinfo->sect_prefix_size = H5FS_SINFO_PREFIX_SIZE(f);
     sinfo->sect_off_size = (fspace->max_sect_addr + 7) / 8;
     sinfo->sect_len_size = H5VM_limit_enc_size((uint64_t)fspace->max_sect_size);
@@ -678,6 +679,10 @@ H5FS_size_node_decr(H5FS_sinfo_t *sinfo, unsigned bin, H5FS_node_t *fspace_node,
 HDfprintf(stderr, "%s: sinfo->bins[%u].sect_count = %Zu\n", FUNC, bin, sinfo->bins[bin].sect_count);
 #endif /* QAK */
 
+    /* Check for the bin becoming empty */
+    if(sinfo->bins[bin].tot_sect_count == 0)
+        sinfo->bin_map &= ~((uint64_t)1 << bin);
+
     /* Check for 'ghost' or 'serializable' section */
     if(cls->flags & H5FS_CLS_GHOST_OBJ) {
         /* Decrement node's ghost section count */
@@ -998,6 +1003,7 @@ HDfprintf(stderr, "%s: sect->size = %Hu, sect->addr = %a\n", FUNC, sect->size, s
 HDfprintf(stderr, "%s: sinfo->bins[%u].sect_count = %Zu\n", FUNC, bin, sinfo->bins[bin].sect_count);
 #endif /* QAK */
     sinfo->bins[bin].tot_sect_count++;
+    sinfo->bin_map |= (uint64_t)1 << bin;
     if(cls->flags & H5FS_CLS_GHOST_OBJ) {
         sinfo->bins[bin].ghost_sect_count++;
         fspace_node->ghost_count++;
@@ -1640,6 +1646,11 @@ done:
  * Purpose:     Locate a section of free space (in existing free space list
  *              bins) that is large enough to fulfill request.
  *
+ *              Each bin holds the sections of one power-of-two size class.
+ *              Empty bins are skipped using the section info's bin map,
+ *              and the smallest section of a larger class is taken directly,
+ *              so only the request's own class is searched by size.
+ *
  * Return:      SUCCEED/FAIL
  *
  * Programmer:  Quincey Koziol
@@ -1652,6 +1663,8 @@ H5FS_sect_find_node(H5FS_t *fspace, hsize_t request, H5FS_section_info_t **node)
 {
     H5FS_node_t *fspace_node;        /* Free list size node */
     unsigned bin;                   /* Bin to put the free space section in */
+    unsigned req_bin;               /* Bin for sections of the request's size */
+    uint64_t bin_map;               /* Bins left to search */
     htri_t ret_value = FALSE;       /* Return value */
 
     H5SL_node_t *curr_size_node=NULL;
@@ -1668,27 +1681,43 @@ H5FS_sect_find_node(H5FS_t *fspace, hsize_t request, H5FS_section_info_t **node)
     HDassert(node);
 
     /* Determine correct bin which holds items of at least the section's size */
-    bin = H5VM_log2_gen(request);
-    HDassert(bin < fspace->sinfo->nbins);
+    req_bin = H5VM_log2_gen(request);
+    HDassert(req_bin < fspace->sinfo->nbins);
 #ifdef QAK
 HDfprintf(stderr, "%s: fspace->sinfo->nbins = %u\n", FUNC, fspace->sinfo->nbins);
-HDfprintf(stderr, "%s: bin = %u\n", FUNC, bin);
+HDfprintf(stderr, "%s: req_bin = %u\n", FUNC, req_bin);
 #endif /* QAK */
     alignment = fspace->alignment;
     if(!((alignment > 1) && (request >= fspace->align_thres)))
         alignment = 0; /* no alignment */
 
-    do {
+    /* Only visit the bins holding sections, from the request's bin up */
+    bin_map = fspace->sinfo->bin_map & ~(((uint64_t)1 << req_bin) - 1);
+    while(bin_map) {
+        /* Get the lowest bin left, and take it off the map */
+        bin = H5VM_log2_gen(bin_map & (~bin_map + 1));
+        bin_map &= bin_map - 1;
+        HDassert(bin < fspace->sinfo->nbins);
+
         /* Check if there's any sections in this bin */
         if(fspace->sinfo->bins[bin].bin_list) {
 
             if (!alignment) { /* no alignment */
                 /* Find the first free space section that is large enough to fulfill request */
                 /* (Since the bins use skip lists to track the sizes of the address-ordered
-                 *  lists, this is actually a "best fit" algorithm)
+                 *  lists, this is actually a "best fit" algorithm.  All the sections
+                 *  in a bin above the request's one are large enough, so the
+                 *  smallest of them is taken without searching the bin)
                  */
                 /* Look for large enough free space section in this bin */
-                if((fspace_node = (H5FS_node_t *)H5SL_greater(fspace->sinfo->bins[bin].bin_list, &request))) {
+                if(bin == req_bin)
+                    fspace_node = (H5FS_node_t *)H5SL_greater(fspace->sinfo->bins[bin].bin_list, &request);
+                else {
+                    curr_size_node = H5SL_first(fspace->sinfo->bins[bin].bin_list);
+                    HDassert(curr_size_node);
+                    fspace_node = (H5FS_node_t *)H5SL_item(curr_size_node);
+                } /* end else */
+                if(fspace_node) {
                     /* Take first node off of the list (ie. node w/lowest address) */
                     if(NULL == (*node = (H5FS_section_info_t *)H5SL_remove_first(fspace_node->sect_list)))
                         HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL, "can't remove free space node from skip list")
@@ -1774,9 +1803,7 @@ HDfprintf(stderr, "%s: bin = %u\n", FUNC, bin);
                 } /* end while of curr_size_node */
             }  /* else of alignment */
         } /* if bin_list */
-        /* Advance to next larger bin */
-        bin++;
-    } while(bin < fspace->sinfo->nbins);
+    } /* end while */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2235,6 +2262,9 @@ HDfprintf(stderr, "%s: fspace->tot_sect_count = %Hu\n", "H5FS__sect_assert", fsp
         acc_serial_size_count = 0;
         acc_ghost_size_count = 0;
         for(u = 0; u < fspace->sinfo->nbins; u++) {
+            /* Check that the bin map matches the bin */
+            HDassert((uint64_t)(fspace->sinfo->bins[u].tot_sect_count > 0) == ((fspace->sinfo->bin_map >> u) & 1));
+
             acc_tot_sect_count += fspace->sinfo->bins[u].tot_sect_count;
             acc_serial_sect_count += fspace->sinfo->bins[u].serial_sect_count;
             acc_ghost_sect_count += fspace->sinfo->bins[u].ghost_sect_count;
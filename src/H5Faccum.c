@@ -38,6 +38,7 @@
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fpkg.h"             /* File access				*/
 #include "H5FDprivate.h"	/* File drivers				*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 
@@ -50,6 +51,11 @@
 #define H5F_ACCUM_THRESHOLD     2048
 #define H5F_ACCUM_MAX_SIZE      (1024 *1024) /* Max. accum. buf size (max. I/Os will be 1/2 this size) */
 
+/* Check if a block of the file adjoins or overlaps an accumulator region */
+#define H5F_ACCUM_TOUCHES(A, ADDR, SIZE)                                    \
+    ((A)->size > 0 && (H5F_addr_overlap((ADDR), (SIZE), (A)->loc, (A)->size) \
+        || ((ADDR) + (SIZE)) == (A)->loc || ((A)->loc + (A)->size) == (ADDR)))
+
 
 /******************/
 /* Local Typedefs */
@@ -70,6 +76,12 @@ typedef enum {
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5F__accum_select(H5F_t *f, haddr_t addr, size_t size,
+    hbool_t swap, hbool_t park);
+static herr_t H5F__accum_free_region(H5F_meta_accum_t *accum, H5FD_t *file,
+    H5FD_mem_t type, haddr_t addr, hsize_t size);
+static herr_t H5F__accum_flush_regions(H5F_t *f, hbool_t flush_main);
+static int H5F__accum_region_cmp(const void *_r1, const void *_r2);
 
 
 /*********************/
@@ -90,6 +102,115 @@ typedef enum {
 H5FL_BLK_DEFINE_STATIC(meta_accum);
 
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_select
+ *
+ * Purpose:	Prepare the metadata accumulator regions for an I/O
+ *		request, when the file uses more than one region.
+ *
+ *		When SWAP is set and the request doesn't adjoin or overlap
+ *		the main accumulator, a region that it does touch is swapped
+ *		into the main accumulator, so the usual single-region code
+ *		can combine the request with it.  Any other region that
+ *		overlaps the request is flushed and emptied, so regions never
+ *		hold two copies of the same bytes.
+ *
+ *		When PARK is set and the main accumulator is dirty but still
+ *		doesn't touch the request, the main accumulator is moved into
+ *		a free region instead of being written out.  When all regions
+ *		are dirty, they are flushed in address order first.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_select(H5F_t *f, haddr_t addr, size_t size, hbool_t swap,
+    hbool_t park)
+{
+    H5F_meta_accum_t *accum = &f->shared->accum; /* Alias for file's metadata accumulator */
+    H5F_meta_accum_t *regions = f->shared->accum_regions; /* Alias for additional regions */
+    H5F_meta_accum_t tmp_accum;         /* Temporary region info, for swapping */
+    unsigned    nregions;               /* Number of additional regions */
+    hbool_t     touches;                /* Whether the main accumulator touches the request */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f->shared->accum_nregions > 1);
+    HDassert(f->shared->accum_nregions <= H5F_ACCUM_MAX_REGIONS);
+
+    nregions = f->shared->accum_nregions - 1;
+    touches = H5F_ACCUM_TOUCHES(accum, addr, size);
+
+    /* Look for regions touched by the request */
+    if(regions)
+        for(u = 0; u < nregions; u++) {
+            H5F_meta_accum_t *region = &regions[u];     /* Current region */
+
+            if(swap && !touches && H5F_ACCUM_TOUCHES(region, addr, size)) {
+                /* Make this region the main accumulator */
+                tmp_accum = *accum;
+                *accum = *region;
+                *region = tmp_accum;
+                touches = TRUE;
+            } /* end if */
+            else if(region->size > 0 && H5F_addr_overlap(addr, size, region->loc, region->size)) {
+                /* Write out the region's dirty information */
+                if(region->dirty) {
+                    if(H5FD_write(f->shared->lf, H5FD_MEM_DEFAULT, region->loc + region->dirty_off, region->dirty_len, region->buf + region->dirty_off) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                    region->dirty = FALSE;
+                } /* end if */
+
+                /* Empty the region, but keep its buffer */
+                region->loc = HADDR_UNDEF;
+                region->size = 0;
+            } /* end if */
+        } /* end for */
+
+    /* Move a dirty main accumulator out of the way of the request */
+    if(park && !touches && accum->dirty) {
+        unsigned slot = nregions;       /* Region to move the main accumulator into */
+
+        /* Allocate the additional regions on first use */
+        if(NULL == regions) {
+            if(NULL == (regions = (H5F_meta_accum_t *)H5MM_calloc(nregions * sizeof(H5F_meta_accum_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate metadata accumulator regions")
+            for(u = 0; u < nregions; u++)
+                regions[u].loc = HADDR_UNDEF;
+            f->shared->accum_regions = regions;
+        } /* end if */
+
+        /* Prefer an empty region, then a clean one */
+        for(u = 0; u < nregions && slot == nregions; u++)
+            if(regions[u].size == 0)
+                slot = u;
+        for(u = 0; u < nregions && slot == nregions; u++)
+            if(!regions[u].dirty)
+                slot = u;
+
+        /* All the regions are dirty, write them out */
+        if(slot == nregions) {
+            if(H5F__accum_flush_regions(f, FALSE) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "can't flush metadata accumulator regions")
+            slot = 0;
+        } /* end if */
+
+        /* Swap the main accumulator with the free region */
+        tmp_accum = *accum;
+        *accum = regions[slot];
+        regions[slot] = tmp_accum;
+        HDassert(!accum->dirty);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_select() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_read
@@ -132,6 +253,11 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
         /* Set up alias for file's metadata accumulator info */
         accum = &f->shared->accum;
 
+        /* Pick the accumulator region for the read, when there are several */
+        if(f->shared->accum_nregions > 1)
+            if(H5F__accum_select(f, addr, size, (hbool_t)(size < H5F_ACCUM_MAX_SIZE), FALSE) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "can't select metadata accumulator region")
+
         if(size < H5F_ACCUM_MAX_SIZE) {
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
@@ -441,6 +567,11 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
         /* Set up alias for file's metadata accumulator info */
         accum = &f->shared->accum;
 
+        /* Pick the accumulator region for the write, when there are several */
+        if(f->shared->accum_nregions > 1)
+            if(H5F__accum_select(f, addr, size, (hbool_t)(size < H5F_ACCUM_MAX_SIZE), (hbool_t)(size < H5F_ACCUM_MAX_SIZE)) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "can't select metadata accumulator region")
+
         if(size < H5F_ACCUM_MAX_SIZE) {
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
@@ -781,9 +912,13 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                         HDmemmove(accum->buf, accum->buf + overlap_size, accum->size);
                     } /* end if */
                     else {        /* Access covers whole accumulator */
-                        /* Reset accumulator, but don't flush */
-                        if(H5F__accum_reset(f, FALSE) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator")
+                        /* Drop the main accumulator's information, but
+                         * keep its buffer and the additional regions
+                         */
+                        accum->loc = HADDR_UNDEF;
+                        accum->size = 0;
+                        accum->dirty = FALSE;
+                        accum->dirty_len = 0;
                     } /* end else */
                 } /* end if */
                 else {  /* Write starts after beginning of accumulator */
@@ -832,10 +967,10 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5F__accum_free
+ * Function:    H5F__accum_free_region
  *
- * Purpose:     Check for free space invalidating [part of] a metadata
- *              accumulator.
+ * Purpose:     Check for free space invalidating [part of] one metadata
+ *              accumulator region.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -845,28 +980,20 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5F__accum_free(H5F_t *f, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
-    hsize_t size)
+static herr_t
+H5F__accum_free_region(H5F_meta_accum_t *accum, H5FD_t *file,
+    H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr, hsize_t size)
 {
-    H5F_meta_accum_t *accum;            /* Alias for file's metadata accumulator */
-    H5FD_t *file;                       /* File driver pointer */
     herr_t ret_value = SUCCEED;         /* Return value */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC
 
     /* check arguments */
-    HDassert(f);
-
-    /* Set up alias for file's metadata accumulator info */
-    accum = &f->shared->accum;
-
-    /* Translate to file driver pointer */
-    file = f->shared->lf;
+    HDassert(accum);
+    HDassert(file);
 
     /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
-    if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
-            && H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
+    if(H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
         size_t overlap_size;        /* Size of overlap with accumulator */
 
         /* Sanity check */
@@ -993,6 +1120,50 @@ H5F__accum_free(H5F_t *f, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
         } /* end else */
     } /* end if */
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_free_region() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_free
+ *
+ * Purpose:     Check for free space invalidating [part of] the metadata
+ *              accumulator regions.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Quincey Koziol
+ *              koziol@hdfgroup.org
+ *              Jan 10 2008
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__accum_free(H5F_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check arguments */
+    HDassert(f);
+
+    if(f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) {
+        /* Adjust the main accumulator */
+        if(H5F__accum_free_region(&f->shared->accum, f->shared->lf, type, addr, size) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "can't remove freed block from metadata accumulator")
+
+        /* Adjust the additional regions */
+        if(f->shared->accum_regions) {
+            unsigned u;         /* Local index variable */
+
+            for(u = 0; u < (f->shared->accum_nregions - 1); u++)
+                if(H5F__accum_free_region(&f->shared->accum_regions[u], f->shared->lf, type, addr, size) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "can't remove freed block from metadata accumulator")
+        } /* end if */
+    } /* end if */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_free() */
@@ -1021,6 +1192,11 @@ H5F__accum_flush(H5F_t *f)
     /* Sanity checks */
     HDassert(f);
 
+    /* Flush the additional regions along with the main accumulator */
+    if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f->shared->accum_regions)
+        if(H5F__accum_flush_regions(f, TRUE) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "can't flush metadata accumulator regions")
+
     /* Check if we need to flush out the metadata accumulator */
     if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f->shared->accum.dirty) {
         H5FD_t *file;                       /* File driver pointer */
@@ -1044,7 +1220,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_reset
  *
- * Purpose:	Reset the metadata accumulator for the file
+ * Purpose:	Reset the metadata accumulator for the file, releasing
+ *		the main accumulator and any additional regions.  Unless
+ *		FLUSH is set, dirty information in all of them is discarded.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1083,9 +1261,103 @@ H5F__accum_reset(H5F_t *f, hbool_t flush)
         f->shared->accum.loc = HADDR_UNDEF;
         f->shared->accum.dirty = FALSE;
         f->shared->accum.dirty_len = 0;
+
+        /* Release the additional regions */
+        if(f->shared->accum_regions) {
+            unsigned u;         /* Local index variable */
+
+            /* (Like the main accumulator, any dirty information they
+             *  still hold is discarded when not flushed above)
+             */
+            for(u = 0; u < (f->shared->accum_nregions - 1); u++) {
+                HDassert(!f->closing || FALSE == f->shared->accum_regions[u].dirty);
+                if(f->shared->accum_regions[u].buf)
+                    f->shared->accum_regions[u].buf = H5FL_BLK_FREE(meta_accum, f->shared->accum_regions[u].buf);
+            } /* end for */
+            f->shared->accum_regions = (H5F_meta_accum_t *)H5MM_xfree(f->shared->accum_regions);
+        } /* end if */
     } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_reset() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_flush_regions
+ *
+ * Purpose:	Write out the dirty metadata accumulator regions in
+ *		address order, including the main accumulator when
+ *		FLUSH_MAIN is set.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_flush_regions(H5F_t *f, hbool_t flush_main)
+{
+    H5F_meta_accum_t *sorted[H5F_ACCUM_MAX_REGIONS];   /* Dirty regions, in address order */
+    size_t      nsorted = 0;            /* Number of dirty regions */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared->accum_nregions <= H5F_ACCUM_MAX_REGIONS);
+
+    /* Gather the dirty regions */
+    if(flush_main && f->shared->accum.dirty)
+        sorted[nsorted++] = &f->shared->accum;
+    if(f->shared->accum_regions)
+        for(u = 0; u < (f->shared->accum_nregions - 1); u++)
+            if(f->shared->accum_regions[u].dirty)
+                sorted[nsorted++] = &f->shared->accum_regions[u];
+
+    /* Regions never overlap, so sorting on their location is enough */
+    if(nsorted > 1)
+        HDqsort(sorted, nsorted, sizeof(H5F_meta_accum_t *), H5F__accum_region_cmp);
+
+    for(u = 0; u < nsorted; u++) {
+        /* Write out the dirty information, with dispatch to driver */
+        if(H5FD_write(f->shared->lf, H5FD_MEM_DEFAULT, sorted[u]->loc + sorted[u]->dirty_off, sorted[u]->dirty_len, sorted[u]->buf + sorted[u]->dirty_off) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+        /* Reset the dirty flag */
+        sorted[u]->dirty = FALSE;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_flush_regions() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_region_cmp
+ *
+ * Purpose:	Compare two metadata accumulator regions by file location,
+ *		for sorting with HDqsort.
+ *
+ * Return:	-1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5F__accum_region_cmp(const void *_r1, const void *_r2)
+{
+    const H5F_meta_accum_t *r1 = *(const H5F_meta_accum_t * const *)_r1;
+    const H5F_meta_accum_t *r2 = *(const H5F_meta_accum_t * const *)_r2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_lt(r1->loc, r2->loc))
+        ret_value = -1;
+    else if(H5F_addr_gt(r1->loc, r2->loc))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_region_cmp() */
+
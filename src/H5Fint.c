@@ -163,6 +163,8 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache size")
     if(H5P_set(new_plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't sieve buffer size")
+    if(H5P_set(new_plist, H5F_ACS_SIEVE_GAP_SIZE_NAME, &(f->shared->sieve_gap_size)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set sieve gap size")
     if(H5P_set(new_plist, H5F_ACS_SDATA_BLOCK_SIZE_NAME, &(f->shared->sdata_aggr.alloc_size)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set 'small data' cache size")
     if(H5P_set(new_plist, H5F_ACS_LIBVER_LOW_BOUND_NAME, &f->shared->low_bound) < 0)
@@ -185,7 +187,11 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set minimum metadata fraction of page buffer")
         if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &(f->shared->page_buf->min_raw_perc)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set minimum raw data fraction of page buffer")
+        if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, &(f->shared->page_buf->readahead)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set page buffer readahead")
     } /* end if */
+    if(H5P_set(new_plist, H5F_ACS_META_ACCUM_NREGIONS_NAME, &(f->shared->accum_nregions)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set # of metadata accumulator regions")
 #ifdef H5_HAVE_PARALLEL
     if(H5P_set(new_plist, H5_COLL_MD_READ_FLAG_NAME, &(f->coll_md_read)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set collective metadata read flag")
@@ -444,6 +450,7 @@ H5F_get_objects_cb(void *obj_ptr, hid_t obj_id, void *key)
             case H5I_ERROR_CLASS:
             case H5I_ERROR_MSG:
             case H5I_ERROR_STACK:
+            case H5I_DATASET_PLAN:
             case H5I_NTYPES:
             default:
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5_ITER_ERROR, "unknown or invalid data object")
@@ -930,6 +937,8 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get garbage collect reference")
         if(H5P_get(plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get sieve buffer size")
+        if(H5P_get(plist, H5F_ACS_SIEVE_GAP_SIZE_NAME, &(f->shared->sieve_gap_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get sieve gap size")
         if(H5P_get(plist, H5F_ACS_LIBVER_LOW_BOUND_NAME, &(f->shared->low_bound)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'low' bound for library format versions")
         if(H5P_get(plist, H5F_ACS_LIBVER_HIGH_BOUND_NAME, &(f->shared->high_bound)) < 0)
@@ -944,6 +953,8 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
         if(H5P_get(plist, H5F_ACS_SDATA_BLOCK_SIZE_NAME, &(f->shared->sdata_aggr.alloc_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'small data' cache size")
         f->shared->sdata_aggr.feature_flag = H5FD_FEAT_AGGREGATE_SMALLDATA;
+        if(H5P_get(plist, H5F_ACS_META_ACCUM_NREGIONS_NAME, &(f->shared->accum_nregions)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get # of metadata accumulator regions")
         if(H5P_get(plist, H5F_ACS_EFC_SIZE_NAME, &efc_size) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get elink file cache size")
         if(efc_size > 0)
@@ -1283,6 +1294,9 @@ H5F__dest(H5F_t *f, hbool_t flush)
         if(H5G_node_close(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if(H5G_link_cache_dest(f) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
 
         /* Destroy file creation properties */
         if(H5I_GENPROP_LST != H5I_get_type(f->shared->fcpl_id))
@@ -1489,6 +1503,8 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
     size_t              page_buf_size;
     unsigned            page_buf_min_meta_perc;
     unsigned            page_buf_min_raw_perc;
+    unsigned            page_buf_readahead;
+    hbool_t             page_buf_preload;
     hbool_t             set_flag = FALSE;   /*set the status_flags in the superblock */
     hbool_t             clear = FALSE;      /*clear the status_flags         */
     hbool_t             evict_on_close;     /* evict on close value from plist  */
@@ -1664,6 +1680,10 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum metadata fraction of page buffer")
         if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &page_buf_min_raw_perc) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum raw data fraction of page buffer")
+        if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, &page_buf_readahead) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get page buffer readahead")
+        if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_PRELOAD_NAME, &page_buf_preload) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get page buffer preloading")
     } /* end if */
 
     /*
@@ -1678,7 +1698,7 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
 
         /* Create the page buffer before initializing the superblock */
         if(page_buf_size)
-            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc, page_buf_readahead) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
         /* Initialize information about the superblock and allocate space for it */
@@ -1699,10 +1719,34 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
             HGOTO_ERROR(H5E_FILE, H5E_READERROR, NULL, "unable to read superblock")
 
         /* Create the page buffer before initializing the superblock */
-        if(page_buf_size)
-            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+        if(page_buf_size) {
+            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc, page_buf_readahead) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
+            /* When asked to, load the file's pages up front with a few
+             * large reads.  Otherwise, with readahead enabled, load the
+             * metadata pages the superblock points to in one go, instead
+             * of faulting them in one by one while the root group and
+             * free-space managers are opened.
+             */
+            if(page_buf_preload) {
+                if(H5PB_preload(file, H5FD_MEM_SUPER) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_READERROR, NULL, "unable to preload page buffer")
+            } /* end if */
+            else if(page_buf_readahead > 0) {
+                haddr_t prefetch_addrs[H5F_MEM_PAGE_NTYPES + 1];
+                size_t nprefetch = 0;
+                unsigned u;
+
+                prefetch_addrs[nprefetch++] = shared->sblock->root_addr;
+                prefetch_addrs[nprefetch++] = shared->sblock->ext_addr;
+                for(u = 1; u < H5F_MEM_PAGE_NTYPES; u++)
+                    prefetch_addrs[nprefetch++] = shared->fs_addr[u];
+                if(H5PB_prefetch(file, H5FD_MEM_OHDR, nprefetch, prefetch_addrs) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_READERROR, NULL, "unable to prefetch superblock metadata pages")
+            } /* end if */
+        } /* end if */
+
         /* Open the root group */
         if(H5G_mkroot(file, FALSE) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to read root group")
@@ -2659,6 +2703,31 @@ H5F_set_grp_btree_shared(H5F_t *f, H5UC_t *rc)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5F_set_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_grp_link_cache
+ *
+ * Purpose:     Set the grp_link_cache field.  The group code owns the
+ *              cache; NULL means there isn't one.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_set_grp_link_cache(H5F_t *f, struct H5G_link_cache_t *cache)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->grp_link_cache = cache;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5F_set_grp_link_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_sohm_addr
@@ -3684,3 +3753,59 @@ done:
     FUNC_LEAVE_NOAPI_VOL(ret_value)
 } /* H5F__format_convert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__set_page_buffer_size
+ *
+ * Purpose:     Private version of H5Fset_page_buffer_size
+ *
+ *              Resizes the page buffer of an open file, creating it if
+ *              the file has none yet, or flushing and destroying it
+ *              when SIZE is zero.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__set_page_buffer_size(H5F_t *f, size_t size, unsigned min_meta_perc,
+    unsigned min_raw_perc)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(0 == size) {
+        /* Disable page buffering, writing out the dirty pages */
+        if(f->shared->page_buf)
+            if(H5PB_dest(f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to destroy page buffer")
+    } /* end if */
+    else if(f->shared->page_buf) {
+        if(H5PB_resize(f, size, min_meta_perc, min_raw_perc) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTRESIZE, FAIL, "unable to resize page buffer")
+    } /* end else-if */
+    else {
+#ifdef H5_HAVE_PARALLEL
+        /* Page buffering is disabled for parallel, see H5F_open() */
+        if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+            HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "page buffering is disabled for parallel")
+#endif /* H5_HAVE_PARALLEL */
+
+        /* Small metadata I/O goes through the page buffer from now on,
+         * so the accumulator must not keep any of it.
+         */
+        if(H5F__accum_reset(f, TRUE) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTRESET, FAIL, "can't reset metadata accumulator")
+
+        if(H5PB_create(f, size, min_meta_perc, min_raw_perc, 0) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to create page buffer")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F__set_page_buffer_size() */
@@ -168,6 +168,156 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__block_vector_direct
+ *
+ * Purpose:	Checks whether a vector of pieces can be handed straight to
+ *		the file driver, bypassing the page buffer and metadata
+ *		accumulator.  This is possible when there is no page
+ *		buffer, every piece is raw data and no piece touches the
+ *		metadata accumulator or its additional regions.  Also
+ *		maps the global heap type to raw data and checks each
+ *		piece against the temporary file space.
+ *
+ * Return:	TRUE/FALSE/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5F__block_vector_direct(const H5F_t *f, uint32_t count, H5FD_mem_t types[],
+    const haddr_t addrs[], const size_t sizes[])
+{
+    const H5F_meta_accum_t *accum = &f->shared->accum; /* Alias for file's metadata accumulator */
+    uint32_t    u;                      /* Local index variable */
+    htri_t      ret_value = TRUE;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for(u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+
+        /* Check for attempting I/O on 'temporary' file address */
+        if(H5F_addr_le(f->shared->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+        /* Treat global heap as raw data */
+        if(types[u] == H5FD_MEM_GHEAP)
+            types[u] = H5FD_MEM_DRAW;
+
+        if(types[u] != H5FD_MEM_DRAW)
+            ret_value = FALSE;
+        else if(accum->size > 0 && H5F_addr_overlap(addrs[u], sizes[u], accum->loc, accum->size))
+            ret_value = FALSE;
+        else if(f->shared->accum_regions) {
+            unsigned v;                 /* Local index variable */
+
+            /* Check the additional accumulator regions also */
+            for(v = 0; v < (f->shared->accum_nregions - 1); v++)
+                if(f->shared->accum_regions[v].size > 0 && H5F_addr_overlap(addrs[u], sizes[u], f->shared->accum_regions[v].loc, f->shared->accum_regions[v].size))
+                    ret_value = FALSE;
+        } /* end if */
+    } /* end for */
+
+    if(f->shared->page_buf)
+        ret_value = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__block_vector_direct() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_read_vector
+ *
+ * Purpose:	Reads COUNT pieces of data from a file/server/etc.  Piece
+ *		I is SIZES[I] bytes of type TYPES[I] at address ADDRS[I],
+ *		stored in BUFS[I].  The addresses are relative to the base
+ *		address.
+ *
+ *		Raw data that doesn't involve the page buffer or metadata
+ *		accumulator is passed to the file driver as one vector,
+ *		anything else is read one piece at a time.  The TYPES
+ *		array may be modified.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_read_vector(H5F_t *f, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/)
+{
+    htri_t      direct;                 /* Whether to go straight to the driver */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    if((direct = H5F__block_vector_direct(f, count, types, addrs, sizes)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "invalid I/O vector")
+
+    if(direct) {
+        if(H5FD_read_vector(f->shared->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(H5PB_read(f, types[u], addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_write_vector
+ *
+ * Purpose:	Writes COUNT pieces of data to a file/server/etc, with the
+ *		same conventions as H5F_block_read_vector().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_write_vector(H5F_t *f, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    htri_t      direct;                 /* Whether to go straight to the driver */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5F_INTENT(f) & H5F_ACC_RDWR);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    if((direct = H5F__block_vector_direct(f, count, types, addrs, sizes)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "invalid I/O vector")
+
+    if(direct) {
+        if(H5FD_write_vector(f->shared->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(H5PB_write(f, types[u], addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
@@ -297,6 +297,7 @@ struct H5F_file_t {
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
+    size_t      sieve_gap_size; /* Largest hole in a selection to read through with the sieve buffer (in bytes) */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
     unsigned	gc_ref;		/* Garbage-collect references?		*/
@@ -308,6 +309,7 @@ struct H5F_file_t {
     struct H5G_t *root_grp;	/* Open root group			*/
     H5FO_t *open_objs;          /* Open objects in file                 */
     H5UC_t *grp_btree_shared;   /* Ref-counted group B-tree node info   */
+    struct H5G_link_cache_t *grp_link_cache; /* Hard links found by name lookups */
 
     /* File space allocation information */
     H5F_fspace_strategy_t fs_strategy; /* File space handling strategy	*/
@@ -345,6 +347,8 @@ struct H5F_file_t {
 
     /* Metadata accumulator information */
     H5F_meta_accum_t accum;                 /* Metadata accumulator info */
+    unsigned    accum_nregions;             /* # of metadata accumulator regions, including 'accum' */
+    H5F_meta_accum_t *accum_regions;        /* Additional accumulator regions (accum_nregions - 1 of them) */
 
     /* Metadata retry info */
     unsigned 		read_attempts;	    /* The # of reads to try when reading metadata with checksum */
@@ -413,6 +417,8 @@ H5_DLL ssize_t H5F__get_free_sections(H5F_t *f, H5FD_mem_t type,
 H5_DLL herr_t H5F__get_metadata_read_retry_info(H5F_t *file, H5F_retry_info_t *info);
 H5_DLL herr_t H5F__format_convert(H5F_t *f);
 H5_DLL herr_t H5F__start_swmr_write(H5F_t *f);
+H5_DLL herr_t H5F__set_page_buffer_size(H5F_t *f, size_t size,
+    unsigned min_meta_perc, unsigned min_raw_perc);
 H5_DLL herr_t H5F__close(hid_t file_id);
 H5_DLL herr_t H5F__close_cb(H5F_t *f);
 H5_DLL herr_t H5F__set_libver_bounds(H5F_t *f, H5F_libver_t low, H5F_libver_t high);
@@ -249,6 +249,8 @@ H5_DLL herr_t H5Fget_mdc_config(hid_t file_id,
 H5_DLL herr_t H5Fset_mdc_config(hid_t file_id,
 				H5AC_cache_config_t * config_ptr);
 H5_DLL herr_t H5Fget_mdc_hit_rate(hid_t file_id, double * hit_rate_ptr);
+H5_DLL ssize_t H5Fget_mdc_type_stats(hid_t file_id, size_t nstats,
+    H5AC_cache_type_stats_t *stats/*out*/);
 H5_DLL herr_t H5Fget_mdc_size(hid_t file_id,
                               size_t * max_size_ptr,
                               size_t * min_clean_size_ptr,
@@ -272,6 +274,10 @@ H5_DLL herr_t H5Fformat_convert(hid_t fid);
 H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
 H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2],
     unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+H5_DLL herr_t H5Fprefetch_pages(hid_t file_id, H5F_mem_t type, size_t naddrs,
+    const haddr_t addrs[]);
+H5_DLL herr_t H5Fset_page_buffer_size(hid_t file_id, size_t buf_size,
+    unsigned min_meta_perc, unsigned min_raw_perc);
 H5_DLL herr_t H5Fget_mdc_image_info(hid_t file_id, haddr_t *image_addr, hsize_t *image_size);
 
 #ifdef H5_HAVE_PARALLEL
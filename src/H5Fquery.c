@@ -684,6 +684,29 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_grp_link_cache
+ *
+ * Purpose:  Retrieve the hard links cached by group name lookups in the
+ *           file.
+ *
+ * Return:   Success:    The link cache (NULL if none yet)
+ *           Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+struct H5G_link_cache_t *
+H5F_grp_link_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->grp_link_cache)
+} /* end H5F_grp_link_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_sieve_buf_size
@@ -709,6 +732,29 @@ H5F_sieve_buf_size(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->sieve_buf_size)
 } /* end H5F_sieve_buf_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_sieve_gap_size
+ *
+ * Purpose:  Retrieve the largest hole in a selection that the dataset
+ *           sieve buffer reads through.
+ *
+ * Return:   Success:    The sieve gap size
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_sieve_gap_size(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->sieve_gap_size)
+} /* end H5F_sieve_gap_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_gc_ref
@@ -828,6 +874,30 @@ H5F_has_feature(const H5F_t *f, unsigned feature)
     FUNC_LEAVE_NOAPI((hbool_t)(f->shared->lf->feature_flags&feature))
 } /* end H5F_has_feature() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_mem_align
+ *
+ * Purpose:  Retrieve the memory alignment which lets I/O buffers be
+ *           transferred by the file driver without an intermediate copy.
+ *
+ * Return:   Success:    The alignment in bytes, or 0 if the driver has
+ *                       no preference.
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_mem_align(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->lf->mem_align)
+} /* end H5F_mem_align() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_driver_id
@@ -988,6 +1058,54 @@ H5F_use_tmp_space(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->use_tmp_space)
 } /* end H5F_use_tmp_space() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_use_paged_aggr
+ *
+ * Purpose:  Quick and dirty routine to determine if the file uses paged
+ *           aggregation.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   TRUE/FALSE on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_use_paged_aggr(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(H5F_PAGED_AGGR(f) ? TRUE : FALSE)
+} /* end H5F_use_paged_aggr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_has_page_buf
+ *
+ * Purpose:  Quick and dirty routine to determine if the file has a page
+ *           buffer.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   TRUE/FALSE on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_has_page_buf(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->page_buf ? TRUE : FALSE)
+} /* end H5F_has_page_buf() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
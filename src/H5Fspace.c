@@ -165,6 +165,12 @@ H5F__free(H5F_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size)
     HDassert(type >= H5FD_MEM_DEFAULT && type < H5FD_MEM_NTYPES);
     HDassert(size > 0);
 
+    /* Freeing space may reduce the EOA, so write out any metadata cache
+     * entry images still staged for a batched write first
+     */
+    if(H5C_flush_write_batch(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write batched metadata cache entries")
+
     /* Call the file driver 'free' routine */
     if(H5FD_free(f->shared->lf, type, f, addr, size) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "file driver 'free' request failed")
@@ -39,12 +39,16 @@
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5Lprivate.h"         /* Links                                */
 #include "H5MMprivate.h"	/* Memory management			*/
+#include "H5PBprivate.h"	/* Page Buffer				*/
 
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Max. # of object headers prefetched for each group visited */
+#define H5G_VISIT_PREFETCH_NLINKS       512
+
 
 /******************/
 /* Local Typedefs */
@@ -76,6 +80,13 @@ typedef struct {
     void       *op_data;        /* Application's op data */
 } H5G_iter_visit_ud_t;
 
+/* User data for collecting the object addresses of a group's hard links */
+typedef struct {
+    haddr_t    *addrs;          /* Object header addresses */
+    size_t      naddrs;         /* # of addresses collected */
+    size_t      nalloc;         /* # of addresses allocated */
+} H5G_iter_prefetch_ud_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -87,6 +98,9 @@ typedef struct {
 /********************/
 
 static herr_t H5G__open_oid(H5G_t *grp);
+static herr_t H5G__visit_prefetch_cb(const H5O_link_t *lnk, void *_udata);
+static int H5G__visit_prefetch_cmp(const void *_addr1, const void *_addr2);
+static herr_t H5G__visit_prefetch(const H5O_loc_t *grp_oloc);
 
 
 /*********************/
@@ -927,6 +941,125 @@ H5G_free_visit_visited(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5G_free_visit_visited() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__visit_prefetch_cb
+ *
+ * Purpose:     Callback to collect the object addresses of hard links
+ *
+ * Return:      H5_ITER_CONT/H5_ITER_STOP on success, H5_ITER_ERROR on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__visit_prefetch_cb(const H5O_link_t *lnk, void *_udata)
+{
+    H5G_iter_prefetch_ud_t *udata = (H5G_iter_prefetch_ud_t *)_udata;  /* User data for callback */
+    herr_t ret_value = H5_ITER_CONT;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(lnk);
+    HDassert(udata);
+
+    if(lnk->type == H5L_TYPE_HARD) {
+        /* Make room for the address */
+        if(udata->naddrs == udata->nalloc) {
+            size_t new_nalloc = MAX(16, udata->nalloc * 2);
+            haddr_t *new_addrs;
+
+            if(NULL == (new_addrs = (haddr_t *)H5MM_realloc(udata->addrs, new_nalloc * sizeof(haddr_t))))
+                HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, H5_ITER_ERROR, "can't allocate address list")
+            udata->addrs = new_addrs;
+            udata->nalloc = new_nalloc;
+        } /* end if */
+
+        udata->addrs[udata->naddrs++] = lnk->u.hard.addr;
+        if(udata->naddrs == H5G_VISIT_PREFETCH_NLINKS)
+            ret_value = H5_ITER_STOP;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__visit_prefetch_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__visit_prefetch_cmp
+ *
+ * Purpose:     Compare two object addresses, for qsort
+ *
+ * Return:      -1, 0 or 1 as the first address is lower, equal or higher
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__visit_prefetch_cmp(const void *_addr1, const void *_addr2)
+{
+    haddr_t addr1 = *(const haddr_t *)_addr1;
+    haddr_t addr2 = *(const haddr_t *)_addr2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_lt(addr1, addr2) ? -1 : (H5F_addr_gt(addr1, addr2) ? 1 : 0))
+} /* end H5G__visit_prefetch_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__visit_prefetch
+ *
+ * Purpose:     Load the pages holding the object headers that a group's
+ *              hard links point to into the file's page buffer, before
+ *              the group's links are visited.  The headers are then read
+ *              with a few vector reads in address order, instead of one
+ *              read per object in link order.
+ *
+ *              Nothing is done for files without a page buffer.  Only the
+ *              first few hundred links of large groups are prefetched, so
+ *              the pages of one group don't push each other out of the
+ *              page buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__visit_prefetch(const H5O_loc_t *grp_oloc)
+{
+    H5G_iter_prefetch_ud_t udata;       /* User data for callback */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(grp_oloc && grp_oloc->file);
+
+    udata.addrs = NULL;
+    udata.naddrs = 0;
+    udata.nalloc = 0;
+
+    if(!H5F_has_page_buf(grp_oloc->file))
+        HGOTO_DONE(SUCCEED)
+
+    /* Collect the object addresses, in the group's cheapest order */
+    if(H5G__obj_iterate(grp_oloc, H5_INDEX_NAME, H5_ITER_NATIVE, (hsize_t)0, NULL, H5G__visit_prefetch_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't collect object addresses")
+
+    /* Load the object header pages, in address order */
+    if(udata.naddrs > 1) {
+        HDqsort(udata.addrs, udata.naddrs, sizeof(haddr_t), H5G__visit_prefetch_cmp);
+        if(H5PB_prefetch(grp_oloc->file, H5FD_MEM_OHDR, udata.naddrs, udata.addrs) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_READERROR, FAIL, "can't prefetch object headers")
+    } /* end if */
+
+done:
+    if(udata.addrs)
+        H5MM_xfree(udata.addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__visit_prefetch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_visit_cb
@@ -1068,6 +1201,10 @@ H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
                 /* Point to this group's location info */
                 udata->curr_loc = &obj_loc;
 
+                /* Load the headers of the group's objects ahead of the visit */
+                if(H5G__visit_prefetch(&obj_oloc) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_READERROR, H5_ITER_ERROR, "can't prefetch object headers")
+
                 /* Iterate over links in group */
                 ret_value = H5G__obj_iterate(&obj_oloc, idx_type, udata->order, (hsize_t)0, NULL, H5G_visit_cb, udata);
 
@@ -1216,6 +1353,10 @@ H5G_visit(hid_t loc_id, const char *group_name, H5_index_t idx_type,
             idx_type = H5_INDEX_NAME;
     } /* end if */
 
+    /* Load the headers of the group's objects ahead of the visit */
+    if(H5G__visit_prefetch(&(grp->oloc)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_READERROR, FAIL, "can't prefetch object headers")
+
     /* Call the link iteration routine */
     if((ret_value = H5G__obj_iterate(&(grp->oloc), idx_type, order, (hsize_t)0, NULL, H5G_visit_cb, &udata)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't visit links")
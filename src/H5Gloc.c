@@ -209,6 +209,9 @@ H5G_loc(hid_t loc_id, H5G_loc_t *loc)
         case H5I_DATASPACE:
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get group location of dataspace")
 
+        case H5I_DATASET_PLAN:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get group location of dataset I/O plan")
+
         case H5I_DATASET:
             {
                 H5D_t	*dset;
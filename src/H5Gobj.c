@@ -35,18 +35,23 @@
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fprivate.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Gpkg.h"		/* Groups		  		*/
 #include "H5HLprivate.h"	/* Local Heaps				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5Lprivate.h"         /* Links			  	*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Pprivate.h"         /* Property Lists			*/
+#include "H5SLprivate.h"	/* Skip lists				*/
 
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Max. # of hard links cached per file before the cache is emptied */
+#define H5G_LINK_CACHE_NLINKS_MAX       65536
+
 
 /******************/
 /* Local Typedefs */
@@ -77,6 +82,32 @@ typedef struct {
     const H5O_loc_t   *grp_oloc;              /* Pointer to group for insertion */
 } H5G_obj_stab_it_ud1_t;
 
+/* Hard link found by a name lookup in a group */
+typedef struct H5G_link_cache_ent_t {
+    char        *name;          /* Link name (key) */
+    hbool_t     corder_valid;   /* Whether the creation order is valid */
+    int64_t     corder;         /* Creation order of the link */
+    H5T_cset_t  cset;           /* Character set of the link name */
+    haddr_t     addr;           /* Address of the object linked to */
+} H5G_link_cache_ent_t;
+
+/* Hard links cached for one group */
+typedef struct H5G_link_cache_grp_t {
+    haddr_t     addr;           /* Address of the group's object header (key) */
+    H5SL_t      *links;         /* Cached links, by name */
+} H5G_link_cache_grp_t;
+
+/* Hard links cached for the groups of a file, so repeated traversals of the
+ * same paths don't look the links up in the groups' link storage again.
+ * Links are added by lookups and all of them are dropped whenever a link is
+ * removed from a group in the file, since that may delete objects and free
+ * their addresses.
+ */
+typedef struct H5G_link_cache_t {
+    H5SL_t      *groups;        /* Groups with cached links, by address */
+    size_t      nlinks;         /* # of links cached in all groups */
+} H5G_link_cache_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -89,6 +120,11 @@ typedef struct {
 static herr_t H5G_obj_compact_to_dense_cb(const void *_mesg, unsigned idx,
     void *_udata);
 static herr_t H5G__obj_remove_update_linfo(const H5O_loc_t *oloc, H5O_linfo_t *linfo);
+static htri_t H5G__link_cache_lookup(const H5O_loc_t *grp_oloc, const char *name,
+    H5O_link_t *lnk);
+static herr_t H5G__link_cache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk);
+static herr_t H5G__link_cache_free_ent_cb(void *item, void *key, void *op_data);
+static herr_t H5G__link_cache_free_grp_cb(void *item, void *key, void *op_data);
 
 
 /*********************/
@@ -105,6 +141,11 @@ static herr_t H5G__obj_remove_update_linfo(const H5O_loc_t *oloc, H5O_linfo_t *l
 /* Local Variables */
 /*******************/
 
+/* Declare free lists to manage the link cache structs */
+H5FL_DEFINE_STATIC(H5G_link_cache_t);
+H5FL_DEFINE_STATIC(H5G_link_cache_grp_t);
+H5FL_DEFINE_STATIC(H5G_link_cache_ent_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -982,6 +1023,10 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Drop the cached links, the object may go away with this link */
+    if(H5G_link_cache_dest(oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1046,6 +1091,10 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r,
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* Drop the cached links, the object may go away with this link */
+    if(H5G_link_cache_dest(grp_oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1100,6 +1149,10 @@ done:
  *
  * Purpose:	Look up a link in a group, using the name as the key.
  *
+ *              Hard links found are remembered for the file, so looking
+ *              up the same name in the group again doesn't need to read
+ *              the group's link storage.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Quincey Koziol
@@ -1121,6 +1174,12 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk)
     HDassert(grp_oloc && grp_oloc->file);
     HDassert(name && *name);
 
+    /* Check for the link in the link cache */
+    if((ret_value = H5G__link_cache_lookup(grp_oloc, name, lnk)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't search link cache")
+    if(ret_value)
+        HGOTO_DONE(TRUE)
+
     /* Attempt to get the link info message for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1142,6 +1201,11 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk)
         if((ret_value = H5G__stab_lookup(grp_oloc, name, lnk)) < 0)
             HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't locate object")
 
+    /* Remember hard links */
+    if(ret_value && H5L_TYPE_HARD == lnk->type)
+        if(H5G__link_cache_insert(grp_oloc, lnk) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't cache link")
+
 done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G__obj_lookup() */
@@ -1211,3 +1275,223 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G_obj_lookup_by_idx() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__link_cache_lookup
+ *
+ * Purpose:	Look up a hard link in the link cache of a group's file.
+ *
+ * Return:	Success:	TRUE if the link was found (and LNK filled in),
+ *				FALSE if not
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5G__link_cache_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk)
+{
+    H5G_link_cache_t *cache;            /* File's link cache */
+    H5G_link_cache_grp_t *grp;          /* Cached links of the group */
+    H5G_link_cache_ent_t *ent;          /* Cached link */
+    htri_t     ret_value = FALSE;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(name && *name);
+    HDassert(lnk);
+
+    if(NULL == (cache = H5F_GRP_LINK_CACHE(grp_oloc->file)))
+        HGOTO_DONE(FALSE)
+    if(NULL == (grp = (H5G_link_cache_grp_t *)H5SL_search(cache->groups, &grp_oloc->addr)))
+        HGOTO_DONE(FALSE)
+    if(NULL == (ent = (H5G_link_cache_ent_t *)H5SL_search(grp->links, name)))
+        HGOTO_DONE(FALSE)
+
+    /* Construct the link */
+    lnk->type = H5L_TYPE_HARD;
+    lnk->corder_valid = ent->corder_valid;
+    lnk->corder = ent->corder;
+    lnk->cset = ent->cset;
+    if(NULL == (lnk->name = H5MM_xstrdup(ent->name)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't duplicate link name")
+    lnk->u.hard.addr = ent->addr;
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__link_cache_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__link_cache_insert
+ *
+ * Purpose:	Remember a hard link found in a group.
+ *
+ *              Links aren't cached for files opened for SWMR reads, where
+ *              the writer may remove links.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__link_cache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk)
+{
+    H5G_link_cache_t *cache;            /* File's link cache */
+    H5G_link_cache_grp_t *grp = NULL;   /* Cached links of the group */
+    H5G_link_cache_ent_t *ent = NULL;   /* Cached link */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(lnk);
+    HDassert(H5L_TYPE_HARD == lnk->type);
+
+    if(H5F_INTENT(grp_oloc->file) & H5F_ACC_SWMR_READ)
+        HGOTO_DONE(SUCCEED)
+
+    /* Start over when the cache is full */
+    if(NULL != (cache = H5F_GRP_LINK_CACHE(grp_oloc->file)) && cache->nlinks >= H5G_LINK_CACHE_NLINKS_MAX)
+        if(H5G_link_cache_dest(grp_oloc->file) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link cache")
+
+    /* Create the cache for the file */
+    if(NULL == (cache = H5F_GRP_LINK_CACHE(grp_oloc->file))) {
+        if(NULL == (cache = H5FL_MALLOC(H5G_link_cache_t)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate link cache")
+        if(NULL == (cache->groups = H5SL_create(H5SL_TYPE_HADDR, NULL))) {
+            cache = H5FL_FREE(H5G_link_cache_t, cache);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create skip list for link cache")
+        } /* end if */
+        cache->nlinks = 0;
+        H5F_SET_GRP_LINK_CACHE(grp_oloc->file, cache);
+    } /* end if */
+
+    /* Find or add the group */
+    if(NULL == (grp = (H5G_link_cache_grp_t *)H5SL_search(cache->groups, &grp_oloc->addr))) {
+        if(NULL == (grp = H5FL_MALLOC(H5G_link_cache_grp_t)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate link cache group")
+        grp->addr = grp_oloc->addr;
+        if(NULL == (grp->links = H5SL_create(H5SL_TYPE_STR, NULL))) {
+            grp = H5FL_FREE(H5G_link_cache_grp_t, grp);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create skip list for link cache group")
+        } /* end if */
+        if(H5SL_insert(cache->groups, grp, &grp->addr) < 0) {
+            H5SL_close(grp->links);
+            grp = H5FL_FREE(H5G_link_cache_grp_t, grp);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert group into link cache")
+        } /* end if */
+    } /* end if */
+    else if(NULL != H5SL_search(grp->links, lnk->name))
+        HGOTO_DONE(SUCCEED)
+
+    /* Add the link */
+    if(NULL == (ent = H5FL_MALLOC(H5G_link_cache_ent_t)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate link cache entry")
+    if(NULL == (ent->name = H5MM_xstrdup(lnk->name))) {
+        ent = H5FL_FREE(H5G_link_cache_ent_t, ent);
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't duplicate link name")
+    } /* end if */
+    ent->corder_valid = lnk->corder_valid;
+    ent->corder = lnk->corder;
+    ent->cset = lnk->cset;
+    ent->addr = lnk->u.hard.addr;
+    if(H5SL_insert(grp->links, ent, ent->name) < 0) {
+        H5G__link_cache_free_ent_cb(ent, NULL, NULL);
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert link into link cache")
+    } /* end if */
+    cache->nlinks++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__link_cache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__link_cache_free_ent_cb
+ *
+ * Purpose:	Skip list callback to free a cached link.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__link_cache_free_ent_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5G_link_cache_ent_t *ent = (H5G_link_cache_ent_t *)item;   /* Cached link */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+
+    H5MM_xfree(ent->name);
+    ent = H5FL_FREE(H5G_link_cache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__link_cache_free_ent_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__link_cache_free_grp_cb
+ *
+ * Purpose:	Skip list callback to free the cached links of a group.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__link_cache_free_grp_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5G_link_cache_grp_t *grp = (H5G_link_cache_grp_t *)item;   /* Cached links of group */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(grp);
+
+    if(H5SL_destroy(grp->links, H5G__link_cache_free_ent_cb, NULL) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTCLOSEOBJ, FAIL, "can't destroy skip list for link cache group")
+    grp = H5FL_FREE(H5G_link_cache_grp_t, grp);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__link_cache_free_grp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_link_cache_dest
+ *
+ * Purpose:	Release the links cached for a file by group name lookups.
+ *              Called when a link is removed and when the file is closed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_link_cache_dest(H5F_t *f)
+{
+    H5G_link_cache_t *cache;            /* File's link cache */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+
+    if(NULL != (cache = H5F_GRP_LINK_CACHE(f))) {
+        H5F_SET_GRP_LINK_CACHE(f, NULL);
+        if(H5SL_destroy(cache->groups, H5G__link_cache_free_grp_cb, NULL) < 0)
+            HDONE_ERROR(H5E_SYM, H5E_CANTCLOSEOBJ, FAIL, "can't destroy skip list for link cache")
+        cache = H5FL_FREE(H5G_link_cache_t, cache);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_link_cache_dest() */
+
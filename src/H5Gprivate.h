@@ -234,6 +234,7 @@ H5_DLL herr_t H5G_obj_remove_by_idx(const struct H5O_loc_t *grp_oloc, H5RS_str_t
     H5_index_t idx_type, H5_iter_order_t order, hsize_t n);
 H5_DLL herr_t H5G_obj_lookup_by_idx(const struct H5O_loc_t *grp_oloc, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t n, struct H5O_link_t *lnk);
+H5_DLL herr_t H5G_link_cache_dest(H5F_t *f);
 H5_DLL hid_t H5G_get_create_plist(const H5G_t *grp);
 
 /*
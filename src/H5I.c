@@ -282,6 +282,7 @@ herr_t
 H5I_register_type(const H5I_class_t *cls)
 {
     H5I_id_type_t *type_ptr = NULL;	/* Ptr to the atomic type*/
+    hbool_t new_type = FALSE;           /* Whether the type was allocated here */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -295,6 +296,7 @@ H5I_register_type(const H5I_class_t *cls)
         /* Allocate the type information for new type */
         if(NULL == (type_ptr = (H5I_id_type_t *)H5FL_CALLOC(H5I_id_type_t)))
             HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "ID type allocation failed")
+        new_type = TRUE;
         H5I_id_type_list_g[cls->type_id] = type_ptr;
     } /* end if */
     else {
@@ -316,9 +318,10 @@ H5I_register_type(const H5I_class_t *cls)
 
 done:
     if(ret_value < 0) {	/* Clean up on error */
-        if(type_ptr) {
+        if(type_ptr && new_type) {
             if(type_ptr->ids)
                 H5SL_close(type_ptr->ids);
+            H5I_id_type_list_g[cls->type_id] = NULL;
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
         } /* end if */
     } /* end if */
@@ -746,6 +749,7 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     /* Insert into the type */
     if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
+    id_ptr = NULL;
     type_ptr->id_count++;
     type_ptr->nextid++;
 
@@ -756,6 +760,9 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     ret_value = new_id;
 
 done:
+    if (id_ptr)
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register() */
 
@@ -777,8 +784,8 @@ done:
 herr_t
 H5I_register_with_id(H5I_type_t type, const void *object, hbool_t app_ref, hid_t id)
 {
-    H5I_id_type_t   *type_ptr;              /* ptr to the type                  */
-    H5I_id_info_t   *id_ptr;                /* ptr to the new ID information    */
+    H5I_id_type_t   *type_ptr = NULL;       /* ptr to the type                  */
+    H5I_id_info_t   *id_ptr = NULL;         /* ptr to the new ID information    */
     herr_t          ret_value = SUCCEED;    /* return value                     */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -786,7 +793,7 @@ H5I_register_with_id(H5I_type_t type, const void *object, hbool_t app_ref, hid_t
     /* Check arguments */
 
     /* Make sure ID is not already in use */
-    if(NULL != (id_ptr = H5I__find_id(id)))
+    if(NULL != H5I__find_id(id))
         HGOTO_ERROR(H5E_ATOM, H5E_BADRANGE, FAIL, "ID already in use?!")
 
     /* Make sure type number is valid */
@@ -816,9 +823,13 @@ H5I_register_with_id(H5I_type_t type, const void *object, hbool_t app_ref, hid_t
     /* Insert into the type */
     if(H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
+    id_ptr = NULL;
     type_ptr->id_count++;
 
 done:
+    if(ret_value < 0 && id_ptr)
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register_with_id() */
 
@@ -2197,6 +2208,7 @@ H5I__debug_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
         case H5I_ERROR_CLASS:
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
+        case H5I_DATASET_PLAN:
         case H5I_NTYPES:
         default:
             break;   /* Other types of IDs are not stored in files */
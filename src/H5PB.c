@@ -36,6 +36,7 @@
 #include "H5Fpkg.h"		/* Files				*/
 #include "H5FDprivate.h"	/* File drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5PBpkg.h"            /* File access				*/
 #include "H5SLprivate.h"	/* Skip List				*/
 
@@ -43,6 +44,10 @@
 /****************/
 /* Local Macros */
 /****************/
+
+/* Max # of pages loaded by a single vector read during an explicit prefetch */
+#define H5PB_PREFETCH_BATCH     32
+
 #define H5PB__PREPEND(page_ptr, head_ptr, tail_ptr, len) {              \
         if((head_ptr) == NULL) {                                        \
             (head_ptr) = (page_ptr);                                    \
@@ -125,6 +130,17 @@ typedef struct {
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
 static htri_t H5PB__make_space(H5F_t *f, H5PB_t *page_buf, H5FD_mem_t inserted_type);
 static herr_t H5PB__write_entry(H5F_t *f, H5PB_entry_t *page_entry);
+static void H5PB__claim_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry,
+    H5FD_mem_t type);
+static hbool_t H5PB__evict_clean_entry(H5PB_t *page_buf);
+static htri_t H5PB__prefetch_candidate(H5PB_t *page_buf, haddr_t page_addr,
+    haddr_t eoa, size_t npending);
+static herr_t H5PB__load_pages(H5F_t *f, H5PB_t *page_buf, H5FD_mem_t type,
+    haddr_t eoa, size_t npages);
+static herr_t H5PB__queue_page(H5F_t *f, H5PB_t *page_buf, H5FD_mem_t type,
+    haddr_t eoa, haddr_t page_addr, size_t *npages, hbool_t flush);
+static herr_t H5PB__readahead(H5F_t *f, H5PB_t *page_buf, H5FD_mem_t type,
+    haddr_t page_addr, haddr_t eoa);
 
 
 /*********************/
@@ -183,6 +199,8 @@ H5PB_reset_stats(H5PB_t *page_buf)
     page_buf->evictions[1] = 0;
     page_buf->bypasses[0] = 0;
     page_buf->bypasses[1] = 0;
+    page_buf->prefetches[0] = 0;
+    page_buf->prefetches[1] = 0;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }  /* H5PB_reset_stats() */
@@ -260,6 +278,7 @@ H5PB_print_stats(const H5PB_t *page_buf)
     printf("\t Misses: %u\n", page_buf->misses[0]);
     printf("\t Evictions: %u\n", page_buf->evictions[0]);
     printf("\t Bypasses: %u\n", page_buf->bypasses[0]);
+    printf("\t Prefetches: %u\n", page_buf->prefetches[0]);
     printf("\t Hit Rate = %f%%\n", ((double)page_buf->hits[0]/(page_buf->accesses[0] - page_buf->bypasses[0]))*100);
     printf("*****************\n\n");
 
@@ -269,6 +288,7 @@ H5PB_print_stats(const H5PB_t *page_buf)
     printf("\t Misses: %u\n", page_buf->misses[1]);
     printf("\t Evictions: %u\n", page_buf->evictions[1]);
     printf("\t Bypasses: %u\n", page_buf->bypasses[1]);
+    printf("\t Prefetches: %u\n", page_buf->prefetches[1]);
     printf("\t Hit Rate = %f%%\n", ((double)page_buf->hits[1]/(page_buf->accesses[1]-page_buf->bypasses[0]))*100);
     printf("*****************\n\n");
 
@@ -281,6 +301,10 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *
  * Purpose:	Create and setup the PB on the file.
  *
+ *              READAHEAD is the maximum number of pages read after a
+ *              miss that continues a sequential run of pages of the same
+ *              memory type; 0 disables readahead.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Mohamad Chaarawi
@@ -288,9 +312,11 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5PB_create(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+H5PB_create(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+    unsigned page_buf_readahead)
 {
     H5PB_t *page_buf = NULL;
+    unsigned u;                    /* Local index variable */
     herr_t ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -335,6 +361,22 @@ H5PB_create(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned pag
     if(NULL == (page_buf->page_fac = H5FL_fac_init(page_buf->page_size)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINIT, FAIL, "can't create page factory")
 
+    /* Set up readahead: no page has been accessed yet, and the vectors
+     * must hold a full readahead window or an explicit prefetch batch.
+     */
+    page_buf->readahead = page_buf_readahead;
+    for(u = 0; u < H5FD_MEM_NTYPES; u++)
+        page_buf->next_page[u] = HADDR_UNDEF;
+    page_buf->io_nalloc = MAX(page_buf_readahead, H5PB_PREFETCH_BATCH);
+    if(NULL == (page_buf->io_types = (H5FD_mem_t *)H5MM_malloc(page_buf->io_nalloc * sizeof(H5FD_mem_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page I/O vector")
+    if(NULL == (page_buf->io_addrs = (haddr_t *)H5MM_malloc(page_buf->io_nalloc * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page I/O vector")
+    if(NULL == (page_buf->io_sizes = (size_t *)H5MM_malloc(page_buf->io_nalloc * sizeof(size_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page I/O vector")
+    if(NULL == (page_buf->io_bufs = (void **)H5MM_malloc(page_buf->io_nalloc * sizeof(void *))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page I/O vector")
+
     f->shared->page_buf = page_buf;
 
 done:
@@ -346,6 +388,10 @@ done:
                 H5SL_close(page_buf->mf_slist_ptr);
             if(page_buf->page_fac != NULL)
                 H5FL_fac_term(page_buf->page_fac);
+            H5MM_xfree(page_buf->io_types);
+            H5MM_xfree(page_buf->io_addrs);
+            H5MM_xfree(page_buf->io_sizes);
+            H5MM_xfree(page_buf->io_bufs);
             page_buf = H5FL_FREE(H5PB_t, page_buf);
         } /* end if */
     } /* end if */
@@ -506,6 +552,12 @@ H5PB_dest(H5F_t *f)
         if(H5FL_fac_term(page_buf->page_fac) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTRELEASE, FAIL, "can't destroy page buffer page factory")
 
+        /* Release the page I/O vectors */
+        page_buf->io_types = (H5FD_mem_t *)H5MM_xfree(page_buf->io_types);
+        page_buf->io_addrs = (haddr_t *)H5MM_xfree(page_buf->io_addrs);
+        page_buf->io_sizes = (size_t *)H5MM_xfree(page_buf->io_sizes);
+        page_buf->io_bufs = (void **)H5MM_xfree(page_buf->io_bufs);
+
         f->shared->page_buf = H5FL_FREE(H5PB_t, page_buf);
     } /* end if */
 
@@ -513,6 +565,85 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_dest */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_resize
+ *
+ * Purpose:	Change the size and minimum metadata / raw data fractions
+ *              of the PB on an open file.  The size is rounded down to a
+ *              multiple of the page size, as in H5PB_create().  When the
+ *              PB shrinks, the least recently used pages are evicted
+ *              (and written first, if dirty) until the rest fit.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_resize(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+{
+    H5PB_t *page_buf;                   /* Page buffering info for this file */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->page_buf);
+
+    page_buf = f->shared->page_buf;
+
+    /* Round down the size if it is larger than the page size */
+    if(size > page_buf->page_size)
+        size = (size / page_buf->page_size) * page_buf->page_size;
+    else if(size != page_buf->page_size)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Page Buffer size must be >= to the page size")
+
+    /* Evict the oldest pages until the remaining ones fit */
+    while(H5SL_count(page_buf->slist_ptr) * page_buf->page_size > size) {
+        H5PB_entry_t *page_entry = page_buf->LRU_tail_ptr;
+
+        HDassert(page_entry);
+
+        /* Remove from page index & LRU */
+        if(NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Tail Page Entry is not in skip list")
+        H5PB__REMOVE_LRU(page_buf, page_entry)
+        HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+
+        /* Update page counts & statistics */
+        if(H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) {
+            page_buf->raw_count--;
+            page_buf->evictions[1]++;
+        } /* end if */
+        else {
+            page_buf->meta_count--;
+            page_buf->evictions[0]++;
+        } /* end else */
+
+        /* Flush page if dirty, releasing it either way */
+        if(page_entry->is_dirty)
+            if(H5PB__write_entry(f, page_entry) < 0) {
+                page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+                page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+            } /* end if */
+        page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+        page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+    } /* end while */
+
+    /* Set the new limits */
+    page_buf->max_size = size;
+    page_buf->min_meta_perc = page_buf_min_meta_perc;
+    page_buf->min_raw_perc = page_buf_min_raw_perc;
+    page_buf->min_meta_count = (unsigned)((size * page_buf_min_meta_perc) / (page_buf->page_size * 100));
+    page_buf->min_raw_count = (unsigned)((size * page_buf_min_raw_perc) / (page_buf->page_size * 100));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5PB_resize */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5PB_add_new_page
@@ -651,7 +782,10 @@ H5PB_remove_entry(const H5F_t *f, haddr_t addr)
 
     /* If found, remove the entry from the PB cache */
     if(page_entry) {
-        HDassert(page_entry->type != H5F_MEM_PAGE_DRAW);
+        /* (A page that was read ahead is labeled with the type of the
+         *  access that triggered the readahead, which may be raw data)
+         */
+        HDassert(page_entry->is_prefetched || page_entry->type != H5F_MEM_PAGE_DRAW);
         if(NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
             HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Page Entry is not in skip list")
 
@@ -659,7 +793,11 @@ H5PB_remove_entry(const H5F_t *f, haddr_t addr)
         H5PB__REMOVE_LRU(page_buf, page_entry)
         HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
 
-        page_buf->meta_count--;
+        /* Decrement page count of appropriate type */
+        if(H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+            page_buf->raw_count--;
+        else
+            page_buf->meta_count--;
 
         page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
         page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
@@ -876,6 +1014,7 @@ H5PB_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/
 
                 /* Update LRU */
                 H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                H5PB__claim_entry(page_buf, page_entry, type);
 
                 /* Update statistics */
                 if(type == H5FD_MEM_DRAW)
@@ -957,7 +1096,17 @@ H5PB_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/
                     page_buf->misses[1]++;
                 else
                     page_buf->misses[0]++;
+
+                /* Read the following pages too, if this miss continues a
+                 * sequential run of pages of this type
+                 */
+                if(page_buf->readahead > 0 && search_addr == page_buf->next_page[type])
+                    if(H5PB__readahead(f, page_buf, type, search_addr + page_buf->page_size, eoa) < 0)
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "page buffer readahead failed")
             } /* end else */
+
+            /* Remember where a sequential access of this type would go next */
+            page_buf->next_page[type] = search_addr + page_buf->page_size;
         } /* end for */
     } /* end else */
 
@@ -1105,6 +1254,7 @@ H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr,
                     HDmemcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf, page_buf->page_size - (size_t)offset);
 
                     /* Mark page dirty and push to top of LRU */
+                    H5PB__claim_entry(page_buf, page_entry, type);
                     page_entry->is_dirty = TRUE;
                     H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
                 } /* end if */
@@ -1125,6 +1275,7 @@ H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr,
                              (size_t)((addr + size) - last_page_addr));
 
                     /* Mark page dirty and push to top of LRU */
+                    H5PB__claim_entry(page_buf, page_entry, type);
                     page_entry->is_dirty = TRUE;
                     H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
                 } /* end if */
@@ -1176,6 +1327,7 @@ H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr,
                 HDmemcpy((uint8_t *)page_entry->page_buf_ptr + offset, (const uint8_t *)buf + buf_offset, access_size);
 
                 /* Mark page dirty and push to top of LRU */
+                H5PB__claim_entry(page_buf, page_entry, type);
                 page_entry->is_dirty = TRUE;
                 H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
 
@@ -1305,6 +1457,171 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_prefetch
+ *
+ * Purpose:	Load the pages containing the NADDRS addresses in ADDRS
+ *              into the page buffer ahead of their first access, using as
+ *              few vector reads as possible.
+ *
+ *              This is a hint: pages already buffered, pages beyond the
+ *              EOA and pages that would need a dirty page to be written
+ *              out to make room for them are skipped.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_prefetch(H5F_t *f, H5FD_mem_t type, size_t naddrs, const haddr_t addrs[])
+{
+    H5PB_t *page_buf;                   /* Page buffering info for this file */
+    haddr_t eoa;                        /* Current EOA for the file */
+    size_t npages = 0;                  /* # of pages in the current batch */
+    size_t u, v;                        /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(naddrs == 0 || addrs);
+
+    /* Get pointer to page buffer info for this file */
+    page_buf = f->shared->page_buf;
+
+    /* Nothing to do without a page buffer */
+    if(NULL == page_buf || 0 == naddrs)
+        HGOTO_DONE(SUCCEED)
+#ifdef H5_HAVE_PARALLEL
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Retrieve the 'eoa' for the file */
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, type)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+
+    for(u = 0; u < naddrs; u++) {
+        haddr_t page_addr;              /* Address of the page holding the current address */
+        htri_t  status;                 /* Whether the page can be prefetched */
+        hbool_t dup = FALSE;            /* Whether the page is already in this batch */
+
+        if(!H5F_addr_defined(addrs[u]))
+            continue;
+        page_addr = (addrs[u] / page_buf->page_size) * page_buf->page_size;
+
+        /* Skip pages already queued in this batch */
+        for(v = 0; v < npages && !dup; v++)
+            if(page_buf->io_addrs[v] == page_addr)
+                dup = TRUE;
+        if(dup)
+            continue;
+
+        if((status = H5PB__prefetch_candidate(page_buf, page_addr, eoa, npages)) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't check page for prefetching")
+        if(FALSE == status)
+            continue;
+
+        /* Queue the page, loading full batches */
+        if(H5PB__queue_page(f, page_buf, type, eoa, page_addr, &npages, FALSE) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "can't prefetch pages")
+    } /* end for */
+
+    /* Load the last batch */
+    if(H5PB__queue_page(f, page_buf, type, eoa, HADDR_UNDEF, &npages, TRUE) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "can't prefetch pages")
+
+done:
+    /* Release the pages of a batch that wasn't loaded */
+    for(u = 0; u < npages; u++)
+        page_buf->io_bufs[u] = H5FL_FAC_FREE(page_buf->page_fac, page_buf->io_bufs[u]);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_preload
+ *
+ * Purpose:	Load the pages of the file into the free slots of the page
+ *              buffer, in address order, with batched vector reads.  This
+ *              replaces the many small random reads of a full traversal
+ *              of the file's metadata with a few large sequential ones.
+ *
+ *              The file format doesn't record which pages hold metadata,
+ *              so pages are loaded from the start of the file until the
+ *              EOA is reached or the page buffer is full.  Pages are
+ *              never evicted to make room, and take the type of their
+ *              first access, so raw data pages that are never touched
+ *              are the first to be evicted later.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_preload(H5F_t *f, H5FD_mem_t type)
+{
+    H5PB_t *page_buf;                   /* Page buffering info for this file */
+    haddr_t eoa;                        /* Current EOA for the file */
+    haddr_t page_addr;                  /* Address of the current page */
+    size_t max_pages;                   /* Max # of pages in the page buffer */
+    size_t npages = 0;                  /* # of pages in the current batch */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+
+    /* Get pointer to page buffer info for this file */
+    page_buf = f->shared->page_buf;
+
+    /* Nothing to do without a page buffer */
+    if(NULL == page_buf)
+        HGOTO_DONE(SUCCEED)
+#ifdef H5_HAVE_PARALLEL
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Retrieve the 'eoa' for the file */
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, type)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+
+    max_pages = page_buf->max_size / page_buf->page_size;
+    for(page_addr = 0; page_addr < eoa; page_addr += page_buf->page_size) {
+        htri_t  status;                 /* Whether the page can be loaded */
+
+        /* Stop when the page buffer is full */
+        if(H5SL_count(page_buf->slist_ptr) + npages >= max_pages)
+            break;
+
+        if((status = H5PB__prefetch_candidate(page_buf, page_addr, eoa, npages)) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't check page for preloading")
+        if(FALSE == status)
+            continue;
+
+        /* Queue the page, loading full batches */
+        if(H5PB__queue_page(f, page_buf, type, eoa, page_addr, &npages, FALSE) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "can't preload pages")
+    } /* end for */
+
+    /* Load the last batch */
+    if(H5PB__queue_page(f, page_buf, type, eoa, HADDR_UNDEF, &npages, TRUE) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "can't preload pages")
+
+done:
+    /* Release the pages of a batch that wasn't loaded */
+    for(u = 0; u < npages; u++)
+        page_buf->io_bufs[u] = H5FL_FAC_FREE(page_buf->page_fac, page_buf->io_bufs[u]);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_preload() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5PB__insert_entry()
@@ -1516,3 +1833,342 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB__write_entry() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__claim_entry()
+ *
+ * Purpose:	Called on each access to a page in the page buffer.  A page
+ *              that was read ahead carries the type of the access that
+ *              triggered the readahead, so on its first access it is
+ *              relabeled with the type it is actually used for.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PB__claim_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry, H5FD_mem_t type)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(page_buf);
+    HDassert(page_entry);
+
+    if(page_entry->is_prefetched) {
+        /* Move the page to the count of its actual type */
+        if(H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+            page_buf->raw_count--;
+        else
+            page_buf->meta_count--;
+        page_entry->type = (H5F_mem_page_t)type;
+        if(H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+            page_buf->raw_count++;
+        else
+            page_buf->meta_count++;
+
+        page_entry->is_prefetched = FALSE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5PB__claim_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__evict_clean_entry()
+ *
+ * Purpose:	Evict the least recently used page to make room for a page
+ *              that is read speculatively.  Unlike H5PB__make_space(),
+ *              this never writes a dirty page and never takes a page
+ *              type below its minimum count, so readahead and prefetching
+ *              cannot cost extra writes or displace protected pages.
+ *
+ * Return:	TRUE if a page was evicted, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5PB__evict_clean_entry(H5PB_t *page_buf)
+{
+    H5PB_entry_t *page_entry;           /* Pointer to page eviction candidate */
+    hbool_t is_raw;                     /* Whether the candidate is a raw data page */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(page_buf);
+
+    /* Only the oldest page is a candidate, and never the most recent one */
+    page_entry = page_buf->LRU_tail_ptr;
+    if(NULL == page_entry || page_entry == page_buf->LRU_head_ptr || page_entry->is_dirty)
+        HGOTO_DONE(FALSE)
+
+    is_raw = (hbool_t)(H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type);
+    if(is_raw ? (page_buf->raw_count <= page_buf->min_raw_count) :
+            (page_buf->meta_count <= page_buf->min_meta_count))
+        HGOTO_DONE(FALSE)
+
+    /* Remove from page index & LRU */
+    if(NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
+        HGOTO_DONE(FALSE)
+    H5PB__REMOVE_LRU(page_buf, page_entry)
+    HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+
+    /* Update page counts & statistics */
+    if(is_raw) {
+        page_buf->raw_count--;
+        page_buf->evictions[1]++;
+    } /* end if */
+    else {
+        page_buf->meta_count--;
+        page_buf->evictions[0]++;
+    } /* end else */
+
+    /* Release page */
+    page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+    page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__evict_clean_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__prefetch_candidate()
+ *
+ * Purpose:	Check whether the page at PAGE_ADDR may be read ahead of its
+ *              first access, with NPENDING other pages already queued for
+ *              the same vector read.  The page must be within the EOA and
+ *              not buffered yet (pages newly allocated by the MF layer are
+ *              never read), and there must be room for it in the page
+ *              buffer once the queued pages are inserted, evicting a
+ *              clean page if necessary.
+ *
+ * Return:	TRUE/FALSE on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5PB__prefetch_candidate(H5PB_t *page_buf, haddr_t page_addr, haddr_t eoa,
+    size_t npending)
+{
+    size_t max_pages;                   /* Max # of pages in the page buffer */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(page_buf);
+    HDassert(npending < page_buf->io_nalloc);
+
+    if(page_addr >= eoa)
+        HGOTO_DONE(FALSE)
+    if(NULL != H5SL_search(page_buf->slist_ptr, &page_addr))
+        HGOTO_DONE(FALSE)
+    if(NULL != H5SL_search(page_buf->mf_slist_ptr, &page_addr))
+        HGOTO_DONE(FALSE)
+
+    /* Make room for the page */
+    max_pages = page_buf->max_size / page_buf->page_size;
+    if(H5SL_count(page_buf->slist_ptr) + npending + 1 > max_pages)
+        if(!H5PB__evict_clean_entry(page_buf))
+            HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__prefetch_candidate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__load_pages()
+ *
+ * Purpose:	Read the NPAGES pages queued in the page I/O vectors of the
+ *              page buffer with a single vector read, and insert them
+ *              into the page buffer as clean, prefetched pages of type
+ *              TYPE.  The page buffers are owned by the page buffer on
+ *              return, whether or not the read succeeded.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__load_pages(H5F_t *f, H5PB_t *page_buf, H5FD_mem_t type, haddr_t eoa,
+    size_t npages)
+{
+    H5PB_entry_t *page_entry;           /* Pointer to the new page entry */
+    size_t u = 0;                       /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(page_buf);
+    HDassert(npages > 0 && npages <= page_buf->io_nalloc);
+
+    /* Set up the vector, without reading past the EOA */
+    for(u = 0; u < npages; u++) {
+        HDassert(page_buf->io_addrs[u] < eoa);
+        page_buf->io_types[u] = type;
+        page_buf->io_sizes[u] = page_buf->page_size;
+        if(page_buf->io_addrs[u] + page_buf->page_size > eoa)
+            page_buf->io_sizes[u] = (size_t)(eoa - page_buf->io_addrs[u]);
+    } /* end for */
+
+    /* Read all the pages at once */
+    u = 0;
+    if(H5FD_read_vector(f->shared->lf, (uint32_t)npages, page_buf->io_types, page_buf->io_addrs, page_buf->io_sizes, page_buf->io_bufs) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read vector request failed")
+
+    /* Insert the pages into the page buffer */
+    for(u = 0; u < npages; u++) {
+        if(NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+        page_entry->page_buf_ptr = page_buf->io_bufs[u];
+        page_entry->addr = page_buf->io_addrs[u];
+        page_entry->type = (H5F_mem_page_t)type;
+        page_entry->is_dirty = FALSE;
+        page_entry->is_prefetched = TRUE;
+
+        if(H5PB__insert_entry(page_buf, page_entry) < 0) {
+            page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting prefetched page in page buffer")
+        } /* end if */
+        page_buf->io_bufs[u] = NULL;
+
+        /* Update statistics */
+        if(type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
+            page_buf->prefetches[1]++;
+        else
+            page_buf->prefetches[0]++;
+    } /* end for */
+
+done:
+    /* Release the pages that weren't inserted */
+    for(; u < npages; u++)
+        page_buf->io_bufs[u] = H5FL_FAC_FREE(page_buf->page_fac, page_buf->io_bufs[u]);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__load_pages() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__queue_page()
+ *
+ * Purpose:	Queue the page at PAGE_ADDR for the next vector read of
+ *              prefetched pages, where *NPAGES pages are already queued.
+ *              The batch is loaded when it is full, or when FLUSH is set
+ *              (PAGE_ADDR is ignored then).  *NPAGES is reset to zero
+ *              once the queued pages are owned by the page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__queue_page(H5F_t *f, H5PB_t *page_buf, H5FD_mem_t type, haddr_t eoa,
+    haddr_t page_addr, size_t *npages, hbool_t flush)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(page_buf);
+    HDassert(npages);
+    HDassert(*npages < page_buf->io_nalloc);
+
+    if(!flush) {
+        /* Queue the page */
+        if(NULL == (page_buf->io_bufs[*npages] = H5FL_FAC_MALLOC(page_buf->page_fac)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry")
+        page_buf->io_addrs[*npages] = page_addr;
+        (*npages)++;
+    } /* end if */
+
+    /* Load the batch */
+    if(*npages > 0 && (flush || *npages == page_buf->io_nalloc)) {
+        /* The pages are owned by the page buffer from here on */
+        size_t nqueued = *npages;
+
+        *npages = 0;
+        if(H5PB__load_pages(f, page_buf, type, eoa, nqueued) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "can't load pages")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__queue_page() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__readahead()
+ *
+ * Purpose:	Read up to the configured number of pages starting at
+ *              PAGE_ADDR after a miss that continued a sequential run of
+ *              pages of type TYPE.  The window stops at the first page
+ *              that can't be prefetched, and never covers more than half
+ *              of the page buffer so a single stream can't flush it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__readahead(H5F_t *f, H5PB_t *page_buf, H5FD_mem_t type, haddr_t page_addr,
+    haddr_t eoa)
+{
+    size_t window;                      /* Max # of pages to read ahead */
+    size_t npages = 0;                  /* # of pages queued */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(page_buf);
+    HDassert(page_buf->readahead > 0);
+
+    window = MIN((size_t)page_buf->readahead, (page_buf->max_size / page_buf->page_size) / 2);
+    HDassert(window <= page_buf->io_nalloc);
+
+    while(npages < window) {
+        htri_t status;                  /* Whether the page can be prefetched */
+
+        if((status = H5PB__prefetch_candidate(page_buf, page_addr, eoa, npages)) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't check page for readahead")
+        if(FALSE == status)
+            break;
+
+        if(NULL == (page_buf->io_bufs[npages] = H5FL_FAC_MALLOC(page_buf->page_fac)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry")
+        page_buf->io_addrs[npages] = page_addr;
+        npages++;
+
+        page_addr += page_buf->page_size;
+    } /* end while */
+
+    if(npages > 0) {
+        /* The pages are owned by the page buffer from here on */
+        size_t nqueued = npages;
+
+        npages = 0;
+        if(H5PB__load_pages(f, page_buf, type, eoa, nqueued) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "can't read ahead pages")
+    } /* end if */
+
+done:
+    /* Release the queued pages on error */
+    while(npages > 0) {
+        npages--;
+        page_buf->io_bufs[npages] = H5FL_FAC_FREE(page_buf->page_fac, page_buf->io_bufs[npages]);
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__readahead() */
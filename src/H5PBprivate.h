@@ -67,12 +67,22 @@ typedef struct H5PB_t {
 
     H5FL_fac_head_t     *page_fac;           /* Factory for allocating pages */
 
+    /* Readahead & prefetching */
+    unsigned            readahead;          /* Max # of pages to read ahead of a sequential miss (0 disables readahead) */
+    haddr_t             next_page[H5FD_MEM_NTYPES]; /* Address of the page following the last one accessed, for each memory type */
+    size_t              io_nalloc;          /* # of elements allocated in the I/O vectors below */
+    H5FD_mem_t          *io_types;          /* Memory types of the pages loaded in one vector read */
+    haddr_t             *io_addrs;          /* Addresses of the pages loaded in one vector read */
+    size_t              *io_sizes;          /* Sizes of the pages loaded in one vector read */
+    void                **io_bufs;          /* Buffers of the pages loaded in one vector read */
+
     /* Statistics */
     unsigned            accesses[2];
     unsigned            hits[2];
     unsigned            misses[2];
     unsigned            evictions[2];
     unsigned            bypasses[2];
+    unsigned            prefetches[2];
 } H5PB_t;
 
 /*****************************/
@@ -85,9 +95,10 @@ typedef struct H5PB_t {
 /***************************************/
 
 /* General routines */
-H5_DLL herr_t H5PB_create(H5F_t *file, size_t page_buffer_size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc);
+H5_DLL herr_t H5PB_create(H5F_t *file, size_t page_buffer_size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc, unsigned page_buf_readahead);
 H5_DLL herr_t H5PB_flush(H5F_t *f);
 H5_DLL herr_t H5PB_dest(H5F_t *f);
+H5_DLL herr_t H5PB_resize(H5F_t *f, size_t page_buffer_size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc);
 H5_DLL herr_t H5PB_add_new_page(H5F_t *f, H5FD_mem_t type, haddr_t page_addr);
 H5_DLL herr_t H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf);
 H5_DLL herr_t H5PB_remove_entry(const H5F_t *f, haddr_t addr);
@@ -95,6 +106,9 @@ H5_DLL herr_t H5PB_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
     void *buf/*out*/);
 H5_DLL herr_t H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
     const void *buf);
+H5_DLL herr_t H5PB_prefetch(H5F_t *f, H5FD_mem_t type, size_t naddrs,
+    const haddr_t addrs[]);
+H5_DLL herr_t H5PB_preload(H5F_t *f, H5FD_mem_t type);
 
 /* Statistics routines */
 H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
@@ -96,6 +96,11 @@
 #define H5D_ACS_EFILE_PREFIX_COPY               H5P__dapl_efile_pref_copy
 #define H5D_ACS_EFILE_PREFIX_CMP                H5P__dapl_efile_pref_cmp
 #define H5D_ACS_EFILE_PREFIX_CLOSE              H5P__dapl_efile_pref_close
+/* Definitions for chunk space reservation */
+#define H5D_ACS_CHUNK_RESERVE_SIZE              sizeof(hsize_t)
+#define H5D_ACS_CHUNK_RESERVE_DEF               (hsize_t)0
+#define H5D_ACS_CHUNK_RESERVE_ENC               H5P__encode_hsize_t
+#define H5D_ACS_CHUNK_RESERVE_DEC               H5P__decode_hsize_t
 
 /******************/
 /* Local Typedefs */
@@ -199,6 +204,7 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     double rdcc_w0 = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
     H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;         /* Default VDS view option */
     hsize_t printf_gap = H5D_ACS_VDS_PRINTF_GAP_DEF;            /* Default VDS printf gap */
+    hsize_t chunk_reserve = H5D_ACS_CHUNK_RESERVE_DEF;          /* Default chunk space reservation */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
@@ -248,6 +254,12 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
             H5D_ACS_EFILE_PREFIX_DEL, H5D_ACS_EFILE_PREFIX_COPY, H5D_ACS_EFILE_PREFIX_CMP, H5D_ACS_EFILE_PREFIX_CLOSE) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the chunk space reservation */
+    if(H5P_register_real(pclass, H5D_ACS_CHUNK_RESERVE_NAME, H5D_ACS_CHUNK_RESERVE_SIZE, &chunk_reserve,
+            NULL, NULL, NULL, H5D_ACS_CHUNK_RESERVE_ENC, H5D_ACS_CHUNK_RESERVE_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -1586,3 +1598,83 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_virtual_prefix() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_reserve
+ *
+ * Purpose:     Sets the largest run of file space that a chunked dataset
+ *              reserves at once for its new chunks.
+ *
+ *              New chunks of a dataset opened with this property list
+ *              are placed one after the other in runs of file space that
+ *              the dataset reserves for itself, so the chunks of datasets
+ *              that grow at the same time don't interleave in the file.
+ *              The first run holds a few chunks and each following run
+ *              is twice as large as the previous one, up to MAX_SIZE
+ *              bytes.  The unused part of the last run is returned to
+ *              the file when the dataset is closed.
+ *
+ *              A MAX_SIZE of 0 (the default) disables the reservation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_reserve(hid_t plist_id, hsize_t max_size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ih", plist_id, max_size);
+
+    /* Check argument */
+    if(max_size == HSIZE_UNDEF)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a valid reservation size")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_ACS_CHUNK_RESERVE_NAME, &max_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_reserve() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_reserve
+ *
+ * Purpose:     Gets the largest run of file space that a chunked dataset
+ *              reserves at once for its new chunks, set with
+ *              H5Pset_chunk_reserve().  0 means no space is reserved.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_reserve(hid_t plist_id, hsize_t *max_size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*h", plist_id, max_size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(max_size)
+        if(H5P_get(plist, H5D_ACS_CHUNK_RESERVE_NAME, max_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_reserve() */
@@ -96,6 +96,11 @@
 #define H5F_ACS_SIEVE_BUF_SIZE_DEF              (64*1024)
 #define H5F_ACS_SIEVE_BUF_SIZE_ENC              H5P__encode_size_t
 #define H5F_ACS_SIEVE_BUF_SIZE_DEC              H5P__decode_size_t
+/* Definition for largest hole in a selection read through by the sieve buffer */
+#define H5F_ACS_SIEVE_GAP_SIZE_SIZE             sizeof(size_t)
+#define H5F_ACS_SIEVE_GAP_SIZE_DEF              (64*1024)
+#define H5F_ACS_SIEVE_GAP_SIZE_ENC              H5P__encode_size_t
+#define H5F_ACS_SIEVE_GAP_SIZE_DEC              H5P__decode_size_t
 /* Definition for minimum "small data" allocation block size (when
    aggregating "small" raw data allocations. */
 #define H5F_ACS_SDATA_BLOCK_SIZE_SIZE           sizeof(hsize_t)
@@ -258,6 +263,21 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF            0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC            H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC            H5P__decode_unsigned
+/* Definition for # of pages read ahead by the page buffer */
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_SIZE              sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_DEF               0
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_ENC               H5P__encode_unsigned
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_DEC               H5P__decode_unsigned
+/* Definition for preloading the page buffer on open */
+#define H5F_ACS_PAGE_BUFFER_PRELOAD_SIZE                sizeof(hbool_t)
+#define H5F_ACS_PAGE_BUFFER_PRELOAD_DEF                 FALSE
+#define H5F_ACS_PAGE_BUFFER_PRELOAD_ENC                 H5P__encode_hbool_t
+#define H5F_ACS_PAGE_BUFFER_PRELOAD_DEC                 H5P__decode_hbool_t
+/* Definition for # of metadata accumulator regions */
+#define H5F_ACS_META_ACCUM_NREGIONS_SIZE                sizeof(unsigned)
+#define H5F_ACS_META_ACCUM_NREGIONS_DEF                 1
+#define H5F_ACS_META_ACCUM_NREGIONS_ENC                 H5P__encode_unsigned
+#define H5F_ACS_META_ACCUM_NREGIONS_DEC                 H5P__decode_unsigned
 
 
 /******************/
@@ -363,6 +383,7 @@ static const hsize_t H5F_def_threshold_g = H5F_ACS_ALIGN_THRHD_DEF;
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF;                      /* Default allocation alignment value */
 static const hsize_t H5F_def_meta_block_size_g = H5F_ACS_META_BLOCK_SIZE_DEF;      /* Default metadata allocation block size */
 static const size_t H5F_def_sieve_buf_size_g = H5F_ACS_SIEVE_BUF_SIZE_DEF;         /* Default raw data I/O sieve buffer size */
+static const size_t H5F_def_sieve_gap_size_g = H5F_ACS_SIEVE_GAP_SIZE_DEF;         /* Default raw data I/O sieve gap size */
 static const hsize_t H5F_def_sdata_block_size_g = H5F_ACS_SDATA_BLOCK_SIZE_DEF;    /* Default small data allocation block size */
 static const unsigned H5F_def_gc_ref_g = H5F_ACS_GARBG_COLCT_REF_DEF;              /* Default garbage collection for references setting */
 static const H5F_close_degree_t H5F_def_close_degree_g = H5F_CLOSE_DEGREE_DEF;     /* Default file close degree */
@@ -397,6 +418,9 @@ static const H5AC_cache_image_config_t H5F_def_mdc_initCacheImageCfg_g = H5F_ACS
 static const size_t H5F_def_page_buf_size_g = H5F_ACS_PAGE_BUFFER_SIZE_DEF;      /* Default page buffer size */
 static const unsigned H5F_def_page_buf_min_meta_perc_g = H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF;      /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g = H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF;      /* Default page buffer minumum raw data size */
+static const unsigned H5F_def_page_buf_readahead_g = H5F_ACS_PAGE_BUFFER_READAHEAD_DEF;      /* Default page buffer readahead */
+static const hbool_t H5F_def_page_buf_preload_g = H5F_ACS_PAGE_BUFFER_PRELOAD_DEF;      /* Default page buffer preloading */
+static const unsigned H5F_def_meta_accum_nregions_g = H5F_ACS_META_ACCUM_NREGIONS_DEF;      /* Default # of metadata accumulator regions */
 
 
 /*-------------------------------------------------------------------------
@@ -466,6 +490,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the largest hole read through by the sieve buffer */
+    if(H5P_register_real(pclass, H5F_ACS_SIEVE_GAP_SIZE_NAME, H5F_ACS_SIEVE_GAP_SIZE_SIZE, &H5F_def_sieve_gap_size_g,
+            NULL, NULL, NULL, H5F_ACS_SIEVE_GAP_SIZE_ENC, H5F_ACS_SIEVE_GAP_SIZE_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the minimum "small data" allocation block size */
     if(H5P_register_real(pclass, H5F_ACS_SDATA_BLOCK_SIZE_NAME, H5F_ACS_SDATA_BLOCK_SIZE_SIZE, &H5F_def_sdata_block_size_g,
             NULL, NULL, NULL, H5F_ACS_SDATA_BLOCK_SIZE_ENC, H5F_ACS_SDATA_BLOCK_SIZE_DEC,
@@ -643,6 +673,21 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC,
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    /* Register the # of pages read ahead by the page buffer */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, H5F_ACS_PAGE_BUFFER_READAHEAD_SIZE, &H5F_def_page_buf_readahead_g,
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_READAHEAD_ENC, H5F_ACS_PAGE_BUFFER_READAHEAD_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    /* Register the page buffer preloading flag */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_PRELOAD_NAME, H5F_ACS_PAGE_BUFFER_PRELOAD_SIZE, &H5F_def_page_buf_preload_g,
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_PRELOAD_ENC, H5F_ACS_PAGE_BUFFER_PRELOAD_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    /* Register the # of metadata accumulator regions */
+    if(H5P_register_real(pclass, H5F_ACS_META_ACCUM_NREGIONS_NAME, H5F_ACS_META_ACCUM_NREGIONS_SIZE, &H5F_def_meta_accum_nregions_g,
+            NULL, NULL, NULL, H5F_ACS_META_ACCUM_NREGIONS_ENC, H5F_ACS_META_ACCUM_NREGIONS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2177,6 +2222,80 @@ done:
 } /* end H5Pget_sieve_buf_size() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_sieve_gap_size
+ *
+ * Purpose:     Sets the largest hole between the pieces of a selection
+ *              that the data sieve buffer reads through.  When the sieve
+ *              buffer is loaded, it covers the following pieces of the
+ *              selection (which are handled in order of their offsets in
+ *              the dataset) up to the first hole larger than this size,
+ *              so that nearby pieces are read or written with one I/O
+ *              operation and large holes are not read for nothing.
+ *
+ *              The default value is 64KB.  Setting the value to 0 only
+ *              combines pieces which are adjacent in the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_sieve_gap_size(hid_t plist_id, size_t size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_SIEVE_GAP_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set sieve gap size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_sieve_gap_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_sieve_gap_size
+ *
+ * Purpose:     Returns the largest hole between the pieces of a selection
+ *              that the data sieve buffer reads through, from a file access
+ *              property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_sieve_gap_size(hid_t plist_id, size_t *size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(size)
+        if(H5P_get(plist, H5F_ACS_SIEVE_GAP_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get sieve gap size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_sieve_gap_size() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_small_data_block_size
  *
@@ -4939,3 +5058,220 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_readahead
+ *
+ * Purpose:     Set the maximum number of pages the page buffer reads
+ *              ahead when a miss continues a sequential run of pages of
+ *              the same type.  The pages are read together with a single
+ *              vector read.  Zero (the default) disables readahead.
+ *
+ *              Readahead never uses more than half of the page buffer.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_readahead(hid_t plist_id, unsigned npages)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, npages);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, &npages) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET,FAIL, "can't set page buffer readahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_readahead() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_readahead
+ *
+ * Purpose:    Retrieves the maximum number of pages read ahead by the
+ *             page buffer.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_readahead(hid_t plist_id, unsigned *npages)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Iu", plist_id, npages);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(npages)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, npages) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get page buffer readahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_readahead() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_preload
+ *
+ * Purpose:     Set whether opening a file loads its pages into the page
+ *              buffer, with a few large sequential reads, before any
+ *              metadata is accessed.  The pages are loaded from the start
+ *              of the file until the page buffer is full, so a later full
+ *              traversal of a file whose metadata fits in the page buffer
+ *              doesn't read from the file again.
+ *
+ *              Preloading only applies when page buffering is enabled.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_preload(hid_t plist_id, hbool_t preload)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, preload);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_PRELOAD_NAME, &preload) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET,FAIL, "can't set page buffer preloading")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_preload() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_preload
+ *
+ * Purpose:    Retrieves whether opening a file loads its pages into the
+ *             page buffer.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_preload(hid_t plist_id, hbool_t *preload)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", plist_id, preload);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(preload)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_PRELOAD_NAME, preload) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get page buffer preloading")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_preload() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_meta_accum_regions
+ *
+ * Purpose:     Set the number of regions the metadata accumulator keeps.
+ *
+ *              With one region (the default), a metadata write that
+ *              doesn't adjoin or overlap the accumulator flushes it.
+ *              With more regions, up to NREGIONS disjoint ranges of the
+ *              file are combined in memory at the same time, and are
+ *              written out in address order when they are flushed.
+ *              This helps when metadata updates alternate between a few
+ *              areas of the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_meta_accum_regions(hid_t plist_id, unsigned nregions)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nregions);
+
+    /* Check argument */
+    if(nregions < 1 || nregions > H5F_ACCUM_MAX_REGIONS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "# of metadata accumulator regions must be between 1 and %u", (unsigned)H5F_ACCUM_MAX_REGIONS)
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_META_ACCUM_NREGIONS_NAME, &nregions) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET,FAIL, "can't set # of metadata accumulator regions")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_meta_accum_regions() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_meta_accum_regions
+ *
+ * Purpose:    Retrieves the number of regions the metadata accumulator
+ *             keeps.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_meta_accum_regions(hid_t plist_id, unsigned *nregions)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Iu", plist_id, nregions);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(nregions)
+        if(H5P_get(plist, H5F_ACS_META_ACCUM_NREGIONS_NAME, nregions) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get # of metadata accumulator regions")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_meta_accum_regions() */
+
@@ -335,6 +335,8 @@ H5_DLL herr_t H5Pset_meta_block_size(hid_t fapl_id, hsize_t size);
 H5_DLL herr_t H5Pget_meta_block_size(hid_t fapl_id, hsize_t *size/*out*/);
 H5_DLL herr_t H5Pset_sieve_buf_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pget_sieve_buf_size(hid_t fapl_id, size_t *size/*out*/);
+H5_DLL herr_t H5Pset_sieve_gap_size(hid_t fapl_id, size_t size);
+H5_DLL herr_t H5Pget_sieve_gap_size(hid_t fapl_id, size_t *size/*out*/);
 H5_DLL herr_t H5Pset_small_data_block_size(hid_t fapl_id, hsize_t size);
 H5_DLL herr_t H5Pget_small_data_block_size(hid_t fapl_id, hsize_t *size/*out*/);
 H5_DLL herr_t H5Pset_libver_bounds(hid_t plist_id, H5F_libver_t low,
@@ -369,6 +371,12 @@ H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t
 H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr /*out*/);
 H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_per, unsigned min_raw_per);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per, unsigned *min_raw_per);
+H5_DLL herr_t H5Pset_page_buffer_readahead(hid_t plist_id, unsigned npages);
+H5_DLL herr_t H5Pget_page_buffer_readahead(hid_t plist_id, unsigned *npages);
+H5_DLL herr_t H5Pset_page_buffer_preload(hid_t plist_id, hbool_t preload);
+H5_DLL herr_t H5Pget_page_buffer_preload(hid_t plist_id, hbool_t *preload);
+H5_DLL herr_t H5Pset_meta_accum_regions(hid_t plist_id, unsigned nregions);
+H5_DLL herr_t H5Pget_meta_accum_regions(hid_t plist_id, unsigned *nregions);
 
 /* Dataset creation property list (DCPL) routines */
 H5_DLL herr_t H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
@@ -428,6 +436,8 @@ H5_DLL herr_t H5Pget_append_flush(hid_t plist_id, unsigned dims,
     hsize_t boundary[], H5D_append_cb_t *func, void **udata);
 H5_DLL herr_t H5Pset_efile_prefix(hid_t dapl_id, const char* prefix);
 H5_DLL ssize_t H5Pget_efile_prefix(hid_t dapl_id, char* prefix /*out*/, size_t size);
+H5_DLL herr_t H5Pset_chunk_reserve(hid_t plist_id, hsize_t max_size);
+H5_DLL herr_t H5Pget_chunk_reserve(hid_t plist_id, hsize_t *max_size/*out*/);
 
 /* Dataset xfer property list (DXPL) routines */
 H5_DLL herr_t H5Pset_data_transform(hid_t plist_id, const char* expression);
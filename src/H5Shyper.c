@@ -25,20 +25,62 @@
 #include "H5Eprivate.h"		/* Error handling			*/
 #include "H5FLprivate.h"	/* Free Lists				*/
 #include "H5Iprivate.h"		/* ID Functions				*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Spkg.h"		/* Dataspace functions			*/
 #include "H5VMprivate.h"         /* Vector functions			*/
 
+/* Local Macros */
+
+/* Index of the last span in the list of spans that an iterator over a
+ * flattened span tree is currently in, for a dimension
+ */
+#define H5S_HYPER_FLAT_LAST_SPAN(ITER, DIM)                                   \
+    ((DIM) == 0 ? ((ITER)->u.hyp.flat->nspans[0] - 1) :                        \
+        (ITER)->u.hyp.flat->span[(DIM) - 1][(ITER)->u.hyp.span[(DIM) - 1]].down_last)
+
 /* Local datatypes */
 
+/* Last list of spans added to a flattened span tree in a dimension */
+typedef struct {
+    const H5S_hyper_span_info_t *spans; /* List of spans */
+    size_t first;               /* Index of first span of list in flattened tree */
+    size_t last;                /* Index of last span of list in flattened tree */
+} H5S_hyper_flat_last_t;
+
+/* Hyperslab in a list of hyperslabs, for H5S_select_hyperslab_list() */
+typedef struct {
+    const hsize_t *start;       /* Offset of start of hyperslab */
+    const hsize_t *stride;      /* Hyperslab stride */
+    const hsize_t *count;       /* Number of blocks in hyperslab */
+    const hsize_t *block;       /* Size of block in hyperslab */
+} H5S_hyper_slab_t;
+
+/* Start or end of a block of a hyperslab in one dimension */
+typedef struct {
+    hsize_t coord;              /* Coordinate of start, or of element after end */
+    size_t slab;                /* Index of hyperslab */
+    hbool_t start;              /* Whether the block starts or ends here */
+} H5S_hyper_slab_event_t;
+
 /* Static function prototypes */
 static herr_t H5S_hyper_free_span_info(H5S_hyper_span_info_t *span_info);
 static herr_t H5S_hyper_free_span(H5S_hyper_span_t *span);
 static H5S_hyper_span_info_t *H5S_hyper_copy_span(H5S_hyper_span_info_t *spans);
 static void H5S_hyper_span_scratch(H5S_hyper_span_info_t *spans, void *scr_value);
-static herr_t H5S_hyper_span_precompute(H5S_hyper_span_info_t *spans, size_t elmt_size);
+static H5S_hyper_flat_t *H5S_hyper_get_flat(H5S_hyper_span_info_t *spans,
+    unsigned rank);
+static void H5S_hyper_free_flat(H5S_hyper_flat_t *flat);
+static void H5S_hyper_reset_flat(H5S_hyper_span_info_t *spans);
 static herr_t H5S_generate_hyperslab(H5S_t *space, H5S_seloper_t op,
     const hsize_t start[], const hsize_t stride[], const hsize_t count[], const hsize_t block[]);
 static herr_t H5S_hyper_generate_spans(H5S_t *space);
+static herr_t H5S_hyper_apply_spans(H5S_t *space, H5S_seloper_t op,
+    H5S_hyper_span_info_t *new_spans);
+static H5S_hyper_span_info_t *H5S_hyper_make_spans_list(unsigned rank,
+    unsigned dim, const H5S_hyper_slab_t *slabs, size_t nidx, const size_t *idx);
+static herr_t H5S_select_hyperslab_list(H5S_t *space, H5S_seloper_t op,
+    size_t nslabs, const hsize_t start[], const hsize_t stride[],
+    const hsize_t count[], const hsize_t block[]);
 /* Needed for use in hyperslab code (H5Shyper.c) */
 #ifdef NEW_HYPERSLAB_API
 static herr_t H5S_select_select (H5S_t *space1, H5S_seloper_t op, H5S_t *space2);
@@ -249,12 +291,12 @@ static herr_t
 H5S_hyper_iter_init(H5S_sel_iter_t *iter, const H5S_t *space)
 {
     const H5S_hyper_dim_t *tdiminfo;    /* Temporary pointer to diminfo information */
-    H5S_hyper_span_info_t *spans;   /* Pointer to hyperslab span info node */
     unsigned rank;                  /* Dataspace's dimension rank */
     unsigned u;                     /* Index variable */
     int i;                          /* Index variable */
+    herr_t ret_value = SUCCEED;     /* Return value */
 
-    FUNC_ENTER_NOAPI_NOINIT_NOERR
+    FUNC_ENTER_NOAPI_NOINIT
 
     /* Check args */
     HDassert(space && H5S_SEL_HYPERSLABS == H5S_GET_SELECT_TYPE(space));
@@ -383,32 +425,30 @@ H5S_hyper_iter_init(H5S_sel_iter_t *iter, const H5S_t *space)
         iter->u.hyp.diminfo_valid = TRUE;
 
         /* Initialize irregular region information also (for release) */
-        iter->u.hyp.spans = NULL;
+        iter->u.hyp.flat = NULL;
     } /* end if */
     else {
 /* Initialize the information needed for non-regular hyperslab I/O */
-        HDassert(space->select.sel_info.hslab->span_lst);
-        /* Make a copy of the span tree to iterate over */
-        iter->u.hyp.spans = H5S_hyper_copy_span(space->select.sel_info.hslab->span_lst);
+        H5S_hyper_flat_t *flat;     /* Flattened span tree */
 
-        /* Set the nelem & pstride values according to the element size */
-        H5S_hyper_span_precompute(iter->u.hyp.spans,iter->elmt_size);
+        HDassert(space->select.sel_info.hslab->span_lst);
+        /* Get the flattened span tree to iterate over */
+        if(NULL == (flat = H5S_hyper_get_flat(space->select.sel_info.hslab->span_lst, rank)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't flatten hyperslab span tree")
+        iter->u.hyp.flat = flat;
 
-        /* Initialize the starting span_info's and spans */
-        spans = iter->u.hyp.spans;
+        /* Initialize the starting spans (the first list of spans in each
+         * dimension is at the start of the dimension's spans)
+         */
         for(u = 0; u < rank; u++) {
-            /* Set the pointers to the initial span in each dimension */
-            HDassert(spans);
-            HDassert(spans->head);
-
-            /* Set the pointer to the first span in the list for this node */
-            iter->u.hyp.span[u] = spans->head;
+            /* Set the index of the initial span in each dimension */
+            iter->u.hyp.span[u] = 0;
 
             /* Set the initial offset to low bound of span */
-            iter->u.hyp.off[u] = iter->u.hyp.span[u]->low;
-
-            /* Get the pointer to the next level down */
-            spans = spans->head->down;
+            if(flat->nspans[u] > 0)
+                iter->u.hyp.off[u] = flat->span[u][0].low;
+            else
+                iter->u.hyp.off[u] = 0;
         } /* end for */
 
         /* Flag the diminfo information as not valid in the iterator */
@@ -418,7 +458,8 @@ H5S_hyper_iter_init(H5S_sel_iter_t *iter, const H5S_t *space)
     /* Initialize type of selection iterator */
     iter->type = H5S_sel_iter_hyper;
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5S_hyper_iter_init() */
 
 
@@ -550,13 +591,11 @@ H5S_hyper_iter_block (const H5S_sel_iter_t *iter, hsize_t *start, hsize_t *end)
         } /* end for */
     } /* end if */
     else {
-        /* Copy the start of the block */
-        for(u=0; u<iter->rank; u++)
-            start[u]=iter->u.hyp.span[u]->low;
-
-        /* Copy the end of the block */
-        for(u=0; u<iter->rank; u++)
-            end[u]=iter->u.hyp.span[u]->high;
+        /* Copy the start & end of the block */
+        for(u=0; u<iter->rank; u++) {
+            start[u]=iter->u.hyp.flat->span[u][iter->u.hyp.span[u]].low;
+            end[u]=iter->u.hyp.flat->span[u][iter->u.hyp.span[u]].high;
+        } /* end for */
     } /* end else */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -636,7 +675,7 @@ H5S_hyper_iter_has_next_block(const H5S_sel_iter_t *iter)
     else {
         /* Check for any levels of the tree with more sequences in them */
         for(u = 0; u < iter->rank; u++)
-            if(iter->u.hyp.span[u]->next != NULL)
+            if(iter->u.hyp.span[u] < H5S_HYPER_FLAT_LAST_SPAN(iter, u))
                 HGOTO_DONE(TRUE);
     } /* end else */
 
@@ -760,8 +799,9 @@ H5S_hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
     } /* end if */
     /* Must be an irregular hyperslab selection */
     else {
-        H5S_hyper_span_t *curr_span;    /* Current hyperslab span node */
-        H5S_hyper_span_t **ispan;       /* Iterator's hyperslab span nodes */
+        H5S_hyper_flat_span_t * const *flat_span; /* Flattened spans for each dimension */
+        const H5S_hyper_flat_span_t *curr_span; /* Current hyperslab span */
+        size_t *ispan;                  /* Iterator's hyperslab span indices */
         hsize_t *abs_arr;              /* Absolute hyperslab span position */
         int curr_dim;                   /* Temporary rank holder */
 
@@ -769,9 +809,10 @@ H5S_hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
         ndims=iter->rank;
         fast_dim = (int)ndims - 1;
 
-        /* Get the pointers to the current span info and span nodes */
+        /* Get the pointers to the current spans */
         abs_arr=iter->u.hyp.off;
         ispan=iter->u.hyp.span;
+        flat_span=iter->u.hyp.flat->span;
 
         /* Loop through, advancing the span information, until all the nelements are accounted for */
         while(nelem>0) {
@@ -781,7 +822,7 @@ H5S_hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
             /* Work back up through the dimensions */
             while(curr_dim>=0) {
                 /* Reset the current span */
-                curr_span=ispan[curr_dim];
+                curr_span=&flat_span[curr_dim][ispan[curr_dim]];
 
                 /* Increment absolute position */
                 if(curr_dim==fast_dim) {
@@ -811,13 +852,11 @@ H5S_hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
                 } /* end if */
                 /* If we walked off that span, advance to the next span */
                 else {
-                    /* Advance span in this dimension */
-                    curr_span=curr_span->next;
-
                     /* Check if we have a valid span in this dimension still */
-                    if(curr_span!=NULL) {
-                        /* Reset the span in the current dimension */
-                        ispan[curr_dim]=curr_span;
+                    if(ispan[curr_dim]<H5S_HYPER_FLAT_LAST_SPAN(iter, curr_dim)) {
+                        /* Advance span in this dimension */
+                        ispan[curr_dim]++;
+                        curr_span++;
 
                         /* Reset absolute position */
                         abs_arr[curr_dim]=curr_span->low;
@@ -835,25 +874,18 @@ H5S_hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
             if(curr_dim>=0) {
                 /* Walk back down the iterator positions, reseting them */
                 while(curr_dim<fast_dim) {
-                    HDassert(curr_span);
-                    HDassert(curr_span->down);
-                    HDassert(curr_span->down->head);
+                    /* Set the span for the next dimension down */
+                    ispan[curr_dim + 1]=curr_span->down_first;
 
                     /* Increment current dimension */
                     curr_dim++;
 
-                    /* Set the new span_info & span for this dimension */
-                    ispan[curr_dim]=curr_span->down->head;
-
                     /* Advance span down the tree */
-                    curr_span=curr_span->down->head;
+                    curr_span=&flat_span[curr_dim][ispan[curr_dim]];
 
                     /* Reset the absolute offset for the dim */
                     abs_arr[curr_dim]=curr_span->low;
                 } /* end while */
-
-                /* Verify that the curr_span points to the fastest dim */
-                HDassert(curr_span==ispan[fast_dim]);
             } /* end if */
         } /* end while */
     } /* end else */
@@ -960,8 +992,9 @@ H5S_hyper_iter_next_block(H5S_sel_iter_t *iter)
     } /* end if */
     /* Must be an irregular hyperslab selection */
     else {
-        H5S_hyper_span_t *curr_span;    /* Current hyperslab span node */
-        H5S_hyper_span_t **ispan;       /* Iterator's hyperslab span nodes */
+        H5S_hyper_flat_span_t * const *flat_span; /* Flattened spans for each dimension */
+        const H5S_hyper_flat_span_t *curr_span; /* Current hyperslab span */
+        size_t *ispan;                  /* Iterator's hyperslab span indices */
         hsize_t *abs_arr;              /* Absolute hyperslab span position */
         int curr_dim;                   /* Temporary rank holder */
 
@@ -969,9 +1002,10 @@ H5S_hyper_iter_next_block(H5S_sel_iter_t *iter)
         ndims = iter->rank;
         fast_dim = (int)ndims - 1;
 
-        /* Get the pointers to the current span info and span nodes */
+        /* Get the pointers to the current spans */
         abs_arr=iter->u.hyp.off;
         ispan=iter->u.hyp.span;
+        flat_span=iter->u.hyp.flat->span;
 
         /* Loop through, advancing the span information, until all the nelements are accounted for */
         curr_dim=fast_dim; /* Start at the fastest dim */
@@ -979,7 +1013,7 @@ H5S_hyper_iter_next_block(H5S_sel_iter_t *iter)
         /* Work back up through the dimensions */
         while(curr_dim>=0) {
             /* Reset the current span */
-            curr_span=ispan[curr_dim];
+            curr_span=&flat_span[curr_dim][ispan[curr_dim]];
 
             /* Increment absolute position */
             if(curr_dim==fast_dim) {
@@ -997,13 +1031,11 @@ H5S_hyper_iter_next_block(H5S_sel_iter_t *iter)
             } /* end if */
             /* If we walked off that span, advance to the next span */
             else {
-                /* Advance span in this dimension */
-                curr_span=curr_span->next;
-
                 /* Check if we have a valid span in this dimension still */
-                if(curr_span!=NULL) {
-                    /* Reset the span in the current dimension */
-                    ispan[curr_dim]=curr_span;
+                if(ispan[curr_dim]<H5S_HYPER_FLAT_LAST_SPAN(iter, curr_dim)) {
+                    /* Advance span in this dimension */
+                    ispan[curr_dim]++;
+                    curr_span++;
 
                     /* Reset absolute position */
                     abs_arr[curr_dim]=curr_span->low;
@@ -1021,25 +1053,18 @@ H5S_hyper_iter_next_block(H5S_sel_iter_t *iter)
         if(curr_dim>=0) {
             /* Walk back down the iterator positions, reseting them */
             while(curr_dim<fast_dim) {
-                HDassert(curr_span);
-                HDassert(curr_span->down);
-                HDassert(curr_span->down->head);
+                /* Set the span for the next dimension down */
+                ispan[curr_dim + 1]=curr_span->down_first;
 
                 /* Increment current dimension */
                 curr_dim++;
 
-                /* Set the new span_info & span for this dimension */
-                ispan[curr_dim]=curr_span->down->head;
-
                 /* Advance span down the tree */
-                curr_span=curr_span->down->head;
+                curr_span=&flat_span[curr_dim][ispan[curr_dim]];
 
                 /* Reset the absolute offset for the dim */
                 abs_arr[curr_dim]=curr_span->low;
             } /* end while */
-
-            /* Verify that the curr_span points to the fastest dim */
-            HDassert(curr_span == ispan[fast_dim]);
         } /* end if */
     } /* end else */
 
@@ -1073,9 +1098,9 @@ H5S_hyper_iter_release (H5S_sel_iter_t *iter)
     HDassert(iter);
 
 /* Release the information needed for non-regular hyperslab I/O */
-    /* Free the copy of the selections span tree */
-    if(iter->u.hyp.spans != NULL)
-        H5S_hyper_free_span_info(iter->u.hyp.spans);
+    /* Release the flattened span tree */
+    if(iter->u.hyp.flat != NULL)
+        H5S_hyper_free_flat(iter->u.hyp.flat);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }   /* H5S_hyper_iter_release() */
@@ -1132,101 +1157,234 @@ done:
 
 /*--------------------------------------------------------------------------
  NAME
-    H5S_hyper_span_precompute_helper
+    H5S_hyper_flatten_helper
  PURPOSE
-    Helper routine to precompute the nelem and pstrides in bytes.
+    Helper routine to flatten a hyperslab span tree
  USAGE
-    herr_t H5S_hyper_span_precompute_helper(span_info, elmt_size)
-        H5S_hyper_span_info_t *span_info;      IN/OUT: Span tree to work on
-        size_t elmt_size;                      IN: element size to work with
+    void H5S_hyper_flatten_helper(spans, dim, flat, last)
+        const H5S_hyper_span_info_t *spans;  IN: List of spans to add
+        unsigned dim;                        IN: Dimension of the list of spans
+        H5S_hyper_flat_t *flat;              IN/OUT: Flattened span tree
+        H5S_hyper_flat_last_t *last;         IN/OUT: Last list of spans added
+                                                in each dimension
  RETURNS
-    Non-negative on success, negative on failure
+    None
  DESCRIPTION
-    Change the nelem and pstride values in the span tree from elements to
-    bytes using the elmt_size parameter.
+    Add a list of spans, and the lists of spans below it, to the arrays of
+    spans for each dimension of a flattened span tree.  A list of spans
+    which is the same as the last list added for its dimension is not added
+    again.  If the arrays of spans for the flattened tree aren't allocated,
+    the spans in each dimension are only counted.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
+    Counting the spans and filling in the arrays must use the same
+    H5S_hyper_flat_last_t information, to get the same lists of spans.
  EXAMPLES
  REVISION LOG
 --------------------------------------------------------------------------*/
-static herr_t
-H5S_hyper_span_precompute_helper (H5S_hyper_span_info_t *spans, size_t elmt_size)
+static void
+H5S_hyper_flatten_helper(const H5S_hyper_span_info_t *spans, unsigned dim,
+    H5S_hyper_flat_t *flat, H5S_hyper_flat_last_t *last)
 {
-    H5S_hyper_span_t *span;     /* Hyperslab span */
-    herr_t      ret_value = SUCCEED;       /* Return value */
+    const H5S_hyper_span_t *span;   /* Hyperslab span */
 
-    FUNC_ENTER_NOAPI_NOINIT
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     HDassert(spans);
+    HDassert(flat);
+    HDassert(dim < flat->rank);
+    HDassert(last);
+
+    /* Remember where the list of spans starts */
+    last[dim].spans = spans;
+    last[dim].first = flat->nspans[dim];
+
+    /* Add each span in the list */
+    for(span = spans->head; span != NULL; span = span->next) {
+        size_t idx = flat->nspans[dim]++;  /* Index of span in flattened tree */
+
+        /* Add the spans in the next dimension down, if they haven't just been added */
+        if(span->down != NULL) {
+            HDassert(dim + 1 < flat->rank);
+            if(span->down != last[dim + 1].spans)
+                H5S_hyper_flatten_helper(span->down, dim + 1, flat, last);
+        } /* end if */
 
-    /* Check if we've already set this down span tree */
-    if(spans->scratch!=(H5S_hyper_span_info_t *)~((size_t)NULL)) {
-        /* Set the tree's scratch pointer */
-        spans->scratch=(H5S_hyper_span_info_t *)~((size_t)NULL);
-
-        /* Set the scratch pointers in all the nodes */
-        span=spans->head;
+        /* Set the span's information, if the spans aren't just being counted */
+        if(flat->span[dim] != NULL) {
+            H5S_hyper_flat_span_t *flat_span = &flat->span[dim][idx];
 
-        /* Loop over all the spans for this down span tree */
-        while(span!=NULL) {
-            /* If there are down spans, set their scratch value also */
-            if(span->down!=NULL) {
-                if(H5S_hyper_span_precompute_helper(span->down,elmt_size)==FAIL)
-                    HGOTO_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "can't reset hyperslab scratch pointer")
+            flat_span->low = span->low;
+            flat_span->high = span->high;
+            if(span->down != NULL) {
+                flat_span->down_first = last[dim + 1].first;
+                flat_span->down_last = last[dim + 1].last;
             } /* end if */
+            else
+                flat_span->down_first = flat_span->down_last = 0;
+        } /* end if */
+    } /* end for */
 
-            /* Change the nelem & pstride values into bytes */
-            span->nelem *= elmt_size;
-            span->pstride *= elmt_size;
+    /* Remember where the list of spans ends */
+    if(flat->nspans[dim] > last[dim].first)
+        last[dim].last = flat->nspans[dim] - 1;
 
-            /* Advance to next span */
-            span=span->next;
-        } /* end while */
-    } /* end if */
+    FUNC_LEAVE_NOAPI_VOID
+}   /* H5S_hyper_flatten_helper() */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-}   /* H5S_hyper_span_precompute_helper() */
 
-
 /*--------------------------------------------------------------------------
  NAME
-    H5S_hyper_span_precompute
+    H5S_hyper_get_flat
  PURPOSE
-    Precompute the nelem and pstrides in bytes.
+    Get the flattened version of a hyperslab span tree
  USAGE
-    herr_t H5S_hyper_span_precompute(span_info, elmt_size)
-        H5S_hyper_span_info_t *span_info;      IN/OUT: Span tree to work on
-        size_t elmt_size;                      IN: element size to work with
+    H5S_hyper_flat_t *H5S_hyper_get_flat(spans, rank)
+        H5S_hyper_span_info_t *spans;   IN: Span tree to flatten
+        unsigned rank;                  IN: Number of dimensions of span tree
  RETURNS
-    Non-negative on success, negative on failure
+    Pointer to the flattened span tree on success, NULL on failure
  DESCRIPTION
-    Change the nelem and pstride values in the span tree from elements to
-    bytes using the elmt_size parameter.
+    Get a flattened, read-only copy of a span tree for iterating over it,
+    holding a reference to it which must be released with
+    H5S_hyper_free_flat().  The flattened tree is built the first time it's
+    needed and is kept with the span tree, so iterators over the same
+    selection (and over its shared copies) use the same one.  Routines
+    which change the span tree in place must drop the flattened copy with
+    H5S_hyper_reset_flat().
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
+    The spans for all dimensions are allocated along with the flattened
+    tree, as one block of memory.
  EXAMPLES
  REVISION LOG
 --------------------------------------------------------------------------*/
-static herr_t
-H5S_hyper_span_precompute(H5S_hyper_span_info_t *spans, size_t elmt_size)
+static H5S_hyper_flat_t *
+H5S_hyper_get_flat(H5S_hyper_span_info_t *spans, unsigned rank)
 {
-    herr_t      ret_value = SUCCEED;       /* Return value */
+    H5S_hyper_flat_t *ret_value = NULL;     /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
 
     HDassert(spans);
+    HDassert(rank > 0 && rank <= H5S_MAX_RANK);
+
+    /* Flatten the span tree, if it hasn't been already */
+    if(NULL == spans->flat) {
+        H5S_hyper_flat_t count_flat;        /* Number of spans in each dimension */
+        H5S_hyper_flat_last_t last[H5S_MAX_RANK];   /* Last list of spans added in each dimension */
+        H5S_hyper_flat_t *flat;             /* New flattened span tree */
+        H5S_hyper_flat_span_t *flat_span;   /* Spans for all dimensions */
+        size_t nspans;                      /* Total number of spans */
+        unsigned u;                         /* Local index variable */
+
+        /* Count the spans in each dimension */
+        HDmemset(&count_flat, 0, sizeof(count_flat));
+        count_flat.rank = rank;
+        HDmemset(last, 0, sizeof(last));
+        H5S_hyper_flatten_helper(spans, 0, &count_flat, last);
+        for(u = 0, nspans = 0; u < rank; u++)
+            nspans += count_flat.nspans[u];
+
+        /* Allocate the flattened span tree, with the spans after it */
+        if(NULL == (flat = (H5S_hyper_flat_t *)H5MM_malloc(sizeof(H5S_hyper_flat_t) + (nspans * sizeof(H5S_hyper_flat_span_t)))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate flattened span tree")
+        HDmemset(flat, 0, sizeof(H5S_hyper_flat_t));
+        flat->count = 1;
+        flat->rank = rank;
+
+        /* Set up the spans for each dimension */
+        flat_span = (H5S_hyper_flat_span_t *)(void *)(flat + 1);
+        for(u = 0; u < rank; u++) {
+            flat->span[u] = flat_span;
+            flat_span += count_flat.nspans[u];
+        } /* end for */
 
-    /* Call the helper routine to actually do the work */
-    if(H5S_hyper_span_precompute_helper(spans, elmt_size) < 0)
-        HGOTO_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "can't precompute span info")
+        /* Fill in the spans */
+        HDmemset(last, 0, sizeof(last));
+        H5S_hyper_flatten_helper(spans, 0, flat, last);
+        HDassert(0 == HDmemcmp(flat->nspans, count_flat.nspans, sizeof(flat->nspans)));
 
-    /* Reset the scratch pointers for the next routine which needs them */
-    H5S_hyper_span_scratch(spans, NULL);
+        /* Keep the flattened span tree with the span tree */
+        spans->flat = flat;
+    } /* end if */
+
+    /* Share the flattened span tree */
+    spans->flat->count++;
+    ret_value = spans->flat;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-}   /* H5S_hyper_span_precompute() */
+}   /* H5S_hyper_get_flat() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_hyper_free_flat
+ PURPOSE
+    Release a reference to a flattened hyperslab span tree
+ USAGE
+    void H5S_hyper_free_flat(flat)
+        H5S_hyper_flat_t *flat;     IN: Flattened span tree to release
+ RETURNS
+    None
+ DESCRIPTION
+    Decrement the reference count of a flattened span tree, freeing it when
+    it's no longer used.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void
+H5S_hyper_free_flat(H5S_hyper_flat_t *flat)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(flat);
+    HDassert(flat->count > 0);
+
+    /* Free the flattened span tree if the reference count drops to zero */
+    if(--flat->count == 0)
+        flat = (H5S_hyper_flat_t *)H5MM_xfree(flat);
+
+    FUNC_LEAVE_NOAPI_VOID
+}   /* H5S_hyper_free_flat() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_hyper_reset_flat
+ PURPOSE
+    Drop the flattened version of a hyperslab span tree
+ USAGE
+    void H5S_hyper_reset_flat(spans)
+        H5S_hyper_span_info_t *spans;   IN/OUT: Span tree
+ RETURNS
+    None
+ DESCRIPTION
+    Release the flattened copy of a span tree kept with it, if there is
+    one, because the span tree is changing or being freed.  Iterators
+    already using the flattened copy keep their own reference to it.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void
+H5S_hyper_reset_flat(H5S_hyper_span_info_t *spans)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(spans);
+
+    if(spans->flat) {
+        H5S_hyper_free_flat(spans->flat);
+        spans->flat = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+}   /* H5S_hyper_reset_flat() */
 
 
 /*--------------------------------------------------------------------------
@@ -1322,6 +1480,7 @@ H5S_hyper_copy_span_helper (H5S_hyper_span_info_t *spans)
         /* Copy the span_info information */
         ret_value->count = 1;
         ret_value->scratch = NULL;
+        ret_value->flat = NULL;
         ret_value->head = NULL;
 
         /* Set the scratch pointer in the node being copied to the newly allocated node */
@@ -1541,6 +1700,8 @@ H5S_hyper_free_span_info (H5S_hyper_span_info_t *span_info)
 
     /* Free the span tree if the reference count drops to zero */
     if(span_info->count==0) {
+        /* Release the flattened copy of the span tree, if there is one */
+        H5S_hyper_reset_flat(span_info);
 
         /* Work through the list of spans pointed to by this 'info' node */
         span=span_info->head;
@@ -3477,6 +3638,7 @@ H5S_hyper_coord_to_span(unsigned rank, hsize_t *coords)
 
         /* Reset the scratch pad space */
         down->scratch=0;
+        down->flat=NULL;
 
         /* Build span tree for coordinates below this one */
         if((down->head=H5S_hyper_coord_to_span(rank-1,&coords[1]))==NULL)
@@ -3745,6 +3907,7 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, hsize_t *coords)
 
         /* Reset the scratch pad space */
         head->scratch = 0;
+        head->flat = NULL;
 
         /* Build span tree for this coordinate */
         if(NULL == (head->head = H5S_hyper_coord_to_span(rank, coords)))
@@ -3770,6 +3933,9 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, hsize_t *coords)
         space->select.num_elem = 1;
     } /* end if */
     else {
+        /* Drop the flattened copy of the span tree, as it's changing */
+        H5S_hyper_reset_flat(space->select.sel_info.hslab->span_lst);
+
         if(H5S_hyper_add_span_element_helper(space->select.sel_info.hslab->span_lst, rank, coords) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate hyperslab span")
 
@@ -4163,6 +4329,9 @@ H5S_hyper_adjust_helper_u (H5S_hyper_span_info_t *spans, const hsize_t *offset)
         /* Set the tree's scratch pointer */
         spans->scratch=(H5S_hyper_span_info_t *)~((size_t)NULL);
 
+        /* Drop the flattened copy of the span tree, as it's changing */
+        H5S_hyper_reset_flat(spans);
+
         /* Get the span lists for each span in this tree */
         span=spans->head;
 
@@ -4409,6 +4578,7 @@ H5S_hyper_project_simple_higher(const H5S_t *base_space, H5S_t *new_space)
         /* Set the span_info information */
         new_span_info->count = 1;
         new_span_info->scratch = NULL;
+        new_span_info->flat = NULL;
         new_span_info->head = new_span;
 
         /* Attach to new space, if top span info */
@@ -4642,6 +4812,9 @@ H5S_hyper_adjust_helper_s(H5S_hyper_span_info_t *spans, const hssize_t *offset)
         /* Set the tree's scratch pointer */
         spans->scratch = (H5S_hyper_span_info_t *)~((size_t)NULL);
 
+        /* Drop the flattened copy of the span tree, as it's changing */
+        H5S_hyper_reset_flat(spans);
+
         /* Get the span lists for each span in this tree */
         span = spans->head;
 
@@ -4865,6 +5038,7 @@ H5S_hyper_append_span (H5S_hyper_span_t **prev_span, H5S_hyper_span_info_t ** sp
         /* Set the span tree's basic information */
         (*span_tree)->count=1;
         (*span_tree)->scratch=NULL;
+        (*span_tree)->flat=NULL;
         (*span_tree)->head=new_span;
 
         /* Update previous merged span */
@@ -5949,6 +6123,7 @@ H5S_hyper_make_spans(unsigned rank, const hsize_t *start, const hsize_t *stride,
 
         /* Reset the scratch pad space */
         down->scratch = 0;
+        down->flat = NULL;
 
         /* Keep the pointer to the next dimension down's completed list */
         down->head = head;
@@ -5987,6 +6162,216 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5S_hyper_make_spans() */
 
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_hyper_slab_event_cmp
+ PURPOSE
+    Compare two hyperslab list events by coordinate, for HDqsort()
+ USAGE
+    int H5S_hyper_slab_event_cmp(event1, event2)
+        const void *event1, *event2;    IN: Events to compare
+ RETURNS
+    <0, 0 or >0, as for qsort()
+ DESCRIPTION
+    Orders the events where hyperslabs start and end in one dimension.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static int
+H5S_hyper_slab_event_cmp(const void *_event1, const void *_event2)
+{
+    const H5S_hyper_slab_event_t *event1 = (const H5S_hyper_slab_event_t *)_event1;
+    const H5S_hyper_slab_event_t *event2 = (const H5S_hyper_slab_event_t *)_event2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(event1->coord < event2->coord)
+        ret_value = -1;
+    else if(event1->coord > event2->coord)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5S_hyper_slab_event_cmp() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_hyper_make_spans_list
+ PURPOSE
+    Create a span tree for the union of a list of hyperslabs
+ USAGE
+    H5S_hyper_span_info_t *H5S_hyper_make_spans_list(rank, dim, slabs, nidx, idx)
+        unsigned rank;                  IN: # of dimensions of the space
+        unsigned dim;                   IN: Dimension to build spans for
+        const H5S_hyper_slab_t *slabs;  IN: List of hyperslabs
+        size_t nidx;                    IN: # of hyperslabs to combine
+        const size_t *idx;              IN: Indices of hyperslabs to combine
+ RETURNS
+    Pointer to new span tree on success, NULL on failure
+ DESCRIPTION
+    Builds the span tree for the union of the hyperslabs in IDX, for
+    dimension DIM and the dimensions below it, in one pass: the places where
+    the hyperslabs start and end in DIM are sorted, and each stretch of DIM
+    between two of them gets the span tree for the hyperslabs covering it.
+    This avoids clipping and merging span trees for each hyperslab in turn,
+    as repeated H5S_SELECT_OR operations would.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    None of the hyperslabs may be empty or unlimited, and their blocks may
+    not overlap within a hyperslab.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_hyper_span_info_t *
+H5S_hyper_make_spans_list(unsigned rank, unsigned dim,
+    const H5S_hyper_slab_t *slabs, size_t nidx, const size_t *idx)
+{
+    H5S_hyper_slab_event_t *events = NULL;  /* Starts & ends of hyperslab blocks */
+    size_t *scratch = NULL;     /* Scratch space for active hyperslab lists */
+    size_t *active;             /* Hyperslabs covering the current stretch */
+    size_t *active_pos;         /* Position of each hyperslab in 'active' */
+    size_t *down_idx;           /* Indices of hyperslabs for the next dimension */
+    size_t nactive = 0;         /* # of hyperslabs covering the current stretch */
+    size_t nevents = 0;         /* # of events */
+    H5S_hyper_span_info_t *spans = NULL;    /* New span tree */
+    H5S_hyper_span_info_t *down = NULL;     /* Span tree for the next dimension */
+    H5S_hyper_span_t *last_span = NULL;     /* Last span in the new tree */
+    size_t u, v;                /* Local index variables */
+    H5S_hyper_span_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check args */
+    HDassert(rank > 0);
+    HDassert(dim < rank);
+    HDassert(slabs);
+    HDassert(nidx > 0);
+    HDassert(idx);
+
+    /* Count the blocks of the hyperslabs in this dimension.  Blocks which
+     * touch (stride equal to block) form a single block.
+     */
+    for(u = 0; u < nidx; u++) {
+        const H5S_hyper_slab_t *slab = &slabs[idx[u]];
+
+        if(slab->count[dim] == 1 || slab->stride[dim] == slab->block[dim])
+            nevents += 2;
+        else
+            nevents += 2 * slab->count[dim];
+    } /* end for */
+
+    /* Allocate space for the events and the lists of hyperslabs */
+    if(NULL == (events = (H5S_hyper_slab_event_t *)H5MM_malloc(nevents * sizeof(H5S_hyper_slab_event_t))))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab events")
+    if(NULL == (scratch = (size_t *)H5MM_malloc(3 * nidx * sizeof(size_t))))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab lists")
+    active = scratch;
+    active_pos = scratch + nidx;
+    down_idx = scratch + (2 * nidx);
+
+    /* Record where each block starts and where it ends */
+    nevents = 0;
+    for(u = 0; u < nidx; u++) {
+        const H5S_hyper_slab_t *slab = &slabs[idx[u]];
+        hsize_t start = slab->start[dim];
+        hsize_t nblocks, block, stride;
+
+        if(slab->count[dim] == 1 || slab->stride[dim] == slab->block[dim]) {
+            nblocks = 1;
+            block = slab->count[dim] * slab->block[dim];
+            stride = 0;
+        } /* end if */
+        else {
+            nblocks = slab->count[dim];
+            block = slab->block[dim];
+            stride = slab->stride[dim];
+        } /* end else */
+
+        for(v = 0; v < nblocks; v++, start += stride) {
+            events[nevents].coord = start;
+            events[nevents].slab = u;
+            events[nevents].start = TRUE;
+            nevents++;
+            events[nevents].coord = start + block;
+            events[nevents].slab = u;
+            events[nevents].start = FALSE;
+            nevents++;
+        } /* end for */
+    } /* end for */
+
+    /* Sort the events */
+    HDqsort(events, nevents, sizeof(H5S_hyper_slab_event_t), H5S_hyper_slab_event_cmp);
+
+    /* Sweep through the dimension */
+    u = 0;
+    while(u < nevents) {
+        hsize_t low = events[u].coord;  /* Start of current stretch */
+
+        /* Update the hyperslabs covering the stretch starting here */
+        do {
+            size_t slab = events[u].slab;
+
+            if(events[u].start) {
+                active_pos[slab] = nactive;
+                active[nactive++] = slab;
+            } /* end if */
+            else {
+                /* Move the last active hyperslab into this one's place */
+                nactive--;
+                active[active_pos[slab]] = active[nactive];
+                active_pos[active[nactive]] = active_pos[slab];
+            } /* end else */
+            u++;
+        } while(u < nevents && events[u].coord == low);
+
+        /* Add a span for the stretch up to the next event, if it's covered */
+        if(nactive > 0) {
+            HDassert(u < nevents);
+
+            /* Build the span tree for the next dimension */
+            if(dim + 1 < rank) {
+                for(v = 0; v < nactive; v++)
+                    down_idx[v] = idx[active[v]];
+                if(NULL == (down = H5S_hyper_make_spans_list(rank, dim + 1, slabs, nactive, down_idx)))
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, NULL, "can't create hyperslab spans")
+            } /* end if */
+
+            /* Append the span, merging it with the previous one if they
+             * touch and have the same spans below
+             */
+            if(H5S_hyper_append_span(&last_span, &spans, low, events[u].coord - 1, down, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
+
+            /* Release this routine's reference to the down spans */
+            if(down) {
+                if(H5S_hyper_free_span_info(down) < 0)
+                    HGOTO_ERROR(H5E_INTERNAL, H5E_CANTFREE, NULL, "failed to release hyperslab spans")
+                down = NULL;
+            } /* end if */
+        } /* end if */
+    } /* end while */
+
+    /* Set return value */
+    ret_value = spans;
+
+done:
+    if(down)
+        if(H5S_hyper_free_span_info(down) < 0)
+            HDONE_ERROR(H5E_INTERNAL, H5E_CANTFREE, NULL, "failed to release hyperslab spans")
+    if(NULL == ret_value && spans)
+        if(H5S_hyper_free_span_info(spans) < 0)
+            HDONE_ERROR(H5E_INTERNAL, H5E_CANTFREE, NULL, "failed to release hyperslab spans")
+    events = (H5S_hyper_slab_event_t *)H5MM_xfree(events);
+    scratch = (size_t *)H5MM_xfree(scratch);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5S_hyper_make_spans_list() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -6271,9 +6656,6 @@ H5S_generate_hyperslab (H5S_t *space, H5S_seloper_t op,
 		      const hsize_t block[])
 {
     H5S_hyper_span_info_t *new_spans=NULL;  /* Span tree for new hyperslab */
-    H5S_hyper_span_info_t *a_not_b=NULL;    /* Span tree for hyperslab spans in old span tree and not in new span tree */
-    H5S_hyper_span_info_t *a_and_b=NULL;    /* Span tree for hyperslab spans in both old and new span trees */
-    H5S_hyper_span_info_t *b_not_a=NULL;    /* Span tree for hyperslab spans in new span tree and not in old span tree */
     herr_t      ret_value=SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -6290,6 +6672,45 @@ H5S_generate_hyperslab (H5S_t *space, H5S_seloper_t op,
     if((new_spans=H5S_hyper_make_spans(space->extent.rank,start,stride,count,block))==NULL)
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't create hyperslab information")
 
+    /* Combine the new spans with the current selection */
+    if(H5S_hyper_apply_spans(space, op, new_spans) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't combine hyperslabs")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_generate_hyperslab() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S_hyper_apply_spans
+ *
+ * Purpose:	Combine a span tree with the current hyperslab selection,
+ *              for H5S_generate_hyperslab() and H5S_select_hyperslab_list().
+ *              Takes ownership of NEW_SPANS.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Quincey Koziol
+ *              Tuesday, September 12, 2000
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S_hyper_apply_spans(H5S_t *space, H5S_seloper_t op,
+    H5S_hyper_span_info_t *new_spans)
+{
+    H5S_hyper_span_info_t *a_not_b=NULL;    /* Span tree for hyperslab spans in old span tree and not in new span tree */
+    H5S_hyper_span_info_t *a_and_b=NULL;    /* Span tree for hyperslab spans in both old and new span trees */
+    H5S_hyper_span_info_t *b_not_a=NULL;    /* Span tree for hyperslab spans in new span tree and not in old span tree */
+    herr_t      ret_value=SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check args */
+    HDassert(space);
+    HDassert(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID);
+    HDassert(new_spans);
+
     /* Generate list of blocks to add/remove based on selection operation */
     if(op==H5S_SELECT_SET) {
         /* Add new spans to current selection */
@@ -6456,6 +6877,7 @@ H5S_generate_hyperslab (H5S_t *space, H5S_seloper_t op,
 
             /* Reset the scratch pad space */
             spans->scratch=0;
+            spans->flat=NULL;
 
             /* Set to empty tree */
             spans->head=NULL;
@@ -6491,7 +6913,7 @@ done:
             HDONE_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "failed to release temporary hyperslab spans")
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5S_generate_hyperslab() */
+} /* end H5S_hyper_apply_spans() */
 
 
 /*-------------------------------------------------------------------------
@@ -6846,6 +7268,254 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5S_select_hyperslab() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S_select_hyperslab_list
+ *
+ * Purpose:	Internal version of H5Sselect_hyperslab_list().
+ *
+ *              The union of the hyperslabs is built as a single span tree,
+ *              which is then combined with the current selection in one
+ *              operation.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S_select_hyperslab_list(H5S_t *space, H5S_seloper_t op, size_t nslabs,
+    const hsize_t start[], const hsize_t stride[], const hsize_t count[],
+    const hsize_t block[])
+{
+    H5S_hyper_slab_t *slabs = NULL;     /* Information for each hyperslab */
+    size_t *idx = NULL;                 /* Indices of non-empty hyperslabs */
+    size_t nidx = 0;                    /* # of non-empty hyperslabs */
+    H5S_hyper_span_info_t *new_spans = NULL;    /* Span tree for union of hyperslabs */
+    unsigned rank = space->extent.rank; /* Rank of dataspace */
+    size_t n;                           /* Local index variable */
+    unsigned u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check args */
+    HDassert(space);
+    HDassert(nslabs == 0 || start);
+    HDassert(nslabs == 0 || count);
+    HDassert(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID);
+
+    /* Allocate space for the hyperslab information */
+    if(nslabs > 0) {
+        if(NULL == (slabs = (H5S_hyper_slab_t *)H5MM_malloc(nslabs * sizeof(H5S_hyper_slab_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate hyperslab list")
+        if(NULL == (idx = (size_t *)H5MM_malloc(nslabs * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate hyperslab list")
+    } /* end if */
+
+    /* Check the hyperslabs and set aside the empty ones */
+    for(n = 0; n < nslabs; n++) {
+        hbool_t empty = FALSE;          /* Whether the hyperslab selects nothing */
+
+        slabs[n].start = start + (n * rank);
+        slabs[n].stride = stride ? stride + (n * rank) : _ones;
+        slabs[n].count = count + (n * rank);
+        slabs[n].block = block ? block + (n * rank) : _ones;
+
+        for(u = 0; u < rank; u++) {
+            if(slabs[n].count[u] == H5S_UNLIMITED || slabs[n].block[u] == H5S_UNLIMITED)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "unlimited hyperslabs not supported in a list")
+            if(slabs[n].count[u] > 1 && slabs[n].stride[u] < slabs[n].block[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "hyperslab blocks overlap")
+            if(slabs[n].count[u] == 0 || slabs[n].block[u] == 0)
+                empty = TRUE;
+        } /* end for */
+
+        if(!empty)
+            idx[nidx++] = n;
+    } /* end for */
+
+    /* Check for the union of the hyperslabs being empty */
+    if(nidx == 0) {
+        switch(op) {
+            case H5S_SELECT_SET:   /* Select "set" operation */
+            case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
+            case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
+                /* Convert to "none" selection */
+                if(H5S_select_none(space) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
+                HGOTO_DONE(SUCCEED);
+
+            case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
+            case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
+            case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
+                HGOTO_DONE(SUCCEED);        /* Selection stays same */
+
+            case H5S_SELECT_NOOP:
+            case H5S_SELECT_APPEND:
+            case H5S_SELECT_PREPEND:
+            case H5S_SELECT_INVALID:
+            default:
+                HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+        } /* end switch */
+    } /* end if */
+
+    /* Check for operating on unlimited selection */
+    if((H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS)
+            && (space->select.sel_info.hslab->unlim_dim >= 0)
+            && (op != H5S_SELECT_SET))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "unsupported operation on unlimited selection")
+
+    /* Fixup operation for non-hyperslab selections */
+    switch(H5S_GET_SELECT_TYPE(space)) {
+        case H5S_SEL_NONE:   /* No elements selected in dataspace */
+            switch(op) {
+                case H5S_SELECT_SET:   /* Select "set" operation */
+                    /* Change "none" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
+                case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
+                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
+                    break;
+
+                case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
+                case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
+                    HGOTO_DONE(SUCCEED);        /* Selection stays "none" */
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_ALL:    /* All elements selected in dataspace */
+            switch(op) {
+                case H5S_SELECT_SET:   /* Select "set" operation */
+                    /* Change "all" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
+                    HGOTO_DONE(SUCCEED);        /* Selection stays "all" */
+
+                case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
+                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "all" selection */
+                    break;
+
+                case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
+                    /* Convert current "all" selection to "real" hyperslab selection */
+                    /* Then allow operation to proceed */
+                    {
+                        hsize_t tmp_start[H5O_LAYOUT_NDIMS];   /* Temporary start information */
+
+                        /* Fill in temporary information for the dimensions */
+                        for(u = 0; u < rank; u++)
+                            tmp_start[u] = 0;
+
+                        /* Convert to hyperslab selection */
+                        if(H5S_select_hyperslab(space, H5S_SELECT_SET, tmp_start, _ones, _ones, space->extent.size) < 0)
+                            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
+                    } /* end case */
+                    break;
+
+                case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
+                    /* Convert to "none" selection */
+                    if(H5S_select_none(space) < 0)
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
+                    HGOTO_DONE(SUCCEED);
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_HYPERSLABS:
+            /* Hyperslab operation on hyperslab selection, OK */
+            break;
+
+        case H5S_SEL_POINTS: /* Can't combine hyperslab operations and point selections currently */
+            if(op == H5S_SELECT_SET)    /* Allow only "set" operation to proceed */
+                break;
+            /* Else fall through to error */
+
+        case H5S_SEL_ERROR:
+        case H5S_SEL_N:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+    } /* end switch */
+
+    /* Build the span tree for the union of the hyperslabs */
+    if(NULL == (new_spans = H5S_hyper_make_spans_list(rank, 0, slabs, nidx, idx)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't create hyperslab information")
+
+    if(op == H5S_SELECT_SET) {
+        /* If we are setting a new selection, remove current selection first */
+        if(H5S_SELECT_RELEASE(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection")
+
+        /* Allocate space for the hyperslab selection information */
+        if(NULL == (space->select.sel_info.hslab = H5FL_CALLOC(H5S_hyper_sel_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate hyperslab info")
+
+        /* Set unlim_dim */
+        space->select.sel_info.hslab->unlim_dim = -1;
+
+        /* Use the new span tree for the selection */
+        space->select.sel_info.hslab->span_lst = new_spans;
+        new_spans = NULL;
+
+        /* Set the number of elements in current selection */
+        space->select.num_elem = H5S_hyper_spans_nelem(space->select.sel_info.hslab->span_lst);
+
+        /* Attempt to rebuild "optimized" start/stride/count/block information.
+         * from resulting hyperslab span tree
+         */
+        if(H5S_hyper_rebuild(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOUNT, FAIL, "can't rebuild hyperslab info")
+    } /* end if */
+    else if(op >= H5S_SELECT_OR && op <= H5S_SELECT_NOTA) {
+        /* Sanity check */
+        HDassert(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS);
+
+        /* Check if there's no hyperslab span information currently */
+        if(NULL == space->select.sel_info.hslab->span_lst)
+            if(H5S_hyper_generate_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNINITIALIZED, FAIL, "dataspace does not have span tree")
+
+        /* Indicate that the regular dimensions are no longer valid */
+        space->select.sel_info.hslab->diminfo_valid = FALSE;
+
+        /* Combine the union of the hyperslabs with the selection */
+        if(H5S_hyper_apply_spans(space, op, new_spans) < 0) {
+            new_spans = NULL;
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't combine hyperslabs")
+        } /* end if */
+        new_spans = NULL;
+    } /* end if */
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+
+    /* Set selection type */
+    space->select.type = H5S_sel_hyper;
+
+done:
+    if(new_spans)
+        if(H5S_hyper_free_span_info(new_spans) < 0)
+            HDONE_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "failed to release hyperslab spans")
+    slabs = (H5S_hyper_slab_t *)H5MM_xfree(slabs);
+    idx = (size_t *)H5MM_xfree(idx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5S_select_hyperslab_list() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -6909,6 +7579,80 @@ H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[],
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Sselect_hyperslab() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Sselect_hyperslab_list
+ PURPOSE
+    Specify a list of hyperslabs to combine with the current selection
+ USAGE
+    herr_t H5Sselect_hyperslab_list(dsid, op, nslabs, start, stride, count, block)
+        hid_t dsid;             IN: Dataspace ID of selection to modify
+        H5S_seloper_t op;       IN: Operation to perform on current selection
+        size_t nslabs;          IN: Number of hyperslabs in list
+        const hsize_t *start;        IN: Offsets of start of hyperslabs
+        const hsize_t *stride;       IN: Hyperslab strides
+        const hsize_t *count;        IN: Number of blocks included in hyperslabs
+        const hsize_t *block;        IN: Size of blocks in hyperslabs
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the union of NSLABS hyperslabs with the current selection for a
+    dataspace, with the same operations and results as H5Sselect_hyperslab().
+    Each array holds the values for the hyperslabs one after another, RANK
+    values for each.  If STRIDE or BLOCK is NULL, they are assumed to be set
+    to all '1'.
+
+    This is equivalent to selecting the first hyperslab with H5S_SELECT_SET,
+    OR'ing in each of the others and combining the result with the current
+    selection, but the union is built in one pass instead of merging each
+    hyperslab into the span tree in turn, which makes it much faster for
+    long lists of hyperslabs.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Unlimited hyperslabs are not supported, and neither are operations other
+    than H5S_SELECT_SET on an unlimited selection.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5Sselect_hyperslab_list(hid_t space_id, H5S_seloper_t op, size_t nslabs,
+    const hsize_t start[], const hsize_t stride[], const hsize_t count[],
+    const hsize_t block[])
+{
+    H5S_t *space;               /* Dataspace to modify selection of */
+    size_t n;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iSsz*h*h*h*h", space_id, op, nslabs, start, stride, count,
+             block);
+
+    /* Check args */
+    if(NULL == (space = (H5S_t *)H5I_object_verify(space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
+    if(H5S_SCALAR == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_SCALAR space")
+    if(H5S_NULL == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_NULL space")
+    if(nslabs > 0 && (start == NULL || count == NULL))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "hyperslabs not specified")
+    if(!(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+    if(stride != NULL) {
+        /* Check for 0-sized strides */
+        for(n = 0; n < nslabs * space->extent.rank; n++)
+            if(stride[n] == 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid stride==0 value")
+    } /* end if */
+
+    if(H5S_select_hyperslab_list(space, op, nslabs, start, stride, count, block) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to set hyperslab selection")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Sselect_hyperslab_list() */
 #else /* NEW_HYPERSLAB_API */ /* Works */
 
 /*-------------------------------------------------------------------------
@@ -7092,6 +7836,7 @@ H5S_operate_hyperslab (H5S_t *result, H5S_hyper_span_info_t *spans1, H5S_seloper
 
             /* Reset the scratch pad space */
             spans->scratch=0;
+            spans->flat=NULL;
 
             /* Set to empty tree */
             spans->head=NULL;
@@ -7956,8 +8701,11 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
     size_t maxseq, size_t maxelem, size_t *nseq, size_t *nelem,
     hsize_t *off, size_t *len)
 {
-    H5S_hyper_span_t *curr_span;    /* Current hyperslab span node */
-    H5S_hyper_span_t **ispan;       /* Iterator's hyperslab span nodes */
+    H5S_hyper_flat_span_t * const *flat_span; /* Flattened spans for each dimension */
+    const H5S_hyper_flat_span_t *curr_span; /* Current hyperslab span */
+    const H5S_hyper_flat_span_t *last_span; /* Last span in current list of spans in fastest changing dimension */
+    hsize_t prev_low;  /* Low bound of previous span */
+    size_t *ispan;     /* Iterator's hyperslab span indices */
     hsize_t slab[H5O_LAYOUT_NDIMS]; /* Cumulative size of each dimension in bytes */
     hsize_t acc;       /* Accumulator for computing cumulative sizes */
     hsize_t loc_off;   /* Element offset in the dataspace */
@@ -7992,11 +8740,13 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
     ndims = space->extent.rank;
     fast_dim = (ndims - 1);
 
-    /* Get the pointers to the current span info and span nodes */
-    curr_span = iter->u.hyp.span[fast_dim];
+    /* Get the pointers to the current spans */
+    flat_span = iter->u.hyp.flat->span;
+    ispan = iter->u.hyp.span;
+    curr_span = &flat_span[fast_dim][ispan[fast_dim]];
+    last_span = &flat_span[fast_dim][H5S_HYPER_FLAT_LAST_SPAN(iter, fast_dim)];
     abs_arr = iter->u.hyp.off;
     off_arr = space->select.offset;
-    ispan = iter->u.hyp.span;
     elem_size = iter->elmt_size;
 
     /* Set the amount of elements to perform I/O on, etc. */
@@ -8047,7 +8797,7 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
         /* Check if we are done */
         if(io_bytes_left > 0) {
             /* Move to next span in fastest changing dimension */
-            curr_span = curr_span->next;
+            curr_span = (curr_span < last_span) ? (curr_span + 1) : NULL;
 
             if(NULL != curr_span) {
                 /* Move location offset of destination */
@@ -8062,18 +8812,18 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
 
             /* Check if we are still within the span */
             if(abs_arr[fast_dim] <= curr_span->high) {
-                iter->u.hyp.span[fast_dim] = curr_span;
+                ispan[fast_dim] = (size_t)(curr_span - flat_span[fast_dim]);
             } /* end if */
             /* If we walked off that span, advance to the next span */
             else {
                 /* Advance span in this dimension */
-                curr_span = curr_span->next;
+                curr_span = (curr_span < last_span) ? (curr_span + 1) : NULL;
 
                 /* Check if we have a valid span in this dimension still */
                 if(NULL != curr_span) {
                     /* Reset absolute position */
                     abs_arr[fast_dim] = curr_span->low;
-                    iter->u.hyp.span[fast_dim] = curr_span;
+                    ispan[fast_dim] = (size_t)(curr_span - flat_span[fast_dim]);
                 } /* end if */
             } /* end else */
         } /* end else */
@@ -8088,7 +8838,7 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
             /* Work back up through the dimensions */
             while(curr_dim >= 0) {
                 /* Reset the current span */
-                curr_span = iter->u.hyp.span[curr_dim];
+                curr_span = &flat_span[curr_dim][ispan[curr_dim]];
 
                 /* Increment absolute position */
                 abs_arr[curr_dim]++;
@@ -8099,13 +8849,11 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
                 } /* end if */
                 /* If we walked off that span, advance to the next span */
                 else {
-                    /* Advance span in this dimension */
-                    curr_span = curr_span->next;
-
                     /* Check if we have a valid span in this dimension still */
-                    if(NULL != curr_span) {
-                        /* Reset the span in the current dimension */
-                        ispan[curr_dim] = curr_span;
+                    if(ispan[curr_dim] < H5S_HYPER_FLAT_LAST_SPAN(iter, curr_dim)) {
+                        /* Advance span in this dimension */
+                        ispan[curr_dim]++;
+                        curr_span++;
 
                         /* Reset absolute position */
                         abs_arr[curr_dim] = curr_span->low;
@@ -8123,26 +8871,20 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
             if(curr_dim >= 0) {
                 /* Walk back down the iterator positions, reseting them */
                 while((unsigned)curr_dim < fast_dim) {
-                    HDassert(curr_span);
-                    HDassert(curr_span->down);
-                    HDassert(curr_span->down->head);
+                    /* Set the span for the next dimension down */
+                    ispan[curr_dim + 1] = curr_span->down_first;
+                    last_span = &flat_span[curr_dim + 1][curr_span->down_last];
 
                     /* Increment current dimension */
                     curr_dim++;
 
-                    /* Set the new span_info & span for this dimension */
-                    iter->u.hyp.span[curr_dim] = curr_span->down->head;
-
                     /* Advance span down the tree */
-                    curr_span = curr_span->down->head;
+                    curr_span = &flat_span[curr_dim][ispan[curr_dim]];
 
                     /* Reset the absolute offset for the dim */
                     abs_arr[curr_dim] = curr_span->low;
                 } /* end while */
 
-                /* Verify that the curr_span points to the fastest dim */
-                HDassert(curr_span == iter->u.hyp.span[fast_dim]);
-
                 /* Reset the buffer offset */
                 for(u = 0, loc_off = 0; u < ndims; u++)
                     loc_off += ((hsize_t)((hssize_t)abs_arr[u] + off_arr[u])) * slab[u];
@@ -8158,16 +8900,17 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
         /* Sanity check */
         HDassert(curr_span);
 
-        /* Adjust location offset of destination to compensate for initial increment below */
-        loc_off -= curr_span->pstride;
+        /* The location offset of destination is at the start of the current span */
+        prev_low = curr_span->low;
 
         /* Loop over all the spans in the fastest changing dimension */
         while(curr_span != NULL) {
             /* Move location offset of destination */
-            loc_off += curr_span->pstride;
+            loc_off += (curr_span->low - prev_low) * elem_size;
+            prev_low = curr_span->low;
 
-            /* Compute the number of elements to attempt in this span */
-            H5_CHECKED_ASSIGN(span_size, size_t, curr_span->nelem, hsize_t);
+            /* Compute the number of bytes to attempt in this span */
+            H5_CHECKED_ASSIGN(span_size, size_t, ((curr_span->high - curr_span->low) + 1) * elem_size, hsize_t);
 
             /* Check number of elements against upper bounds allowed */
             if(span_size >= io_bytes_left) {
@@ -8226,7 +8969,7 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
             } /* end else */
 
 	    /* Move to next span in fastest changing dimension */
-	    curr_span=curr_span->next;
+	    curr_span=(curr_span<last_span) ? (curr_span+1) : NULL;
         } /* end while */
 
         /* Check if we are done */
@@ -8236,19 +8979,19 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
 
             /* Check if we are still within the span */
             if(abs_arr[fast_dim]<=curr_span->high) {
-                iter->u.hyp.span[fast_dim]=curr_span;
+                ispan[fast_dim]=(size_t)(curr_span-flat_span[fast_dim]);
                 break;
             } /* end if */
             /* If we walked off that span, advance to the next span */
             else {
                 /* Advance span in this dimension */
-                curr_span=curr_span->next;
+                curr_span=(curr_span<last_span) ? (curr_span+1) : NULL;
 
                 /* Check if we have a valid span in this dimension still */
                 if(curr_span!=NULL) {
                     /* Reset absolute position */
                     abs_arr[fast_dim]=curr_span->low;
-                    iter->u.hyp.span[fast_dim]=curr_span;
+                    ispan[fast_dim]=(size_t)(curr_span-flat_span[fast_dim]);
                     break;
                 } /* end if */
             } /* end else */
@@ -8262,7 +9005,7 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
         /* Work back up through the dimensions */
         while(curr_dim >= 0) {
             /* Reset the current span */
-	    curr_span=iter->u.hyp.span[curr_dim];
+	    curr_span=&flat_span[curr_dim][ispan[curr_dim]];
 
             /* Increment absolute position */
             abs_arr[curr_dim]++;
@@ -8273,13 +9016,11 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
             } /* end if */
             /* If we walked off that span, advance to the next span */
             else {
-                /* Advance span in this dimension */
-                curr_span=curr_span->next;
-
                 /* Check if we have a valid span in this dimension still */
-                if(curr_span!=NULL) {
-                    /* Reset the span in the current dimension */
-                    ispan[curr_dim]=curr_span;
+                if(ispan[curr_dim]<H5S_HYPER_FLAT_LAST_SPAN(iter, curr_dim)) {
+                    /* Advance span in this dimension */
+                    ispan[curr_dim]++;
+                    curr_span++;
 
                     /* Reset absolute position */
                     abs_arr[curr_dim]=curr_span->low;
@@ -8302,25 +9043,19 @@ H5S_hyper_get_seq_list_gen(const H5S_t *space,H5S_sel_iter_t *iter,
         else {
             /* Walk back down the iterator positions, reseting them */
             while((unsigned)curr_dim < fast_dim) {
-                HDassert(curr_span);
-                HDassert(curr_span->down);
-                HDassert(curr_span->down->head);
+                /* Set the new span for the next dimension down */
+                ispan[curr_dim + 1] = curr_span->down_first;
+                last_span = &flat_span[curr_dim + 1][curr_span->down_last];
 
                 /* Increment current dimension to the next dimension down */
                 curr_dim++;
 
-                /* Set the new span for the next dimension down */
-                iter->u.hyp.span[curr_dim] = curr_span->down->head;
-
                 /* Advance span down the tree */
-                curr_span = curr_span->down->head;
+                curr_span = &flat_span[curr_dim][ispan[curr_dim]];
 
                 /* Reset the absolute offset for the dim */
                 abs_arr[curr_dim] = curr_span->low;
             } /* end while */
-
-            /* Verify that the curr_span points to the fastest dim */
-            HDassert(curr_span == iter->u.hyp.span[fast_dim]);
         } /* end else */
 
         /* Reset the buffer offset */
@@ -9764,6 +10499,7 @@ H5S__hyper_subtract(H5S_t *space, H5S_t *subtract_space)
 
         /* Reset the scratch pad space */
         spans->scratch = 0;
+        spans->flat = NULL;
 
         /* Set to empty tree */
         spans->head = NULL;
@@ -86,6 +86,8 @@ struct H5S_pnt_node_t {
 /* Information about point selection list */
 typedef struct {
     H5S_pnt_node_t *head;   /* Pointer to head of point list */
+    H5S_pnt_node_t *tail;   /* Pointer to tail of point list */
+    hbool_t sorted;         /* Whether the points are in 'C' array order */
 } H5S_pnt_list_t;
 
 /* Information about new-style hyperslab spans */
@@ -109,6 +111,30 @@ struct H5S_hyper_span_info_t {
                                              * list during single element adds)
                                              */
     struct H5S_hyper_span_t *head;  /* Pointer to list of spans in next dimension down */
+    struct H5S_hyper_flat_t *flat;  /* Flattened copy of span tree, for iterating over it
+                                     * (built when needed, only for the top
+                                     * of a span tree)
+                                     */
+};
+
+/* Information about a span in a flattened span tree */
+typedef struct H5S_hyper_flat_span_t {
+    hsize_t low, high;          /* Low & high bounds of span */
+    size_t down_first;          /* Index of first span in next dimension down */
+    size_t down_last;           /* Index of last span in next dimension down */
+} H5S_hyper_flat_span_t;
+
+/* Flattened, read-only copy of a span tree.  The spans for each dimension
+ * are stored in one array, with the spans in each list next to each other
+ * and each span referring to its list of spans in the next dimension down
+ * by their indices.  A list of spans shared by neighboring spans in the
+ * span tree is only stored once.
+ */
+struct H5S_hyper_flat_t {
+    unsigned count;                     /* Ref. count of number of users of the flattened tree */
+    unsigned rank;                      /* Number of dimensions */
+    size_t nspans[H5S_MAX_RANK];        /* Number of spans in each dimension */
+    H5S_hyper_flat_span_t *span[H5S_MAX_RANK];  /* Spans in each dimension */
 };
 
 /* Information about new-style hyperslab selection */
@@ -45,6 +45,8 @@ static herr_t H5S_point_deserialize(H5S_t *space, uint32_t version, uint8_t flag
 static herr_t H5S_point_bounds(const H5S_t *space, hsize_t *start, hsize_t *end);
 static herr_t H5S_point_offset(const H5S_t *space, hsize_t *off);
 static int H5S__point_unlim_dim(const H5S_t *space);
+static hbool_t H5S__point_in_order(unsigned rank, const hsize_t *pnt1,
+    const hsize_t *pnt2);
 static htri_t H5S_point_is_contiguous(const H5S_t *space);
 static htri_t H5S_point_is_single(const H5S_t *space);
 static htri_t H5S_point_is_regular(const H5S_t *space);
@@ -391,6 +393,8 @@ static herr_t
 H5S_point_add(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *coord)
 {
     H5S_pnt_node_t *top = NULL, *curr = NULL, *new_node = NULL; /* Point selection nodes */
+    H5S_pnt_list_t *pnt_lst;            /* Point list of selection */
+    hbool_t sorted = TRUE;              /* Whether the new points are in order */
     unsigned u;                         /* Counter */
     herr_t ret_value = SUCCEED;         /* Return value */
 
@@ -417,34 +421,42 @@ H5S_point_add(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *co
         /* Link into list */
         if(top == NULL)
             top = new_node;
-        else
+        else {
+            if(sorted && !H5S__point_in_order(space->extent.rank, curr->pnt, new_node->pnt))
+                sorted = FALSE;
             curr->next = new_node;
+        } /* end else */
         curr = new_node;
     } /* end for */
     new_node = NULL;
 
     /* Insert the list of points selected in the proper place */
-    if(op == H5S_SELECT_SET || op == H5S_SELECT_PREPEND) {
-        /* Append current list, if there is one */
-        if(space->select.sel_info.pnt_lst->head != NULL)
-            curr->next = space->select.sel_info.pnt_lst->head;
+    pnt_lst = space->select.sel_info.pnt_lst;
+    if(pnt_lst->head == NULL) {
+        /* Put new list in point selection */
+        pnt_lst->head = top;
+        pnt_lst->tail = curr;
+        pnt_lst->sorted = sorted;
+    } /* end if */
+    else if(op == H5S_SELECT_SET || op == H5S_SELECT_PREPEND) {
+        /* Check if the points are still in order */
+        pnt_lst->sorted = pnt_lst->sorted && sorted
+                && H5S__point_in_order(space->extent.rank, curr->pnt, pnt_lst->head->pnt);
+
+        /* Append current list */
+        curr->next = pnt_lst->head;
 
         /* Put new list in point selection */
-        space->select.sel_info.pnt_lst->head = top;
+        pnt_lst->head = top;
     } /* end if */
     else {  /* op==H5S_SELECT_APPEND */
-        H5S_pnt_node_t *tmp_node;       /* Temporary point selection node */
-
-        tmp_node = space->select.sel_info.pnt_lst->head;
-        if(tmp_node != NULL) {
-            while(tmp_node->next != NULL)
-                tmp_node = tmp_node->next;
+        /* Check if the points are still in order */
+        pnt_lst->sorted = pnt_lst->sorted && sorted
+                && H5S__point_in_order(space->extent.rank, pnt_lst->tail->pnt, top->pnt);
 
-            /* Append new list to point selection */
-            tmp_node->next = top;
-        } /* end if */
-        else
-            space->select.sel_info.pnt_lst->head = top;
+        /* Append new list to point selection */
+        pnt_lst->tail->next = top;
+        pnt_lst->tail = curr;
     } /* end else */
 
     /* Set the number of elements in the new selection */
@@ -615,9 +627,12 @@ H5S_point_copy(H5S_t *dst, const H5S_t *src, hbool_t H5_ATTR_UNUSED share_select
     HDassert(dst);
 
     /* Allocate room for the head of the point list */
-    if(NULL == (dst->select.sel_info.pnt_lst = H5FL_MALLOC(H5S_pnt_list_t)))
+    if(NULL == (dst->select.sel_info.pnt_lst = H5FL_CALLOC(H5S_pnt_list_t)))
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point list node")
 
+    /* The points stay in the same order */
+    dst->select.sel_info.pnt_lst->sorted = src->select.sel_info.pnt_lst->sorted;
+
     curr = src->select.sel_info.pnt_lst->head;
     new_tail = NULL;
     while(curr) {
@@ -643,6 +658,7 @@ H5S_point_copy(H5S_t *dst, const H5S_t *src, hbool_t H5_ATTR_UNUSED share_select
 
         curr = curr->next;
     } /* end while */
+    dst->select.sel_info.pnt_lst->tail = new_tail;
 
 done:
     if(ret_value < 0 && dst->select.sel_info.pnt_lst) {
@@ -1228,6 +1244,84 @@ H5S__point_unlim_dim(const H5S_t H5_ATTR_UNUSED *space)
     FUNC_LEAVE_NOAPI(-1)
 } /* end H5S__point_unlim_dim() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__point_in_order
+ PURPOSE
+    Check if two points are in 'C' array order
+ USAGE
+    hbool_t H5S__point_in_order(rank, pnt1, pnt2)
+        unsigned rank;          IN: Rank of the points
+        const hsize_t *pnt1;    IN: Coordinates of first point
+        const hsize_t *pnt2;    IN: Coordinates of second point
+ RETURNS
+    TRUE if PNT1 comes before PNT2 in 'C' array order or is the same point,
+    FALSE otherwise.
+ DESCRIPTION
+    Compares the coordinates of two points, starting with the slowest
+    changing dimension.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static hbool_t
+H5S__point_in_order(unsigned rank, const hsize_t *pnt1, const hsize_t *pnt2)
+{
+    unsigned u;                 /* Local index variable */
+    hbool_t ret_value = TRUE;   /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < rank; u++)
+        if(pnt1[u] != pnt2[u]) {
+            ret_value = (hbool_t)(pnt1[u] < pnt2[u]);
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__point_in_order() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_point_is_sorted
+ PURPOSE
+    Check if the points in a point selection are in 'C' array order
+ USAGE
+    hbool_t H5S_point_is_sorted(space)
+        const H5S_t *space;     IN: Dataspace pointer to check
+ RETURNS
+    TRUE if the points are in order, FALSE otherwise (never fails).
+ DESCRIPTION
+    Points are iterated through in the order they were selected in, which
+    doesn't have to match their order in the dataspace.  This reports
+    whether they happen to be in order anyway (duplicate points may be
+    present), which is tracked as points are added to the selection.
+    The dataset I/O code sorts the points of a selection which is out of
+    order, to access the file in order.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+hbool_t
+H5S_point_is_sorted(const H5S_t *space)
+{
+    hbool_t ret_value = FALSE;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(space);
+    HDassert(H5S_SEL_POINTS == H5S_GET_SELECT_TYPE(space));
+
+    ret_value = space->select.sel_info.pnt_lst->sorted;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_point_is_sorted() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -1473,9 +1567,12 @@ H5S_point_project_simple(const H5S_t *base_space, H5S_t *new_space, hsize_t *off
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection")
 
     /* Allocate room for the head of the point list */
-    if(NULL == (new_space->select.sel_info.pnt_lst = H5FL_MALLOC(H5S_pnt_list_t)))
+    if(NULL == (new_space->select.sel_info.pnt_lst = H5FL_CALLOC(H5S_pnt_list_t)))
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point list node")
 
+    /* Projecting the points doesn't change their order */
+    new_space->select.sel_info.pnt_lst->sorted = base_space->select.sel_info.pnt_lst->sorted;
+
     /* Check if the new space's rank is < or > base space's rank */
     if(new_space->extent.rank < base_space->extent.rank) {
         hsize_t block[H5S_MAX_RANK];     /* Block selected in base dataspace */
@@ -1515,6 +1612,7 @@ H5S_point_project_simple(const H5S_t *base_space, H5S_t *new_space, hsize_t *off
             /* Advance to next node */
             base_node = base_node->next;
         } /* end while */
+        new_space->select.sel_info.pnt_lst->tail = prev_node;
     } /* end if */
     else {
         HDassert(new_space->extent.rank > base_space->extent.rank);
@@ -1553,6 +1651,7 @@ H5S_point_project_simple(const H5S_t *base_space, H5S_t *new_space, hsize_t *off
             /* Advance to next node */
             base_node = base_node->next;
         } /* end while */
+        new_space->select.sel_info.pnt_lst->tail = prev_node;
     } /* end else */
 
     /* Number of elements selected will be the same */
@@ -51,6 +51,7 @@ typedef struct H5S_extent_t H5S_extent_t;
 typedef struct H5S_pnt_node_t H5S_pnt_node_t;
 typedef struct H5S_hyper_span_t H5S_hyper_span_t;
 typedef struct H5S_hyper_span_info_t H5S_hyper_span_info_t;
+typedef struct H5S_hyper_flat_t H5S_hyper_flat_t;
 
 /* Information about one dimension in a hyperslab selection */
 typedef struct H5S_hyper_dim_t {
@@ -84,8 +85,8 @@ typedef struct {
     hbool_t flattened[H5S_MAX_RANK];    /* Whether this dimension has been flattened */
 
     /* Irregular hyperslab selection fields */
-    H5S_hyper_span_info_t *spans;  /* Pointer to copy of the span tree */
-    H5S_hyper_span_t *span[H5S_MAX_RANK];/* Array of pointers to span nodes */
+    H5S_hyper_flat_t *flat;        /* Pointer to flattened span tree */
+    size_t span[H5S_MAX_RANK];     /* Index of current span in each dimension */
 } H5S_hyper_iter_t;
 
 /* "All" selection iteration container */
@@ -276,6 +277,7 @@ H5_DLL herr_t H5S_select_none(H5S_t *space);
 /* Operations on point selections */
 H5_DLL herr_t H5S_select_elements(H5S_t *space, H5S_seloper_t op,
     size_t num_elem, const hsize_t *coord);
+H5_DLL hbool_t H5S_point_is_sorted(const H5S_t *space);
 
 /* Operations on hyperslab selections */
 H5_DLL herr_t H5S_select_hyperslab (H5S_t *space, H5S_seloper_t op, const hsize_t start[],
@@ -111,6 +111,12 @@ H5_DLL herr_t H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op,
 				   const hsize_t _stride[],
 				   const hsize_t count[],
 				   const hsize_t _block[]);
+H5_DLL herr_t H5Sselect_hyperslab_list(hid_t space_id, H5S_seloper_t op,
+				   size_t nslabs,
+				   const hsize_t start[],
+				   const hsize_t _stride[],
+				   const hsize_t count[],
+				   const hsize_t _block[]);
 /* #define NEW_HYPERSLAB_API */
 /* Note that these haven't been working for a while and were never
  *      publicly released - QAK */
@@ -122,6 +122,28 @@
 #   include <sys/file.h>
 #endif
 
+/*
+ * preadv() and pwritev() in sys/uio.h are used for vector I/O.
+ */
+#ifdef H5_HAVE_SYS_UIO_H
+#   include <sys/uio.h>
+#endif
+
+/*
+ * mmap() and madvise() in sys/mman.h are used by the mmap file driver.
+ */
+#ifdef H5_HAVE_SYS_MMAN_H
+#   include <sys/mman.h>
+#endif
+
+/*
+ * The io_uring file driver sets up its rings with raw system calls, so it
+ * needs neither liburing nor a newer C library.
+ */
+#ifdef H5_HAVE_SYS_SYSCALL_H
+#   include <sys/syscall.h>
+#endif
+
 /*
  * Resource usage is not Posix.1 but HDF5 uses it anyway for some performance
  * and debugging code if available.
@@ -1075,6 +1097,9 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDlseek
     #define HDlseek(F,O,W)  lseek(F,O,W)
 #endif /* HDlseek */
+#ifndef HDmadvise
+    #define HDmadvise(A,Z,F)    madvise(A,Z,F)
+#endif /* HDmadvise */
 #ifndef HDmalloc
     #define HDmalloc(Z)    malloc(Z)
 #endif /* HDmalloc */
@@ -1118,9 +1143,15 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDmktime
     #define HDmktime(T)    mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+    #define HDmmap(A,Z,P,F,D,O)    mmap(A,Z,P,F,D,O)
+#endif /* HDmmap */
 #ifndef HDmodf
     #define HDmodf(X,Y)    modf(X,Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+    #define HDmunmap(A,Z)    munmap(A,Z)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
     #define HDnanosleep(N, O)    nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1148,6 +1179,12 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDpowf
     #define HDpowf(X,Y)   powf(X,Y)
 #endif /* HDpowf */
+#ifndef HDpread
+    #define HDpread(F,B,S,O)    pread(F,B,S,O)
+#endif /* HDpread */
+#ifndef HDpreadv
+    #define HDpreadv(F,V,C,O)    preadv(F,V,C,O)
+#endif /* HDpreadv */
 #ifndef HDprintf
     #define HDprintf(...)   HDfprintf(stdout, __VA_ARGS__)
 #endif /* HDprintf */
@@ -1160,6 +1197,12 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDputs
     #define HDputs(S)    puts(S)
 #endif /* HDputs */
+#ifndef HDpwrite
+    #define HDpwrite(F,B,S,O)    pwrite(F,B,S,O)
+#endif /* HDpwrite */
+#ifndef HDpwritev
+    #define HDpwritev(F,V,C,O)    pwritev(F,V,C,O)
+#endif /* HDpwritev */
 #ifndef HDqsort
     #define HDqsort(M,N,Z,F)  qsort(M,N,Z,F)
 #endif /* HDqsort*/
@@ -1409,6 +1452,9 @@ typedef off_t               h5_stat_size_t;
         #define HDsymlink(F1,F2)  symlink(F1,F2)
     #endif /* HDsymlink */
 #endif /* H5_HAVE_SYMLINK */
+#ifndef HDsyscall
+    #define HDsyscall    syscall
+#endif /* HDsyscall */
 #ifndef HDsysconf
     #define HDsysconf(N)    sysconf(N)
 #endif /* HDsysconf */
@@ -42,7 +42,9 @@
 #include "H5FDcore.h"           /* Files stored entirely in memory              */
 #include "H5FDdirect.h"         /* Linux direct I/O                             */
 #include "H5FDfamily.h"         /* File families                                */
+#include "H5FDiouring.h"        /* Linux io_uring asynchronous I/O              */
 #include "H5FDlog.h"            /* sec2 driver with I/O logging (for debugging) */
+#include "H5FDmmap.h"           /* Memory-mapped file I/O                       */
 #include "H5FDmpi.h"            /* MPI-based file drivers                       */
 #include "H5FDmulti.h"          /* Usage-partitioned file family                */
 #include "H5FDsec2.h"           /* POSIX unbuffered file I/O                    */
@@ -54,6 +54,7 @@ unsigned test_read_after(H5F_t *f);
 unsigned test_free(H5F_t *f);
 unsigned test_big(H5F_t *f);
 unsigned test_random_write(H5F_t *f);
+unsigned test_accum_regions(void);
 unsigned test_swmr_write_big(hbool_t newest_format);
 
 /* Helper Function Prototypes */
@@ -135,6 +136,9 @@ main(void)
     if(H5Fclose(fid) < 0) TEST_ERROR
     HDremove(FILENAME);
 
+    /* This test uses its own file access property list */
+    nerrors += test_accum_regions();
+
     /* This test uses a different file */
     nerrors += test_swmr_write_big(TRUE);
     nerrors += test_swmr_write_big(FALSE);
@@ -1794,6 +1798,199 @@ error:
     return 1;
 } /* end test_random_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_accum_regions
+ * 
+ * Purpose:     Test a metadata accumulator with several regions: writes
+ *		that alternate between a few areas of the file must stay
+ *		in memory until the regions run out, and everything must
+ *		read back correctly.
+ * 
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned 
+test_accum_regions(void)
+{
+    hid_t fid = -1;             /* File ID */
+    hid_t fapl = -1;            /* File access property list */
+    hid_t fapl2 = -1;           /* File access property list, from the file */
+    H5F_t *f = NULL;            /* Internal file object pointer */
+    hbool_t api_ctx_pushed = FALSE;     /* Whether API context pushed */
+    uint8_t wbuf[2048], rbuf[2048];     /* Buffers for reading & writing */
+    uint8_t *big_buf = NULL;    /* Buffer for a write too big to accumulate */
+    haddr_t area[4];            /* Areas of the file written to */
+    unsigned nregions = 0;      /* # of accumulator regions */
+    unsigned u, v;              /* Local index variables */
+    herr_t ret;                 /* Generic return value */
+
+    TESTING("metadata accumulator with several regions");
+
+    /* Check the property */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_meta_accum_regions(fapl, &nregions) < 0) FAIL_STACK_ERROR
+    if(nregions != 1) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_meta_accum_regions(fapl, 0);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_meta_accum_regions(fapl, H5F_ACCUM_MAX_REGIONS + 1);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Pset_meta_accum_regions(fapl, 3) < 0) FAIL_STACK_ERROR
+
+    /* Create a test file */
+    if((fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* The file's access property list reports the regions */
+    if((fapl2 = H5Fget_access_plist(fid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_meta_accum_regions(fapl2, &nregions) < 0) FAIL_STACK_ERROR
+    if(nregions != 3) TEST_ERROR
+    if(H5Pclose(fapl2) < 0) FAIL_STACK_ERROR
+
+    /* Push API context */
+    if(H5CX_push() < 0) FAIL_STACK_ERROR
+    api_ctx_pushed = TRUE;
+
+    /* Get H5F_t * to internal file structure */
+    if(NULL == (f = (H5F_t *)H5I_object(fid))) FAIL_STACK_ERROR
+    if(f->shared->accum_nregions != 3) TEST_ERROR
+
+    /* Extend the file, as in the other tests */
+    if(H5FD_set_eoa(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)(1024*1024*10)) < 0) FAIL_STACK_ERROR
+    if(accum_reset(f) < 0) FAIL_STACK_ERROR
+
+    for(u = 0; u < 2048; u++)
+        wbuf[u] = (uint8_t)(u / 3);
+    for(v = 0; v < 4; v++)
+        area[v] = (haddr_t)(1024 * 1024 * (v + 1));
+
+    /* Alternate small writes between three areas */
+    for(u = 0; u < 4; u++)
+        for(v = 0; v < 3; v++)
+            if(accum_write(area[v] + u * 256, 256, wbuf + u * 256) < 0) FAIL_STACK_ERROR;
+
+    /* Each area is combined in its own dirty region */
+    if(NULL == f->shared->accum_regions) TEST_ERROR
+    if(!f->shared->accum.dirty || f->shared->accum.size != 1024) TEST_ERROR
+    for(u = 0; u < 2; u++)
+        if(!f->shared->accum_regions[u].dirty || f->shared->accum_regions[u].size != 1024) TEST_ERROR
+
+    /* Nothing has reached the file yet */
+    for(v = 0; v < 3; v++) {
+        if(H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, area[v], (size_t)1024, rbuf) < 0) FAIL_STACK_ERROR;
+        for(u = 0; u < 1024; u++)
+            if(rbuf[u] != 0) TEST_ERROR
+    } /* end for */
+
+    /* Reads are served from the regions */
+    for(v = 0; v < 3; v++) {
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(accum_read(area[v], 1024, rbuf) < 0) FAIL_STACK_ERROR;
+        if(HDmemcmp(wbuf, rbuf, (size_t)1024) != 0) TEST_ERROR;
+    } /* end for */
+
+    /* A fourth area needs a region, the others are written out */
+    if(accum_write(area[3], 1024, wbuf) < 0) FAIL_STACK_ERROR;
+    if(f->shared->accum.loc != area[3]) TEST_ERROR
+    for(u = 0, v = 0; u < 2; u++)
+        if(f->shared->accum_regions[u].dirty)
+            v++;
+    if(v != 1) TEST_ERROR
+
+    /* Freeing the end of a region trims it */
+    for(u = 0; u < 2; u++)
+        if(f->shared->accum_regions[u].dirty) {
+            if(accum_free(f, f->shared->accum_regions[u].loc + 768, 256) < 0) FAIL_STACK_ERROR;
+            if(f->shared->accum_regions[u].size != 768 || f->shared->accum_regions[u].dirty_len != 768) TEST_ERROR
+        } /* end if */
+
+    /* Rewrite part of an area that was written out */
+    if(accum_write(area[0] + 512, 256, wbuf + 768) < 0) FAIL_STACK_ERROR;
+    if(accum_read(area[0] + 512, 256, rbuf) < 0) FAIL_STACK_ERROR;
+    if(HDmemcmp(wbuf + 768, rbuf, (size_t)256) != 0) TEST_ERROR;
+
+    /* Start another region just past it, then write over both regions */
+    if(accum_write(area[0] + 2048, 256, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_write(area[0] + 640, 1536, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_read(area[0] + 512, 1792, rbuf) < 0) FAIL_STACK_ERROR;
+    if(HDmemcmp(wbuf + 768, rbuf, (size_t)128) != 0) TEST_ERROR;
+    if(HDmemcmp(wbuf, rbuf + 128, (size_t)1536) != 0) TEST_ERROR;
+    if(HDmemcmp(wbuf + 128, rbuf + 1664, (size_t)128) != 0) TEST_ERROR;
+
+    /* Flush all the regions and check the file */
+    if(accum_flush(f) < 0) FAIL_STACK_ERROR;
+    if(f->shared->accum.dirty) TEST_ERROR
+    for(u = 0; u < 2; u++)
+        if(f->shared->accum_regions[u].dirty) TEST_ERROR
+    if(H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, area[0], (size_t)2048, rbuf) < 0) FAIL_STACK_ERROR;
+    if(HDmemcmp(wbuf, rbuf, (size_t)512) != 0) TEST_ERROR;
+    if(HDmemcmp(wbuf + 768, rbuf + 512, (size_t)128) != 0) TEST_ERROR;
+    if(HDmemcmp(wbuf, rbuf + 640, (size_t)1408) != 0) TEST_ERROR;
+    for(v = 1; v < 4; v++) {
+        if(H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, area[v], (size_t)768, rbuf) < 0) FAIL_STACK_ERROR;
+        if(HDmemcmp(wbuf, rbuf, (size_t)768) != 0) TEST_ERROR;
+    } /* end for */
+
+    /* Dirty two areas, then write over the main accumulator with a
+     * write too big to be accumulated
+     */
+    if(accum_write(area[1], 1024, wbuf + 1024) < 0) FAIL_STACK_ERROR;
+    if(accum_write(area[2], 1024, wbuf + 1024) < 0) FAIL_STACK_ERROR;
+    if(f->shared->accum.loc != area[2]) TEST_ERROR
+    if(NULL == (big_buf = (uint8_t *)HDcalloc((size_t)1, (size_t)(1024 * 1024)))) TEST_ERROR
+    if(accum_write(area[2], 1024 * 1024, big_buf) < 0) FAIL_STACK_ERROR;
+    HDfree(big_buf);
+    big_buf = NULL;
+
+    /* Only the main accumulator is dropped, the other region is kept */
+    if(f->shared->accum.size != 0 || f->shared->accum.dirty) TEST_ERROR
+    for(u = 0, v = 0; u < 2; u++)
+        if(f->shared->accum_regions[u].dirty && f->shared->accum_regions[u].loc == area[1])
+            v++;
+    if(v != 1) TEST_ERROR
+    if(accum_flush(f) < 0) FAIL_STACK_ERROR;
+    if(H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, area[1], (size_t)1024, rbuf) < 0) FAIL_STACK_ERROR;
+    if(HDmemcmp(wbuf + 1024, rbuf, (size_t)1024) != 0) TEST_ERROR;
+    if(H5FD_read(f->shared->lf, H5FD_MEM_DEFAULT, area[2], (size_t)1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(u = 0; u < 1024; u++)
+        if(rbuf[u] != 0) TEST_ERROR
+
+    /* Resetting releases the regions */
+    if(accum_reset(f) < 0) FAIL_STACK_ERROR;
+    if(f->shared->accum_regions) TEST_ERROR
+
+    PASSED();
+
+    /* Random writes, with several regions */
+    if(test_random_write(f)) goto error;
+
+    /* Pop API context */
+    if(api_ctx_pushed && H5CX_pop() < 0) FAIL_STACK_ERROR
+    api_ctx_pushed = FALSE;
+
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(fapl) < 0) FAIL_STACK_ERROR
+    HDremove(FILENAME);
+
+    return 0;
+
+error:
+    if(big_buf)
+        HDfree(big_buf);
+    if(api_ctx_pushed) H5CX_pop();
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_accum_regions() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  * 
@@ -199,6 +199,10 @@ static void cedds__expunge_dirty_entry_in_flush_test(H5F_t * file_ptr);
 static void cedds__H5C_make_space_in_cache(H5F_t * file_ptr);
 static void cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t * file_ptr);
 static void cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr);
+static unsigned check_index_growth(unsigned paged);
+static unsigned check_flush_write_batching(unsigned paged);
+static unsigned check_auto_cache_resize_working_set(unsigned paged);
+static unsigned check_type_stats(unsigned paged);
 static unsigned check_stats(unsigned paged);
 #if H5C_COLLECT_CACHE_STATS
 static void check_stats__smoke_check_1(H5F_t * file_ptr);
@@ -26169,7 +26173,7 @@ check_auto_cache_resize_input_errs(unsigned paged)
 
 
         invalid_auto_size_ctl.incr_mode              =
-        			(enum H5C_cache_incr_mode) 2; /* INVALID */
+        			(enum H5C_cache_incr_mode) 3; /* INVALID */
 
         invalid_auto_size_ctl.lower_hr_threshold     = 0.75f;
 
@@ -35701,14 +35705,14 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
         HDassert(entry_addr == entry_ptr->addr);
 
-        expected_hash_bucket = H5C__HASH_FCN(entry_addr);
+        expected_hash_bucket = H5C__HASH_FCN(cache_ptr, entry_addr);
 
         for (i = 8; i <= 24; i += 8) {
         
             entry_ptr = &(base_addr[i]);
             entry_addr = entry_ptr->header.addr;
 
-            if(expected_hash_bucket != H5C__HASH_FCN(entry_addr)) {
+            if(expected_hash_bucket != H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
                 pass = FALSE;
                 failure_mssg = "Test entries don't map to same bucket -- hash table size or hash fcn change?";
@@ -35747,7 +35751,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
         entry_ptr = &(base_addr[31]);
         entry_addr = entry_ptr->header.addr;
 
-        if(expected_hash_bucket == H5C__HASH_FCN(entry_addr)) {
+        if(expected_hash_bucket == H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
             pass = FALSE;
             failure_mssg = "Dirty entry maps to same hash bucket as clean entries?!?!";
@@ -35908,6 +35912,550 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
 } /* cedds__H5C_flush_invalidate_cache__bucket_scan() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	check_index_growth()
+ *
+ * Purpose:	Verify that the index hash table grows once the number of
+ *		entries in the cache exceeds H5C__HASH_TABLE_MAX_LOAD times
+ *		the number of buckets, and that all entries can still be
+ *		found (and are correctly chained) after they have been
+ *		rehashed into the larger table.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+check_index_growth(unsigned paged)
+{
+    const int   test_types[] = {PICO_ENTRY_TYPE, NANO_ENTRY_TYPE, MICRO_ENTRY_TYPE,
+                                TINY_ENTRY_TYPE, SMALL_ENTRY_TYPE, MEDIUM_ENTRY_TYPE,
+                                NOTIFY_ENTRY_TYPE};
+    const int   num_types = (int)(sizeof(test_types) / sizeof(test_types[0]));
+    H5F_t *     file_ptr = NULL;
+    H5C_t *     cache_ptr = NULL;
+    int         i, j;
+
+    if(paged)
+        TESTING("metadata cache index growth (paged aggregation)")
+    else
+        TESTING("metadata cache index growth")
+
+    pass = TRUE;
+
+    reset_entries();
+
+    file_ptr = setup_cache((size_t)(32 * 1024 * 1024), (size_t)(16 * 1024 * 1024), paged);
+
+    if(pass) {
+
+        cache_ptr = file_ptr->shared->cache;
+
+        if(cache_ptr->index_table_len != H5C__HASH_TABLE_LEN) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected initial index table length.";
+        }
+    }
+
+    /* Insert enough entries to exceed the load limit of the initial table */
+    for(i = 0; pass && i < num_types; i++)
+        for(j = 0; pass && j <= max_indices[test_types[i]]; j++)
+            insert_entry(file_ptr, test_types[i], j, H5C__NO_FLAGS_SET);
+
+    if(pass) {
+
+        if(cache_ptr->index_len <= H5C__HASH_TABLE_LEN * H5C__HASH_TABLE_MAX_LOAD) {
+
+            pass = FALSE;
+            failure_mssg = "too few entries inserted to grow the index.";
+
+        } else if((cache_ptr->index_table_len <= H5C__HASH_TABLE_LEN) ||
+                  ((size_t)cache_ptr->index_len >
+                   cache_ptr->index_table_len * H5C__HASH_TABLE_MAX_LOAD)) {
+
+            pass = FALSE;
+            failure_mssg = "index table didn't grow as expected.";
+        }
+    }
+
+    /* Every entry must still be found via the (rehashed) index */
+    for(i = 0; pass && i < num_types; i++)
+        for(j = 0; pass && j <= max_indices[test_types[i]]; j++) {
+
+            protect_entry(file_ptr, test_types[i], j);
+            unprotect_entry(file_ptr, test_types[i], j, H5C__NO_FLAGS_SET);
+        }
+
+    /* Every entry must be chained in the bucket its address hashes to */
+    if(pass) {
+        H5C_cache_entry_t * entry_ptr;
+        uint32_t            count = 0;
+        size_t              k;
+
+        for(k = 0; pass && k < cache_ptr->index_table_len; k++) {
+
+            entry_ptr = cache_ptr->index[k];
+
+            while(pass && entry_ptr != NULL) {
+
+                if((size_t)H5C__HASH_FCN(cache_ptr, entry_ptr->addr) != k) {
+
+                    pass = FALSE;
+                    failure_mssg = "entry in wrong bucket after index growth.";
+                }
+                count++;
+                entry_ptr = entry_ptr->ht_next;
+            }
+        }
+
+        if(pass && count != cache_ptr->index_len) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected number of entries in index buckets.";
+        }
+    }
+
+    if(pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass) {
+
+        HDfprintf(stdout, "%s(): failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_index_growth() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	check_flush_write_batching()
+ *
+ * Purpose:	Verify that a flush of a run of dirty entries that are
+ *		adjacent in the file writes the run with a small number
+ *		of batched writes, rather than one write per entry, and
+ *		that the entries can be loaded back correctly afterwards.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+check_flush_write_batching(unsigned paged)
+{
+    H5F_t *     file_ptr = NULL;
+    H5C_t *     cache_ptr = NULL;
+    int64_t     init_writes = 0;
+    int64_t     init_entries = 0;
+    int64_t     max_writes;
+    int         i;
+
+    if(paged)
+        TESTING("metadata cache batched flush writes (paged aggregation)")
+    else
+        TESTING("metadata cache batched flush writes")
+
+    pass = TRUE;
+
+    reset_entries();
+
+    file_ptr = setup_cache((size_t)(32 * 1024 * 1024), (size_t)(16 * 1024 * 1024), paged);
+
+    if(pass) {
+
+        cache_ptr = file_ptr->shared->cache;
+        init_writes = cache_ptr->write_batch_writes;
+        init_entries = cache_ptr->write_batch_entries;
+    }
+
+    /* Insert a run of dirty entries that are adjacent in the file */
+    for(i = 0; pass && i < NUM_MEDIUM_ENTRIES; i++)
+        insert_entry(file_ptr, MEDIUM_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+
+    flush_cache(file_ptr, FALSE, FALSE, FALSE);
+
+    if(pass) {
+
+        /* The run is split into batches of at most
+         * H5C__MAX_WRITE_BATCH_SIZE bytes.
+         */
+        max_writes = (int64_t)((NUM_MEDIUM_ENTRIES * MEDIUM_ENTRY_SIZE) /
+                               H5C__MAX_WRITE_BATCH_SIZE) + 1;
+
+        if(cache_ptr->write_batch_len != 0) {
+
+            pass = FALSE;
+            failure_mssg = "images left in write batch after flush.";
+
+        } else if((cache_ptr->write_batch_entries - init_entries) <
+                  NUM_MEDIUM_ENTRIES) {
+
+            pass = FALSE;
+            failure_mssg = "entries not written via the write batch.";
+
+        } else if((cache_ptr->write_batch_writes - init_writes) > max_writes) {
+
+            pass = FALSE;
+            failure_mssg = "too many writes for a run of adjacent entries.";
+        }
+    }
+
+    /* Evict everything, and load the entries back from the file.
+     * The deserialize callback verifies the contents of each image.
+     */
+    flush_cache(file_ptr, TRUE, FALSE, FALSE);
+
+    for(i = 0; pass && i < NUM_MEDIUM_ENTRIES; i++) {
+
+        protect_entry(file_ptr, MEDIUM_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, MEDIUM_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+    }
+
+    if(pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass) {
+
+        HDfprintf(stdout, "%s(): failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_flush_write_batching() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	check_auto_cache_resize_working_set()
+ *
+ * Purpose:	Verify that the working set increment mode grows the
+ *		cache by the size of the recently evicted entries that
+ *		are referenced again, and that it does not grow the
+ *		cache in response to misses on entries that have never
+ *		been in the cache.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+check_auto_cache_resize_working_set(unsigned paged)
+{
+    H5F_t * file_ptr = NULL;
+    H5C_t * cache_ptr = NULL;
+    herr_t result;
+    int32_t i;
+    H5C_auto_size_ctl_t auto_size_ctl =
+    {
+        /* int32_t     version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+        /* H5C_auto_resize_report_fcn rpt_fcn = */ test_rpt_fcn,
+
+        /* hbool_t     set_initial_size       = */ TRUE,
+        /* size_t      initial_size           = */ (512 * 1024),
+
+        /* double      min_clean_fraction     = */ 0.5f,
+
+        /* size_t      max_size               = */ (14 * 1024 * 1024),
+        /* size_t      min_size               = */ (512 * 1024),
+
+        /* int64_t     epoch_length           = */ 1000,
+
+
+        /* enum H5C_cache_incr_mode incr_mode = */ H5C_incr__working_set,
+
+        /* double     lower_hr_threshold      = */ 0.75f,
+
+        /* double      increment              = */ 4.0f,
+
+        /* hbool_t     apply_max_increment    = */ TRUE,
+        /* size_t      max_increment          = */ (4 * 1024 * 1024),
+
+        /* enum H5C_cache_flash_incr_mode       */
+	/*                    flash_incr_mode = */ H5C_flash_incr__off,
+	/* double      flash_multiple         = */ 2.0f,
+	/* double      flash_threshold        = */ 0.5f,
+
+
+        /* enum H5C_cache_decr_mode decr_mode = */ H5C_decr__off,
+
+        /* double      upper_hr_threshold     = */ 0.995f,
+
+        /* double      decrement              = */ 0.1f,
+
+        /* hbool_t     apply_max_decrement    = */ TRUE,
+        /* size_t      max_decrement          = */ (1 * 1024 * 1024),
+
+        /* int32_t     epochs_before_eviction = */ 3,
+
+        /* hbool_t     apply_empty_reserve    = */ TRUE,
+        /* double      empty_reserve          = */ 0.05f
+    };
+
+    if(paged)
+        TESTING("automatic cache resizing -- working set mode (paged aggregation)")
+    else
+        TESTING("automatic cache resizing -- working set mode")
+
+    pass = TRUE;
+
+    reset_entries();
+
+    file_ptr = setup_cache((size_t)(2 * 1024), (size_t)(1 * 1024), paged);
+
+    if(pass) {
+
+        cache_ptr = file_ptr->shared->cache;
+
+        result = H5C_set_cache_auto_resize_config(cache_ptr, &auto_size_ctl);
+
+        if(result != SUCCEED) {
+
+            pass = FALSE;
+            failure_mssg = "H5C_set_cache_auto_resize_config failed.";
+
+        } else if((cache_ptr->ghost_table == NULL) ||
+                  (cache_ptr->max_cache_size != (512 * 1024))) {
+
+            pass = FALSE;
+            failure_mssg = "bad cache state after initialization.";
+        }
+    }
+
+    /* stream through entries that are never referenced again -- the
+     * hit rate is zero and the cache is full, but none of the misses
+     * would be hits in a larger cache, so the cache must not grow.
+     */
+    if(pass) {
+
+        rpt_fcn_called = FALSE;
+        for(i = 0; pass && i < 1000; i++) {
+
+            protect_entry(file_ptr, MONSTER_ENTRY_TYPE, i);
+            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+        }
+
+        if(pass && ((!rpt_fcn_called) ||
+                    (rpt_status != not_full) ||
+                    (cache_ptr->max_cache_size != (512 * 1024)))) {
+
+            pass = FALSE;
+            failure_mssg = "cache grew on a streaming access pattern.";
+        }
+    }
+
+    /* cycle through a working set of 12 monster entries (768 KB), which
+     * does not fit in the 512 KB cache.  The cache must grow enough to
+     * hold the working set, but by less than the 4x increment that the
+     * threshold mode would have applied.
+     */
+    if(pass) {
+
+        rpt_fcn_called = FALSE;
+        for(i = 0; pass && i < 1000; i++) {
+
+            protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 2000 + (i % 12));
+            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 2000 + (i % 12), H5C__NO_FLAGS_SET);
+        }
+
+        if(pass && ((!rpt_fcn_called) ||
+                    (rpt_status != increase) ||
+                    (cache_ptr->max_cache_size < (12 * MONSTER_ENTRY_SIZE)) ||
+                    (cache_ptr->max_cache_size >= (4 * 512 * 1024)))) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected cache size after working set increase.";
+        }
+    }
+
+    /* the working set now fits, so the cache should stay put */
+    if(pass) {
+        size_t max_cache_size = cache_ptr->max_cache_size;
+
+        rpt_fcn_called = FALSE;
+        for(i = 0; pass && i < 1000; i++) {
+
+            protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 2000 + (i % 12));
+            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 2000 + (i % 12), H5C__NO_FLAGS_SET);
+        }
+
+        if(pass && ((!rpt_fcn_called) ||
+                    (rpt_status != in_spec) ||
+                    (cache_ptr->max_cache_size != max_cache_size))) {
+
+            pass = FALSE;
+            failure_mssg = "cache size changed once working set fit.";
+        }
+    }
+
+    /* turning the mode off must discard the ghost table */
+    if(pass) {
+
+        auto_size_ctl.incr_mode = H5C_incr__threshold;
+
+        result = H5C_set_cache_auto_resize_config(cache_ptr, &auto_size_ctl);
+
+        if((result != SUCCEED) || (cache_ptr->ghost_table != NULL)) {
+
+            pass = FALSE;
+            failure_mssg = "ghost table not discarded.";
+        }
+    }
+
+    if(pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass) {
+
+        HDfprintf(stdout, "%s(): failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_auto_cache_resize_working_set() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	check_type_stats()
+ *
+ * Purpose:	Verify that the per entry type statistics track hits,
+ *		misses, flushes, evictions and bytes read and written for
+ *		each entry type, and that the current residency reported
+ *		by H5C_get_cache_type_stats() matches the cache.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+check_type_stats(unsigned paged)
+{
+    H5F_t * file_ptr = NULL;
+    H5C_t * cache_ptr = NULL;
+    H5C_type_stats_t stats[NUMBER_OF_ENTRY_TYPES];
+    size_t ntypes = 0;
+    int i;
+
+    if(paged)
+        TESTING("metadata cache per type statistics (paged aggregation)")
+    else
+        TESTING("metadata cache per type statistics")
+
+    pass = TRUE;
+
+    reset_entries();
+
+    file_ptr = setup_cache((size_t)(2 * 1024 * 1024), (size_t)(1 * 1024 * 1024), paged);
+
+    /* insert 10 dirty medium entries, write them out, and evict them */
+    for(i = 0; pass && i < 10; i++)
+        insert_entry(file_ptr, MEDIUM_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+
+    flush_cache(file_ptr, TRUE, FALSE, FALSE);
+
+    /* load them back (10 misses), and protect them again (10 hits) */
+    for(i = 0; pass && i < 20; i++) {
+
+        protect_entry(file_ptr, MEDIUM_ENTRY_TYPE, i % 10);
+        unprotect_entry(file_ptr, MEDIUM_ENTRY_TYPE, i % 10, H5C__NO_FLAGS_SET);
+    }
+
+    /* and add some small entries, which must be accounted separately */
+    for(i = 0; pass && i < 5; i++)
+        insert_entry(file_ptr, SMALL_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+
+    if(pass) {
+
+        cache_ptr = file_ptr->shared->cache;
+
+        if((H5C_get_cache_type_stats(cache_ptr, (size_t)NUMBER_OF_ENTRY_TYPES,
+                                     stats, &ntypes) < 0) ||
+             (ntypes != NUMBER_OF_ENTRY_TYPES)) {
+
+            pass = FALSE;
+            failure_mssg = "H5C_get_cache_type_stats failed.";
+        }
+    }
+
+    if(pass) {
+
+        if((stats[MEDIUM_ENTRY_TYPE].hits != 10) ||
+             (stats[MEDIUM_ENTRY_TYPE].misses != 10) ||
+             (stats[MEDIUM_ENTRY_TYPE].flushes != 10) ||
+             (stats[MEDIUM_ENTRY_TYPE].evictions != 10) ||
+             (stats[MEDIUM_ENTRY_TYPE].bytes_written !=
+                (int64_t)(10 * MEDIUM_ENTRY_SIZE)) ||
+             (stats[MEDIUM_ENTRY_TYPE].bytes_read !=
+                (int64_t)(10 * MEDIUM_ENTRY_SIZE)) ||
+             (stats[MEDIUM_ENTRY_TYPE].deserialize_time < 0.0f) ||
+             (stats[MEDIUM_ENTRY_TYPE].cur_entries != 10) ||
+             (stats[MEDIUM_ENTRY_TYPE].cur_size != 10 * MEDIUM_ENTRY_SIZE)) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected medium entry statistics.";
+
+        } else if((stats[SMALL_ENTRY_TYPE].hits != 0) ||
+                  (stats[SMALL_ENTRY_TYPE].misses != 0) ||
+                  (stats[SMALL_ENTRY_TYPE].cur_entries != 5) ||
+                  (stats[SMALL_ENTRY_TYPE].cur_size != 5 * SMALL_ENTRY_SIZE)) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected small entry statistics.";
+
+        } else if((stats[PICO_ENTRY_TYPE].hits != 0) ||
+                  (stats[PICO_ENTRY_TYPE].cur_entries != 0) ||
+                  (stats[PICO_ENTRY_TYPE].name == NULL)) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected pico entry statistics.";
+        }
+    }
+
+    /* a short array must only receive the leading entry types */
+    if(pass) {
+
+        ntypes = 0;
+
+        if((H5C_get_cache_type_stats(cache_ptr, (size_t)1, stats, &ntypes) < 0) ||
+             (ntypes != NUMBER_OF_ENTRY_TYPES)) {
+
+            pass = FALSE;
+            failure_mssg = "H5C_get_cache_type_stats failed with short array.";
+        }
+    }
+
+    if(pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass) {
+
+        HDfprintf(stdout, "%s(): failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	check_stats()
@@ -36517,6 +37065,10 @@ main(void)
         nerrs += check_metadata_cork(TRUE, paged);
         nerrs += check_metadata_cork(FALSE, paged);
         nerrs += check_entry_deletions_during_scans(paged);
+        nerrs += check_index_growth(paged);
+        nerrs += check_flush_write_batching(paged);
+        nerrs += check_auto_cache_resize_working_set(paged);
+        nerrs += check_type_stats(paged);
         nerrs += check_stats(paged);
     } /* end for */
 
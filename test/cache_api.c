@@ -30,6 +30,7 @@
 
 static hbool_t check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id);
 static hbool_t check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id);
+static hbool_t check_file_mdc_type_stats(unsigned paged, hid_t fcpl_id);
 static hbool_t mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id);
 static H5AC_cache_config_t * init_invalid_configs(void);
 static hbool_t check_fapl_mdc_api_errs(void);
@@ -854,6 +855,204 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
 
 } /* check_file_mdc_api_calls() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    check_file_mdc_type_stats()
+ *
+ * Purpose:     Verify that H5Fget_mdc_type_stats() reports per entry
+ *              type statistics consistent with the other cache status
+ *              calls, and that the working set increment mode can be
+ *              selected via H5Fset_mdc_config().
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+#define NUM_STATS_GROUPS        16
+
+static hbool_t
+check_file_mdc_type_stats(unsigned paged, hid_t fcpl_id)
+{
+    char filename[512];
+    char group_name[32];
+    hid_t file_id = -1;
+    hid_t group_id = -1;
+    int cur_num_entries;
+    ssize_t ntypes = 0;
+    ssize_t ret;
+    ssize_t u;
+    size_t total_entries = 0;
+    int64_t total_misses = 0;
+    int64_t total_bytes_read = 0;
+    int i;
+    H5AC_cache_type_stats_t * stats = NULL;
+    H5AC_cache_config_t config;
+
+    if(paged)
+        TESTING("MDC per type statistics API (paged aggregation)")
+    else
+        TESTING("MDC per type statistics API")
+
+    pass = TRUE;
+
+    /* setup the file name */
+    if(pass)
+        if(h5_fixname(FILENAME[1], H5P_DEFAULT, filename, sizeof(filename)) == NULL) {
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        } /* end if */
+
+    /* create a file with a number of groups in it */
+    if(pass)
+        if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl_id, H5P_DEFAULT)) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fcreate() failed.\n";
+        } /* end if */
+
+    for(i = 0; pass && i < NUM_STATS_GROUPS; i++) {
+        HDsnprintf(group_name, sizeof(group_name), "group%d", i);
+        if((group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0 ||
+                H5Gclose(group_id) < 0) {
+            pass = FALSE;
+            failure_mssg = "can't create group.\n";
+        } /* end if */
+    } /* end for */
+
+    if(pass)
+        if(H5Fclose(file_id) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        } /* end if */
+
+    /* re-open the file, and open the groups, so that metadata is loaded */
+    if(pass)
+        if((file_id = H5Fopen(filename, H5F_ACC_RDWR, H5P_DEFAULT)) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fopen() failed.\n";
+        } /* end if */
+
+    for(i = 0; pass && i < NUM_STATS_GROUPS; i++) {
+        HDsnprintf(group_name, sizeof(group_name), "group%d", i);
+        if((group_id = H5Gopen2(file_id, group_name, H5P_DEFAULT)) < 0 ||
+                H5Gclose(group_id) < 0) {
+            pass = FALSE;
+            failure_mssg = "can't open group.\n";
+        } /* end if */
+    } /* end for */
+
+    /* get the number of entry types */
+    if(pass)
+        if((ntypes = H5Fget_mdc_type_stats(file_id, (size_t)0, NULL)) <= 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_type_stats() failed 1.\n";
+        } /* end if */
+
+    if(pass)
+        if(NULL == (stats = (H5AC_cache_type_stats_t *)HDcalloc((size_t)ntypes, sizeof(H5AC_cache_type_stats_t)))) {
+            pass = FALSE;
+            failure_mssg = "can't allocate stats array.\n";
+        } /* end if */
+
+    if(pass)
+        if((ret = H5Fget_mdc_type_stats(file_id, (size_t)ntypes, stats)) != ntypes) {
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_type_stats() failed 2.\n";
+        } /* end if */
+
+    if(pass)
+        if(H5Fget_mdc_size(file_id, NULL, NULL, NULL, &cur_num_entries) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_size() failed.\n";
+        } /* end if */
+
+    if(pass) {
+        for(u = 0; u < ntypes; u++) {
+            if(stats[u].name == NULL || stats[u].hits < 0 ||
+                    stats[u].misses < 0 || stats[u].deserialize_time < 0.0f) {
+                pass = FALSE;
+                failure_mssg = "bad per type stats.\n";
+            } /* end if */
+            total_entries += stats[u].cur_entries;
+            total_misses += stats[u].misses;
+            total_bytes_read += stats[u].bytes_read;
+        } /* end for */
+
+        if(pass && (total_entries != (size_t)cur_num_entries)) {
+            pass = FALSE;
+            failure_mssg = "per type entry counts don't match cache size.\n";
+        } /* end if */
+        else if(pass && (total_misses < NUM_STATS_GROUPS || total_bytes_read <= 0)) {
+            pass = FALSE;
+            failure_mssg = "too few misses reported on re-open.\n";
+        } /* end if */
+    } /* end if */
+
+    /* the statistics can't be retrieved for an invalid file ID */
+    if(pass) {
+        H5E_BEGIN_TRY {
+            ret = H5Fget_mdc_type_stats((hid_t)-1, (size_t)ntypes, stats);
+        } H5E_END_TRY;
+
+        if(ret >= 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_type_stats() succeeded on bad file ID.\n";
+        } /* end if */
+    } /* end if */
+
+    /* select the working set increment mode */
+    if(pass) {
+        config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+        if(H5Fget_mdc_config(file_id, &config) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_config() failed 1.\n";
+        } /* end if */
+    } /* end if */
+
+    if(pass) {
+        config.incr_mode = H5C_incr__working_set;
+        if(H5Fset_mdc_config(file_id, &config) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fset_mdc_config() failed.\n";
+        } /* end if */
+    } /* end if */
+
+    if(pass) {
+        HDmemset(&config, 0, sizeof(config));
+        config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+        if(H5Fget_mdc_config(file_id, &config) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_config() failed 2.\n";
+        } /* end if */
+        else if(config.incr_mode != H5C_incr__working_set) {
+            pass = FALSE;
+            failure_mssg = "working set incr_mode not set.\n";
+        } /* end if */
+    } /* end if */
+
+    /* close the file and delete it */
+    if(pass) {
+        if(H5Fclose(file_id) < 0) {
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        } /* end if */
+        else if(HDremove(filename) < 0) {
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        } /* end if */
+    } /* end if */
+
+    if(stats)
+        HDfree(stats);
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass)
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+
+    return pass;
+
+} /* check_file_mdc_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	mdc_api_call_smoke_check()
@@ -2333,6 +2532,9 @@ main(void)
         if(!check_file_mdc_api_calls(paged, my_fcpl))
             nerrs += 1;
 
+        if(!check_file_mdc_type_stats(paged, my_fcpl))
+            nerrs += 1;
+
         if(!mdc_api_call_smoke_check(express_test, paged, my_fcpl))
             nerrs += 1;
 
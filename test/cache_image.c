@@ -53,6 +53,7 @@ static unsigned cache_image_smoke_check_3(void);
 static unsigned cache_image_smoke_check_4(void);
 static unsigned cache_image_smoke_check_5(void);
 static unsigned cache_image_smoke_check_6(void);
+static unsigned cache_image_smoke_check_7(void);
 
 static unsigned cache_image_api_error_check_1(void);
 static unsigned cache_image_api_error_check_2(void);
@@ -5518,6 +5519,230 @@ cache_image_smoke_check_6(void)
 
 } /* cache_image_smoke_check_6() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    cache_image_smoke_check_7()
+ *
+ * Purpose:     This test verifies that when a file with a metadata cache
+ *		image is opened read only, clean entries in the image are
+ *		not reconstructed until they are first protected, and that
+ *		the data read via such entries is correct.
+ *
+ *		1) Create a HDF5 file with the cache image FAPL entry.
+ *
+ *		2) Create some datasets in the file, and flush the file
+ *		   so that the entries in the cache image are clean.
+ *
+ *		3) Close the file.
+ *
+ *		4) Open the file read only.
+ *
+ *		5) Open the datasets, and verify that they contain the
+ *		   expected data.
+ *
+ *		   Verify that the cache image was loaded, that the
+ *		   reconstruction of some of its entries was deferred,
+ *		   and that some of the deferred entries have since been
+ *		   reconstructed.
+ *
+ *		6) Close the file.
+ *
+ *		7) Open the file read only again, and verify that the
+ *		   cache image is still present, and the datasets still
+ *		   contain the expected data.
+ *
+ *		8) Close the file.
+ *
+ *		9) Delete the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+cache_image_smoke_check_7(void)
+{
+    const char * fcn_name = "cache_image_smoke_check_7()";
+    char filename[512];
+    hbool_t show_progress = FALSE;
+    hid_t file_id = -1;
+    H5F_t *file_ptr = NULL;
+    H5C_t *cache_ptr = NULL;
+    int cp = 0;
+    int i;
+
+    TESTING("metadata cache image smoke check 7");
+
+    pass = TRUE;
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* setup the file name */
+    if ( pass ) {
+
+        if ( h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename))
+            == NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 1) Create a HDF5 file with the cache image FAPL entry. */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ TRUE,
+                       /* mdci_sbem_expected */ FALSE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ TRUE,
+		       /* config_fsm         */ FALSE,
+		       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 2) Create some datasets in the file, and flush it. */
+
+    if ( pass ) {
+
+        create_datasets(file_id, 0, 5);
+    }
+
+    if ( pass ) {
+
+        if ( H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fflush() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 3) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 4) - 8) Open the file read only (twice), verify deferral of
+     *    entries and the contents of the datasets, and close it.
+     */
+
+    for ( i = 0; i < 2; i++ ) {
+
+        if ( pass ) {
+
+            open_hdf5_file(/* create_file        */ FALSE,
+                           /* mdci_sbem_expected */ TRUE,
+                           /* read_only          */ TRUE,
+                           /* set_mdci_fapl      */ FALSE,
+                           /* config_fsm         */ FALSE,
+                           /* set_eoc            */ FALSE,
+                           /* hdf_file_name      */ filename,
+                           /* cache_image_flags  */ 0,
+                           /* file_id_ptr        */ &file_id,
+                           /* file_ptr_ptr       */ &file_ptr,
+                           /* cache_ptr_ptr      */ &cache_ptr);
+        }
+
+        if ( pass ) {
+
+            verify_datasets(file_id, 0, 5);
+        }
+
+        if ( pass ) {
+
+            if ( ! cache_ptr->image_loaded ) {
+
+                pass = FALSE;
+                failure_mssg = "metadata cache image block not loaded.";
+
+            } else if ( cache_ptr->num_deferred_image_entries == 0 ) {
+
+                pass = FALSE;
+                failure_mssg = "no cache image entries deferred on R/O open.";
+
+            } else if ( cache_ptr->num_deferred_image_entries >
+                        cache_ptr->num_entries_in_image ) {
+
+                pass = FALSE;
+                failure_mssg = "too many cache image entries deferred.";
+
+            } else if ( cache_ptr->deferred_image_entries_used == 0 ) {
+
+                pass = FALSE;
+                failure_mssg = "no deferred cache image entries loaded.";
+
+            } else if ( cache_ptr->deferred_image_entries_used >
+                        cache_ptr->num_deferred_image_entries ) {
+
+                pass = FALSE;
+                failure_mssg = "too many deferred cache image entries loaded.";
+            }
+        }
+
+        if ( pass ) {
+
+            if ( H5Fclose(file_id) < 0  ) {
+
+                pass = FALSE;
+                failure_mssg = "H5Fclose() failed.\n";
+            }
+        }
+
+        if ( show_progress ) 
+            HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+    }
+
+
+    /* 9) Delete the file */
+
+    if ( pass ) {
+
+        if ( HDremove(filename) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if ( pass ) { PASSED(); } else { H5_FAILED(); }
+
+    if ( ! pass )
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+
+    return !pass;
+
+} /* cache_image_smoke_check_7() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    cache_image_api_error_check_1()
@@ -8066,6 +8291,7 @@ main(void)
     nerrs += cache_image_smoke_check_4();
     nerrs += cache_image_smoke_check_5();
     nerrs += cache_image_smoke_check_6();
+    nerrs += cache_image_smoke_check_7();
 
     nerrs += cache_image_api_error_check_1();
     nerrs += cache_image_api_error_check_2();
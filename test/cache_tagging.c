@@ -163,7 +163,7 @@ verify_no_unknown_tags(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_table_len; i++) {
         H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -211,7 +211,7 @@ mark_all_entries_investigated(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_table_len; i++) {
         H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -257,7 +257,7 @@ reset_all_entries_investigated(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_table_len; i++) {
         H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -305,7 +305,7 @@ verify_tag(hid_t fid, int id, haddr_t tag)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_table_len; i++) {
         H5C_cache_entry_t *entry_ptr; /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -84,6 +84,10 @@ const char *FILENAME[] = {
     "dls_01_strings",   /* 23 */
     "power2up",         /* 24 */
     "version_bounds",   /* 25 */
+    "sieve_gap",        /* 26 */
+    "io_plan",          /* 27 */
+    "multi_dset",       /* 28 */
+    "chunk_reserve",    /* 29 */
     NULL
 };
 
@@ -167,6 +171,25 @@ const char *FILENAME[] = {
 #define DSET_SINGLE_MAX         "DSET_SINGLE_MAX"
 #define DSET_SINGLE_NOMAX       "DSET_SINGLE_NOMAX"
 
+/* Parameters for testing the sieve buffer with point selections */
+#define DSET_SIEVE_GAP_NAME     "sieve_gap"
+#define SIEVE_GAP_DIM           4096
+#define SIEVE_GAP_NPOINTS       200
+
+#define DSET_IO_PLAN_NAME       "io_plan"
+#define DSET_IO_PLAN_EXT_NAME   "io_plan_ext"
+#define IO_PLAN_DIM1            20
+#define IO_PLAN_DIM2            30
+#define IO_PLAN_BLOCK1          4
+#define IO_PLAN_BLOCK2          5
+
+#define MULTI_NDSETS            4
+#define MULTI_DIM               100
+
+#define RESERVE_CHUNK           100
+#define RESERVE_NCHUNKS         16
+#define RESERVE_ALIGN           256
+
 #define USER_BLOCK              1024
 #define SIXTY_FOUR_KB           65536
 
@@ -11472,6 +11495,869 @@ error:
 } /* end test_power2up() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_sieve_gap
+ *
+ * Purpose:     Tests raw data I/O through the sieve buffer for point
+ *              selections whose points are out of order and spread over
+ *              several sieve buffer loads, with several settings for the
+ *              largest hole the sieve buffer reads through.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_sieve_gap(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       my_fapl = -1;   /* File access property list ID */
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* File dataspace ID */
+    hid_t       mid = -1;       /* Memory dataspace ID */
+    hid_t       did = -1;       /* Dataset ID */
+    hsize_t     dims[1] = {SIEVE_GAP_DIM};      /* Dataset dimensions */
+    hsize_t     mdims[1] = {SIEVE_GAP_NPOINTS}; /* Memory dimensions */
+    hsize_t     coords[SIEVE_GAP_NPOINTS];      /* Selected points */
+    size_t      gap_sizes[3] = {0, 64, (size_t)-1}; /* Gap sizes to test */
+    size_t      gap_size;       /* Gap size retrieved */
+    int         *data = NULL;   /* Expected contents of dataset */
+    int         *rbuf = NULL;   /* Data read */
+    int         pnt_vals[SIEVE_GAP_NPOINTS];    /* Point values */
+    unsigned    u, v;           /* Local index variables */
+
+    TESTING("point selections through the sieve buffer");
+
+    if(NULL == (data = (int *)HDmalloc(SIEVE_GAP_DIM * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(SIEVE_GAP_DIM * sizeof(int))))
+        TEST_ERROR
+
+    /* Check the property's default and round trip */
+    if((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pget_sieve_gap_size(my_fapl, &gap_size) < 0)
+        FAIL_STACK_ERROR
+    if(gap_size != 64 * KB)
+        TEST_ERROR
+
+    /* Use a sieve buffer much smaller than the dataset */
+    if(H5Pset_sieve_buf_size(my_fapl, (size_t)KB) < 0)
+        FAIL_STACK_ERROR
+
+    h5_fixname(FILENAME[26], fapl, filename, sizeof filename);
+
+    /* Scatter the points over the dataset, out of order, with the last
+     * point repeating the first one
+     */
+    for(u = 0; u < SIEVE_GAP_NPOINTS - 1; u++)
+        coords[u] = ((hsize_t)u * 397) % SIEVE_GAP_DIM;
+    coords[SIEVE_GAP_NPOINTS - 1] = coords[0];
+
+    for(v = 0; v < 3; v++) {
+        if(H5Pset_sieve_gap_size(my_fapl, gap_sizes[v]) < 0)
+            FAIL_STACK_ERROR
+        if(H5Pget_sieve_gap_size(my_fapl, &gap_size) < 0)
+            FAIL_STACK_ERROR
+        if(gap_size != gap_sizes[v])
+            TEST_ERROR
+
+        if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+            FAIL_STACK_ERROR
+        if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        if((mid = H5Screate_simple(1, mdims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        if((did = H5Dcreate2(fid, DSET_SIEVE_GAP_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        for(u = 0; u < SIEVE_GAP_DIM; u++)
+            data[u] = (int)u;
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+            FAIL_STACK_ERROR
+
+        /* Write the points; the repeated point must get the last value */
+        for(u = 0; u < SIEVE_GAP_NPOINTS; u++) {
+            pnt_vals[u] = -(int)(u + 1);
+            data[coords[u]] = pnt_vals[u];
+        } /* end for */
+        if(H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)SIEVE_GAP_NPOINTS, coords) < 0)
+            FAIL_STACK_ERROR
+        if(H5Dwrite(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, pnt_vals) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read the points back, in their selection order */
+        HDmemset(pnt_vals, 0, sizeof(pnt_vals));
+        if(H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, pnt_vals) < 0)
+            FAIL_STACK_ERROR
+        for(u = 0; u < SIEVE_GAP_NPOINTS; u++)
+            if(pnt_vals[u] != data[coords[u]])
+                TEST_ERROR
+
+        if(H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        if(H5Fclose(fid) < 0)
+            FAIL_STACK_ERROR
+
+        /* Check the whole dataset after reopening the file */
+        if((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+            FAIL_STACK_ERROR
+        if((did = H5Dopen2(fid, DSET_SIEVE_GAP_NAME, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for(u = 0; u < SIEVE_GAP_DIM; u++)
+            if(rbuf[u] != data[u])
+                TEST_ERROR
+
+        if(H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sclose(mid) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+        if(H5Fclose(fid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if(H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(data);
+    HDfree(rbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    if(data)
+        HDfree(data);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_sieve_gap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_io_plan
+ *
+ * Purpose:     Tests reading and writing a block at a moving offset in
+ *              contiguous and chunked datasets through a dataset I/O
+ *              plan, with and without datatype conversion, and that a
+ *              plan can't be used while its dataset's extent differs
+ *              from the plan's.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_io_plan(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* File dataspace ID */
+    hid_t       mid = -1;       /* Memory dataspace ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       did = -1;       /* Dataset ID */
+    hid_t       plan = -1;      /* I/O plan ID */
+    hid_t       conv_plan = -1; /* I/O plan ID, with datatype conversion */
+    hsize_t     dims[2] = {IO_PLAN_DIM1, IO_PLAN_DIM2};     /* Dataset dimensions */
+    hsize_t     max_dims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};   /* Maximum dataset dimensions */
+    hsize_t     small_dims[2] = {IO_PLAN_BLOCK1, IO_PLAN_BLOCK2};   /* Shrunk dataset dimensions */
+    hsize_t     chunk_dims[2] = {6, 7};                     /* Chunk dimensions */
+    hsize_t     mdims[3] = {2, IO_PLAN_BLOCK1, IO_PLAN_BLOCK2}; /* Memory dimensions */
+    hsize_t     start[3] = {1, 0, 0};                       /* Block start */
+    hsize_t     count[3] = {1, 1, 1};                       /* Block count */
+    hsize_t     block[3] = {1, IO_PLAN_BLOCK1, IO_PLAN_BLOCK2}; /* Block size */
+    hssize_t    offset[2];      /* Offset of file block */
+    int         data[IO_PLAN_DIM1][IO_PLAN_DIM2];   /* Expected contents of dataset */
+    int         rbuf[IO_PLAN_DIM1][IO_PLAN_DIM2];   /* Data read */
+    int         buf[2][IO_PLAN_BLOCK1][IO_PLAN_BLOCK2];         /* Block buffer */
+    long long   lbuf[2][IO_PLAN_BLOCK1][IO_PLAN_BLOCK2];        /* Converted block buffer */
+    herr_t      ret;            /* Generic return value */
+    unsigned    i, j, n;        /* Local index variables */
+    int         layout;         /* Dataset layout to test */
+
+    TESTING("dataset I/O plans");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    for(layout = 0; layout < 2; layout++) {
+        if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            FAIL_STACK_ERROR
+        if((sid = H5Screate_simple(2, dims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR
+        if(layout && H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+            FAIL_STACK_ERROR
+        if((did = H5Dcreate2(fid, DSET_IO_PLAN_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        for(i = 0; i < IO_PLAN_DIM1; i++)
+            for(j = 0; j < IO_PLAN_DIM2; j++)
+                data[i][j] = (int)(i * IO_PLAN_DIM2 + j);
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+            FAIL_STACK_ERROR
+
+        /* Plan transfers between a block at the origin of the dataset and
+         * the second plane of a 3-D memory buffer
+         */
+        if((mid = H5Screate_simple(3, mdims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, NULL, count, block) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start[1], NULL, count, &block[1]) < 0)
+            FAIL_STACK_ERROR
+        if((plan = H5Dplan_create(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if((conv_plan = H5Dplan_create(did, H5T_NATIVE_LLONG, mid, sid, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        /* The plans keep their own copies of the dataspaces and hold the
+         * dataset open
+         */
+        if(H5Sselect_none(sid) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sclose(mid) < 0)
+            FAIL_STACK_ERROR
+        if(H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read and write the block at a series of offsets */
+        for(n = 0; n < 40; n++) {
+            offset[0] = (hssize_t)((n * 7) % (IO_PLAN_DIM1 - IO_PLAN_BLOCK1 + 1));
+            offset[1] = (hssize_t)((n * 11) % (IO_PLAN_DIM2 - IO_PLAN_BLOCK2 + 1));
+
+            HDmemset(buf, 0, sizeof(buf));
+            if(H5Dplan_read(plan, offset, buf) < 0)
+                FAIL_STACK_ERROR
+            HDmemset(lbuf, 0, sizeof(lbuf));
+            if(H5Dplan_read(conv_plan, offset, lbuf) < 0)
+                FAIL_STACK_ERROR
+            for(i = 0; i < IO_PLAN_BLOCK1; i++)
+                for(j = 0; j < IO_PLAN_BLOCK2; j++) {
+                    if(buf[0][i][j] != 0 || lbuf[0][i][j] != 0)
+                        TEST_ERROR
+                    if(buf[1][i][j] != data[(hsize_t)offset[0] + i][(hsize_t)offset[1] + j])
+                        TEST_ERROR
+                    if(lbuf[1][i][j] != (long long)buf[1][i][j])
+                        TEST_ERROR
+
+                    /* Update the block, alternating between the plans */
+                    buf[1][i][j] = -(int)(n * 1000 + i * IO_PLAN_BLOCK2 + j);
+                    lbuf[1][i][j] = (long long)buf[1][i][j];
+                    data[(hsize_t)offset[0] + i][(hsize_t)offset[1] + j] = buf[1][i][j];
+                } /* end for */
+            if(H5Dplan_write((n % 2) ? conv_plan : plan, offset, (n % 2) ? (void *)lbuf : (void *)buf) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+
+        /* A NULL offset uses the block at the origin */
+        if(H5Dplan_read(plan, NULL, buf) < 0)
+            FAIL_STACK_ERROR
+        for(i = 0; i < IO_PLAN_BLOCK1; i++)
+            for(j = 0; j < IO_PLAN_BLOCK2; j++)
+                if(buf[1][i][j] != data[i][j])
+                    TEST_ERROR
+
+        /* Offsets that move the block out of the dataset must fail */
+        offset[0] = IO_PLAN_DIM1 - IO_PLAN_BLOCK1 + 1;
+        offset[1] = 0;
+        H5E_BEGIN_TRY {
+            ret = H5Dplan_read(plan, offset, buf);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            TEST_ERROR
+        offset[0] = 0;
+        offset[1] = -1;
+        H5E_BEGIN_TRY {
+            ret = H5Dplan_write(plan, offset, buf);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            TEST_ERROR
+
+        /* Plans are not datasets */
+        H5E_BEGIN_TRY {
+            ret = H5Dclose(plan);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            TEST_ERROR
+
+        if(H5Dplan_close(plan) < 0)
+            FAIL_STACK_ERROR
+        plan = -1;
+        if(H5Dplan_close(conv_plan) < 0)
+            FAIL_STACK_ERROR
+        conv_plan = -1;
+
+        /* A plan for the whole of an extendible dataset can't write once
+         * the dataset shrinks, and works again at the plan's extent
+         */
+        if(layout) {
+            if((mid = H5Screate_simple(2, dims, max_dims)) < 0)
+                FAIL_STACK_ERROR
+            if((did = H5Dcreate2(fid, DSET_IO_PLAN_EXT_NAME, H5T_NATIVE_INT, mid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if(H5Sclose(mid) < 0)
+                FAIL_STACK_ERROR
+            mid = -1;
+            if((plan = H5Dplan_create(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if(H5Dplan_write(plan, NULL, data) < 0)
+                FAIL_STACK_ERROR
+
+            if(H5Dset_extent(did, small_dims) < 0)
+                FAIL_STACK_ERROR
+            H5E_BEGIN_TRY {
+                ret = H5Dplan_write(plan, NULL, data);
+            } H5E_END_TRY;
+            if(ret >= 0)
+                TEST_ERROR
+            H5E_BEGIN_TRY {
+                ret = H5Dplan_read(plan, NULL, rbuf);
+            } H5E_END_TRY;
+            if(ret >= 0)
+                TEST_ERROR
+
+            if(H5Dset_extent(did, dims) < 0)
+                FAIL_STACK_ERROR
+            if(H5Dplan_write(plan, NULL, data) < 0)
+                FAIL_STACK_ERROR
+            if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            for(i = 0; i < IO_PLAN_DIM1; i++)
+                for(j = 0; j < IO_PLAN_DIM2; j++)
+                    if(rbuf[i][j] != data[i][j])
+                        TEST_ERROR
+
+            if(H5Dplan_close(plan) < 0)
+                FAIL_STACK_ERROR
+            plan = -1;
+            if(H5Dclose(did) < 0)
+                FAIL_STACK_ERROR
+            did = -1;
+        } /* end if */
+
+        /* Verify the whole dataset */
+        if((did = H5Dopen2(fid, DSET_IO_PLAN_NAME, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for(i = 0; i < IO_PLAN_DIM1; i++)
+            for(j = 0; j < IO_PLAN_DIM2; j++)
+                if(rbuf[i][j] != data[i][j])
+                    TEST_ERROR
+
+        if(H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        if(H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+        if(H5Fclose(fid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dplan_close(plan);
+        H5Dplan_close(conv_plan);
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_io_plan() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_dset_io
+ *
+ * Purpose:     Tests H5Dread_multi() and H5Dwrite_multi() against
+ *              H5Dread() and H5Dwrite(), across contiguous and chunked
+ *              datasets, with and without datatype conversion, with a
+ *              dirty sieve buffer and with elements written twice in
+ *              one call, with and without datatype conversion.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multi_dset_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* File dataspace ID */
+    hid_t       fsid[MULTI_NDSETS + 1];     /* File dataspace IDs for transfers */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       did[MULTI_NDSETS + 1];      /* Dataset IDs */
+    hid_t       tid[MULTI_NDSETS + 1];      /* Memory datatype IDs */
+    hid_t       mid[MULTI_NDSETS + 1];      /* Memory dataspace IDs */
+    hsize_t     dims[1] = {MULTI_DIM};      /* Dataset dimensions */
+    hsize_t     mdims[1] = {MULTI_DIM / 2}; /* Memory dimensions */
+    hsize_t     chunk_dims[1] = {16};       /* Chunk dimensions */
+    hsize_t     start[1], stride[1] = {2}, count[1] = {MULTI_DIM / 2}, block[1] = {1};
+    hsize_t     coord[1];       /* Point to select */
+    int         data[MULTI_NDSETS][MULTI_DIM];      /* Expected contents of datasets */
+    int         wbuf[MULTI_NDSETS + 1][MULTI_DIM];  /* Data to write */
+    int         rbuf[MULTI_NDSETS + 1][MULTI_DIM];  /* Data read */
+    long long   lwbuf[MULTI_DIM];   /* Converted data to write */
+    long long   lrbuf[MULTI_DIM];   /* Converted data read */
+    void        *rbufs[MULTI_NDSETS + 1];           /* Read buffers */
+    const void  *wbufs[MULTI_NDSETS + 1];           /* Write buffers */
+    hid_t       mix_did[2];     /* Dataset IDs for mixed writes */
+    hid_t       mix_tid[2];     /* Memory datatype IDs for mixed writes */
+    hid_t       mix_mid[2];     /* Memory dataspace IDs for mixed writes */
+    hid_t       mix_fsid[2];    /* File dataspace IDs for mixed writes */
+    const void  *mix_wbufs[2];  /* Write buffers for mixed writes */
+    int         val;            /* Single value to write */
+    herr_t      ret;            /* Generic return value */
+    unsigned    u, v;           /* Local index variables */
+
+    TESTING("multi-dataset read and write");
+
+    for(u = 0; u <= MULTI_NDSETS; u++)
+        fsid[u] = did[u] = -1;
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, mdims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+
+    /* Datasets 0, 2 and 3 are contiguous, dataset 1 is chunked.  Dataset 2
+     * is transferred as long long, the others as int.
+     */
+    for(u = 0; u < MULTI_NDSETS; u++) {
+        char name[32];
+
+        HDsnprintf(name, sizeof(name), "multi_%u", u);
+        if((did[u] = H5Dcreate2(fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, (u == 1 ? dcpl : H5P_DEFAULT), H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        tid[u] = (u == 2 ? H5T_NATIVE_LLONG : H5T_NATIVE_INT);
+
+        for(v = 0; v < MULTI_DIM; v++)
+            wbuf[u][v] = data[u][v] = (int)(u * 1000 + v);
+        wbufs[u] = (u == 2 ? (const void *)lwbuf : (const void *)wbuf[u]);
+        rbufs[u] = (u == 2 ? (void *)lrbuf : (void *)rbuf[u]);
+        mid[u] = H5S_ALL;
+        fsid[u] = H5S_ALL;
+    } /* end for */
+    for(v = 0; v < MULTI_DIM; v++)
+        lwbuf[v] = (long long)data[2][v];
+
+    /* A zero count does nothing */
+    if(H5Dwrite_multi((size_t)0, NULL, NULL, NULL, NULL, H5P_DEFAULT, NULL) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write the whole datasets and check them with H5Dread() */
+    if(H5Dwrite_multi((size_t)MULTI_NDSETS, did, tid, mid, fsid, H5P_DEFAULT, wbufs) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < MULTI_NDSETS; u++) {
+        if(H5Dread(did[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[u]) < 0)
+            FAIL_STACK_ERROR
+        for(v = 0; v < MULTI_DIM; v++)
+            if(rbuf[u][v] != data[u][v])
+                TEST_ERROR
+    } /* end for */
+
+    /* Leave a dirty sieve buffer on dataset 3 */
+    if((fsid[3] = H5Scopy(sid)) < 0)
+        FAIL_STACK_ERROR
+    coord[0] = 1;
+    if(H5Sselect_elements(fsid[3], H5S_SELECT_SET, (size_t)1, coord) < 0)
+        FAIL_STACK_ERROR
+    if((mid[3] = H5Screate_simple(1, block, NULL)) < 0)
+        FAIL_STACK_ERROR
+    val = data[3][1] = -1;
+    if(H5Dwrite(did[3], H5T_NATIVE_INT, mid[3], fsid[3], H5P_DEFAULT, &val) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(mid[3]) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(fsid[3]) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read every other element of each dataset, starting at element u */
+    for(u = 0; u < MULTI_NDSETS; u++) {
+        if((fsid[u] = H5Scopy(sid)) < 0)
+            FAIL_STACK_ERROR
+        start[0] = u % 2;
+        if(H5Sselect_hyperslab(fsid[u], H5S_SELECT_SET, start, stride, count, block) < 0)
+            FAIL_STACK_ERROR
+        mid[u] = msid;
+    } /* end for */
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    HDmemset(lrbuf, 0, sizeof(lrbuf));
+    if(H5Dread_multi((size_t)MULTI_NDSETS, did, tid, mid, fsid, H5P_DEFAULT, rbufs) < 0)
+        FAIL_STACK_ERROR
+    for(v = 0; v < MULTI_DIM / 2; v++)
+        rbuf[2][v] = (int)lrbuf[v];
+    for(u = 0; u < MULTI_NDSETS; u++)
+        for(v = 0; v < MULTI_DIM / 2; v++)
+            if(rbuf[u][v] != data[u][(u % 2) + 2 * v])
+                TEST_ERROR
+
+    /* Load a clean sieve buffer for dataset 3 that the writes below make
+     * stale
+     */
+    if(H5Dread(did[3], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[3]) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write the same elements back with new values, and write dataset 0
+     * a second time, overlapping the first write
+     */
+    for(u = 0; u < MULTI_NDSETS; u++)
+        for(v = 0; v < MULTI_DIM / 2; v++) {
+            wbuf[u][v] = -(int)(u * 1000 + v) - 2;
+            data[u][(u % 2) + 2 * v] = wbuf[u][v];
+        } /* end for */
+    for(v = 0; v < MULTI_DIM / 2; v++)
+        lwbuf[v] = (long long)wbuf[2][v];
+    did[MULTI_NDSETS] = did[0];
+    tid[MULTI_NDSETS] = H5T_NATIVE_INT;
+    mid[MULTI_NDSETS] = msid;
+    if((fsid[MULTI_NDSETS] = H5Scopy(sid)) < 0)
+        FAIL_STACK_ERROR
+    start[0] = MULTI_DIM / 2;
+    count[0] = MULTI_DIM / 2;
+    stride[0] = 1;
+    if(H5Sselect_hyperslab(fsid[MULTI_NDSETS], H5S_SELECT_SET, start, stride, count, block) < 0)
+        FAIL_STACK_ERROR
+    for(v = 0; v < MULTI_DIM / 2; v++) {
+        wbuf[MULTI_NDSETS][v] = 5000 + (int)v;
+        data[0][(MULTI_DIM / 2) + v] = wbuf[MULTI_NDSETS][v];
+    } /* end for */
+    wbufs[MULTI_NDSETS] = wbuf[MULTI_NDSETS];
+    if(H5Dwrite_multi((size_t)(MULTI_NDSETS + 1), did, tid, mid, fsid, H5P_DEFAULT, wbufs) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < MULTI_NDSETS; u++) {
+        if(H5Dread(did[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[u]) < 0)
+            FAIL_STACK_ERROR
+        for(v = 0; v < MULTI_DIM; v++)
+            if(rbuf[u][v] != data[u][v])
+                TEST_ERROR
+    } /* end for */
+
+    /* Write all of dataset 3 as int, then its first half as long long in
+     * the same call.  The converted write goes through the sieve buffer
+     * and must both see the first write and win where they overlap.
+     */
+    start[0] = 0;
+    if(H5Sselect_hyperslab(fsid[MULTI_NDSETS], H5S_SELECT_SET, start, stride, count, block) < 0)
+        FAIL_STACK_ERROR
+    for(v = 0; v < MULTI_DIM; v++) {
+        wbuf[3][v] = 7000 + (int)v;
+        data[3][v] = (v < MULTI_DIM / 2) ? 8000 + (int)v : wbuf[3][v];
+    } /* end for */
+    for(v = 0; v < MULTI_DIM / 2; v++)
+        lwbuf[v] = (long long)(8000 + v);
+    mix_did[0] = mix_did[1] = did[3];
+    mix_tid[0] = H5T_NATIVE_INT;
+    mix_tid[1] = H5T_NATIVE_LLONG;
+    mix_mid[0] = mix_fsid[0] = H5S_ALL;
+    mix_mid[1] = msid;
+    mix_fsid[1] = fsid[MULTI_NDSETS];
+    mix_wbufs[0] = wbuf[3];
+    mix_wbufs[1] = lwbuf;
+    if(H5Dwrite_multi((size_t)2, mix_did, mix_tid, mix_mid, mix_fsid, H5P_DEFAULT, mix_wbufs) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dread(did[3], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[3]) < 0)
+        FAIL_STACK_ERROR
+    for(v = 0; v < MULTI_DIM; v++)
+        if(rbuf[3][v] != data[3][v])
+            TEST_ERROR
+
+    /* Selections with different numbers of elements must fail */
+    count[0] = 1;
+    if(H5Sselect_hyperslab(fsid[MULTI_NDSETS], H5S_SELECT_SET, start, stride, count, block) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dread_multi((size_t)(MULTI_NDSETS + 1), did, tid, mid, fsid, H5P_DEFAULT, rbufs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR
+
+    for(u = 0; u <= MULTI_NDSETS; u++)
+        if(H5Sclose(fsid[u]) < 0)
+            FAIL_STACK_ERROR
+    for(u = 0; u < MULTI_NDSETS; u++)
+        if(H5Dclose(did[u]) < 0)
+            FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        for(u = 0; u <= MULTI_NDSETS; u++)
+            H5Sclose(fsid[u]);
+        for(u = 0; u < MULTI_NDSETS; u++)
+            H5Dclose(did[u]);
+        H5Pclose(dcpl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_multi_dset_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_reserve
+ *
+ * Purpose:     Tests H5Pset_chunk_reserve(): chunks appended to two
+ *              datasets in turn should be laid out one after the other
+ *              in the file for each dataset, apart from where a new run
+ *              of reserved space begins.  Chunks of a file with
+ *              alignment must start on an alignment boundary.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_reserve(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       fapl2 = -1;     /* File access property list ID */
+    hid_t       sid = -1;       /* File dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       did[2] = {-1, -1};  /* Dataset IDs */
+    hsize_t     dims[1] = {0};  /* Dataset dimensions */
+    hsize_t     max_dims[1] = {H5S_UNLIMITED};  /* Maximum dataset dimensions */
+    hsize_t     chunk_dims[1] = {RESERVE_CHUNK};    /* Chunk dimensions */
+    hsize_t     mdims[1] = {RESERVE_CHUNK};     /* Memory dimensions */
+    hsize_t     start[1], count[1] = {RESERVE_CHUNK};
+    hsize_t     offset[1];      /* Chunk offset */
+    hsize_t     max_size;       /* Reservation limit */
+    haddr_t     addr[RESERVE_NCHUNKS];  /* Chunk addresses */
+    int         wbuf[RESERVE_CHUNK];    /* Data to write */
+    int         rbuf[RESERVE_CHUNK];    /* Data read */
+    herr_t      ret;            /* Generic return value */
+    unsigned    u, v, w;        /* Local index variables */
+
+    TESTING("chunk space reservation");
+
+    /* Check the property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pget_chunk_reserve(dapl, &max_size) < 0)
+        FAIL_STACK_ERROR
+    if(max_size != 0)
+        TEST_ERROR
+    if(H5Pset_chunk_reserve(dapl, (hsize_t)1024 * 1024) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pget_chunk_reserve(dapl, &max_size) < 0)
+        FAIL_STACK_ERROR
+    if(max_size != (hsize_t)1024 * 1024)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_reserve(dapl, HSIZE_UNDEF);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR
+
+    /* Don't cache chunks, so each chunk gets its space when it's written */
+    if(H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    if((sid = H5Screate_simple(1, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, mdims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if((did[0] = H5Dcreate2(fid, "reserve0", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if((did[1] = H5Dcreate2(fid, "reserve1", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    sid = -1;
+
+    /* Append a chunk to each dataset in turn */
+    for(u = 0; u < RESERVE_NCHUNKS; u++)
+        for(v = 0; v < 2; v++) {
+            for(w = 0; w < RESERVE_CHUNK; w++)
+                wbuf[w] = (int)((v * RESERVE_NCHUNKS + u) * RESERVE_CHUNK + w);
+
+            dims[0] = (hsize_t)(u + 1) * RESERVE_CHUNK;
+            if(H5Dset_extent(did[v], dims) < 0)
+                FAIL_STACK_ERROR
+            if((sid = H5Dget_space(did[v])) < 0)
+                FAIL_STACK_ERROR
+            start[0] = (hsize_t)u * RESERVE_CHUNK;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if(H5Dwrite(did[v], H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf) < 0)
+                FAIL_STACK_ERROR
+            if(H5Sclose(sid) < 0)
+                FAIL_STACK_ERROR
+            sid = -1;
+        } /* end for */
+
+    /* Close the datasets, returning the unused reserved space */
+    for(v = 0; v < 2; v++) {
+        if(H5Dclose(did[v]) < 0)
+            FAIL_STACK_ERROR
+        did[v] = -1;
+    } /* end for */
+
+    /* Reopen the datasets without the reservation and check the layout
+     * and data.  The runs of reserved space hold 4, 8 and 16 chunks, so
+     * only chunks 4 and 12 may start away from the previous chunk.
+     */
+    for(v = 0; v < 2; v++) {
+        if((did[v] = H5Dopen2(fid, v ? "reserve1" : "reserve0", H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        for(u = 0; u < RESERVE_NCHUNKS; u++) {
+            offset[0] = (hsize_t)u * RESERVE_CHUNK;
+            if(H5D__chunk_addr_test(did[v], offset, &addr[u]) < 0)
+                FAIL_STACK_ERROR
+            if(!H5F_addr_defined(addr[u]))
+                TEST_ERROR
+            if(u > 0 && u != 4 && u != 12 &&
+                    addr[u] != addr[u - 1] + RESERVE_CHUNK * sizeof(int))
+                TEST_ERROR
+
+            if((sid = H5Dget_space(did[v])) < 0)
+                FAIL_STACK_ERROR
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if(H5Dread(did[v], H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            if(H5Sclose(sid) < 0)
+                FAIL_STACK_ERROR
+            sid = -1;
+            for(w = 0; w < RESERVE_CHUNK; w++)
+                if(rbuf[w] != (int)((v * RESERVE_NCHUNKS + u) * RESERVE_CHUNK + w))
+                    TEST_ERROR
+        } /* end for */
+
+        if(H5Dclose(did[v]) < 0)
+            FAIL_STACK_ERROR
+        did[v] = -1;
+    } /* end for */
+
+    if(H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    fid = -1;
+
+    /* With alignment, each chunk must still start on an alignment boundary */
+    if((fapl2 = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_alignment(fapl2, (hsize_t)1, (hsize_t)RESERVE_ALIGN) < 0)
+        FAIL_STACK_ERROR
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl2)) < 0)
+        FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if((did[0] = H5Dcreate2(fid, "reserve0", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    sid = -1;
+
+    for(u = 0; u < RESERVE_NCHUNKS; u++) {
+        offset[0] = (hsize_t)u * RESERVE_CHUNK;
+        if((sid = H5Dget_space(did[0])) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if(H5Dwrite(did[0], H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+        sid = -1;
+
+        if(H5D__chunk_addr_test(did[0], offset, &addr[u]) < 0)
+            FAIL_STACK_ERROR
+        if(!H5F_addr_defined(addr[u]))
+            TEST_ERROR
+        if(addr[u] % RESERVE_ALIGN)
+            TEST_ERROR
+    } /* end for */
+
+    if(H5Dclose(did[0]) < 0)
+        FAIL_STACK_ERROR
+    did[0] = -1;
+
+    if(H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did[0]);
+        H5Dclose(did[1]);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl2);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_reserve() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -13209,6 +14095,10 @@ main(void)
             nerrors += (test_zero_dim_dset(my_fapl) < 0             ? 1 : 0);
             nerrors += (test_storage_size(my_fapl) < 0              ? 1 : 0);
             nerrors += (test_power2up(my_fapl) < 0                  ? 1 : 0);
+            nerrors += (test_sieve_gap(my_fapl) < 0                 ? 1 : 0);
+            nerrors += (test_io_plan(my_fapl) < 0                   ? 1 : 0);
+            nerrors += (test_multi_dset_io(my_fapl) < 0             ? 1 : 0);
+            nerrors += (test_chunk_reserve(my_fapl) < 0             ? 1 : 0);
 
             nerrors += (test_swmr_non_latest(envval, my_fapl) < 0   ? 1 : 0);
             nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0     ? 1 : 0);
@@ -911,6 +911,20 @@ h5_fileaccess(void)
          * and copy buffer size to the default values. */
         if(H5Pset_fapl_direct(fapl, 1024, 4096, 8 * 4096) < 0)
             return -1;
+#endif
+    }
+    else if(!HDstrcmp(name, "mmap")) {
+#if defined(H5_HAVE_MMAP) && defined(H5_HAVE_SYS_MMAN_H)
+        /* Reads copied out of a memory mapping of the file */
+        if(H5Pset_fapl_mmap(fapl) < 0)
+            return -1;
+#endif
+    }
+    else if(!HDstrcmp(name, "iouring")) {
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+        /* Requests kept in flight with io_uring, at the default queue depth */
+        if(H5Pset_fapl_iouring(fapl, 0, FALSE, (size_t)0, (size_t)0) < 0)
+            return -1;
 #endif
     }
     else if(!HDstrcmp(name, "latest")) {
@@ -1051,6 +1065,18 @@ h5_get_vfd_fapl(void)
          */
         if(H5Pset_fapl_direct(fapl, 1024, 4096, 8*4096)<0)
             return -1;
+#endif
+#if defined(H5_HAVE_MMAP) && defined(H5_HAVE_SYS_MMAN_H)
+    } else if(!HDstrcmp(tok, "mmap")) {
+        /* Reads copied out of a memory mapping of the file */
+        if(H5Pset_fapl_mmap(fapl) < 0)
+            return -1;
+#endif
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+    } else if(!HDstrcmp(tok, "iouring")) {
+        /* Requests kept in flight with io_uring, at the default queue depth */
+        if(H5Pset_fapl_iouring(fapl, 0, FALSE, (size_t)0, (size_t)0) < 0)
+            return -1;
 #endif
     } else {
         /* Unknown driver */
@@ -1334,6 +1360,12 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
                 driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#if defined(H5_HAVE_MMAP) && defined(H5_HAVE_SYS_MMAN_H)
+                driver == H5FD_MMAP ||
+#endif /* H5_HAVE_MMAP && H5_HAVE_SYS_MMAN_H */
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+                driver == H5FD_IOURING ||
+#endif /* H5_HAVE_PREAD && H5_HAVE_PWRITE */
                 driver == H5FD_LOG) {
             /* Get the file's statistics */
             if(0 == HDstat(filename, &sb))
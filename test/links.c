@@ -949,6 +949,96 @@ toomany(hid_t fapl, hbool_t new_format)
     return -1;
 } /* end toomany() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    lookup_after_unlink
+ *
+ * Purpose:     Check that paths looked up before links are removed,
+ *              moved or replaced resolve to the current objects
+ *              afterwards
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+lookup_after_unlink(hid_t fapl, hbool_t new_format)
+{
+    hid_t		fid = (-1);     	/* File ID */
+    hid_t		gid = (-1);     	/* Group ID */
+    hid_t		sid = (-1);     	/* Dataspace ID */
+    hid_t		did = (-1);     	/* Dataset ID */
+    hid_t		oid = (-1);     	/* Object ID */
+    H5O_info_t          oinfo1, oinfo2;         /* Object info */
+    char		filename[NAME_BUF_SIZE];
+
+    if(new_format)
+        TESTING("path lookups after links change (w/new group format)")
+    else
+        TESTING("path lookups after links change")
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+
+    /* Look up a group by path */
+    if((gid = H5Gcreate2(fid, "/g", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/g/a", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((oid = H5Oopen(fid, "/g/a", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Oclose(oid) < 0) TEST_ERROR
+
+    /* Replace it with a dataset */
+    if(H5Ldelete(fid, "/g/a", H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Lexists(fid, "/g/a", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if((sid = H5Screate(H5S_SCALAR)) < 0) TEST_ERROR
+    if((did = H5Dcreate2(fid, "/g/a", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+    if(H5Oget_info_by_name(fid, "/g/a", &oinfo1, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5O_TYPE_DATASET != oinfo1.type) TEST_ERROR
+
+    /* Delete the parent group and create a new one in its place */
+    if(H5Ldelete(fid, "/g", H5P_DEFAULT) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/g", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if(H5Lexists(fid, "/g/a", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/g/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if(H5Oget_info_by_name(fid, "/g/b", &oinfo1, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5O_TYPE_GROUP != oinfo1.type) TEST_ERROR
+
+    /* Move it */
+    if(H5Lmove(fid, "/g/b", fid, "/g/c", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Lexists(fid, "/g/b", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Oget_info_by_name(fid, "/g/c", &oinfo2, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5F_addr_ne(oinfo1.addr, oinfo2.addr)) TEST_ERROR
+
+    /* Look the paths up again after reopening the file */
+    if(H5Fclose(fid) < 0) TEST_ERROR
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) TEST_ERROR
+    if(H5Lexists(fid, "/g/b", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Oget_info_by_name(fid, "/g/c", &oinfo2, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5F_addr_ne(oinfo1.addr, oinfo2.addr)) TEST_ERROR
+
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+ error:
+    H5E_BEGIN_TRY {
+    	H5Oclose(oid);
+    	H5Dclose(did);
+    	H5Sclose(sid);
+    	H5Gclose(gid);
+    	H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end lookup_after_unlink() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_lcpl
@@ -7750,6 +7840,7 @@ done:
             case H5I_ERROR_CLASS:
             case H5I_ERROR_MSG:
             case H5I_ERROR_STACK:
+            case H5I_DATASET_PLAN:
             case H5I_NTYPES:
             default:
               return -1;
@@ -7838,6 +7929,7 @@ done:
             case H5I_ERROR_CLASS:
             case H5I_ERROR_MSG:
             case H5I_ERROR_STACK:
+            case H5I_DATASET_PLAN:
             case H5I_NTYPES:
             default:
                 return -1;
@@ -14923,6 +15015,7 @@ main(void)
         nerrors += ck_new_links(my_fapl, new_format) < 0 ? 1 : 0;
         nerrors += long_links(my_fapl, new_format) < 0 ? 1 : 0;
         nerrors += toomany(my_fapl, new_format) < 0 ? 1 : 0;
+        nerrors += lookup_after_unlink(my_fapl, new_format) < 0 ? 1 : 0;
 
         /* Test new H5L link creation routine */
         nerrors += test_lcpl(my_fapl, new_format);
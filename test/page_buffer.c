@@ -51,6 +51,10 @@ static unsigned test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
 static unsigned test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_stats_collection(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_readahead(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_resize(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_preload(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_visit_prefetch(hid_t orig_fapl, const char *env_h5_drvr);
 #ifdef H5_HAVE_PARALLEL
 static unsigned verify_page_buffering_disabled(hid_t orig_fapl, 
     const char *env_h5_drvr);
@@ -2003,6 +2007,724 @@ error:
 } /* test_stats_collection */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_readahead()
+ *
+ * Purpose:     Check that sequential page misses trigger readahead of
+ *              the following pages, that explicitly prefetched pages are
+ *              hits on their first access, and that the data read from
+ *              both is correct.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_readahead(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char filename[FILENAME_LEN]; /* Filename to use */
+    hid_t file_id = -1;          /* File ID */
+    hid_t fcpl = -1;
+    hid_t fapl = -1;
+    int i, j;
+    int num_pages = 10;
+    int page_elmts = 200;
+    size_t page_size = sizeof(int) * 200;
+    unsigned readahead = 0;
+    haddr_t raw_addr = HADDR_UNDEF;
+    haddr_t prefetch_addrs[7];
+    int *data = NULL;
+    H5F_t *f = NULL;
+
+    TESTING("Readahead and prefetching");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR
+
+    if(set_multi_split(env_h5_drvr, fapl, sizeof(int)*200)  != 0)
+        TEST_ERROR;
+
+    if((data = (int *)HDcalloc((size_t)(num_pages * page_elmts), sizeof(int))) == NULL)
+        TEST_ERROR
+
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+
+    if(H5Pset_file_space_page_size(fcpl, page_size) < 0)
+        TEST_ERROR;
+
+    /* keep 10 pages at max in the page buffer, no readahead at first */
+    if(H5Pset_page_buffer_size(fapl, page_size * 10, 0, 0) < 0)
+        TEST_ERROR;
+
+    if(H5Pget_page_buffer_readahead(fapl, &readahead) < 0)
+        FAIL_STACK_ERROR;
+    if(readahead != 0)
+        TEST_ERROR;
+
+    /* Write 10 pages of raw data, bypassing the page buffer */
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if(HADDR_UNDEF == (raw_addr = H5MF_alloc(f, H5FD_MEM_DRAW, page_size * (size_t)num_pages)))
+        FAIL_STACK_ERROR;
+    if(0 != raw_addr % page_size)
+        TEST_ERROR;
+
+    for(i = 0; i < num_pages * page_elmts; i++)
+        data[i] = i;
+    if(H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, page_size * (size_t)num_pages, data) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Reopen with readahead of 4 pages */
+    if(H5Pset_page_buffer_readahead(fapl, 4) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pget_page_buffer_readahead(fapl, &readahead) < 0)
+        FAIL_STACK_ERROR;
+    if(readahead != 4)
+        TEST_ERROR;
+
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    /* The root group's page is prefetched on open */
+    if(f->shared->page_buf->prefetches[0] < 1)
+        TEST_ERROR;
+
+    if(H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Read the first quarter of each page in order:  the first page
+     * misses, the second one is a sequential miss that reads the next
+     * four pages ahead, and so does the seventh one.
+     */
+    for(i = 0; i < num_pages; i++) {
+        HDmemset(data, 0, page_size);
+        if(H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (haddr_t)i * page_size, page_size / 4, data) < 0)
+            FAIL_STACK_ERROR;
+        for(j = 0; j < page_elmts / 4; j++)
+            if(data[j] != i * page_elmts + j)
+                TEST_ERROR;
+    } /* end for */
+
+    if(f->shared->page_buf->misses[1] != 3)
+        TEST_ERROR;
+    if(f->shared->page_buf->hits[1] != 7)
+        TEST_ERROR;
+    if(f->shared->page_buf->prefetches[1] < 7)
+        TEST_ERROR;
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Reopen without readahead, and prefetch half of the pages from a
+     * list with a duplicate page and an undefined address
+     */
+    if(H5Pset_page_buffer_readahead(fapl, 0) < 0)
+        FAIL_STACK_ERROR;
+
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if(H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    for(i = 0; i < 5; i++)
+        prefetch_addrs[i] = raw_addr + (haddr_t)i * page_size + sizeof(int) * 10;
+    prefetch_addrs[5] = raw_addr + sizeof(int) * 50;
+    prefetch_addrs[6] = HADDR_UNDEF;
+    if(H5Fprefetch_pages(file_id, H5FD_MEM_DRAW, (size_t)7, prefetch_addrs) < 0)
+        FAIL_STACK_ERROR;
+
+    if(f->shared->page_buf->prefetches[1] != 5)
+        TEST_ERROR;
+
+    /* The prefetched pages hit, the others miss */
+    for(i = 0; i < num_pages; i++) {
+        HDmemset(data, 0, page_size);
+        if(H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (haddr_t)i * page_size + page_size / 2, page_size / 4, data) < 0)
+            FAIL_STACK_ERROR;
+        for(j = 0; j < page_elmts / 4; j++)
+            if(data[j] != i * page_elmts + page_elmts / 2 + j)
+                TEST_ERROR;
+    } /* end for */
+
+    if(f->shared->page_buf->hits[1] != 5)
+        TEST_ERROR;
+    if(f->shared->page_buf->misses[1] != 5)
+        TEST_ERROR;
+    if(f->shared->page_buf->prefetches[1] != 5)
+        TEST_ERROR;
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(data);
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if(data)
+            HDfree(data);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_readahead */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_resize()
+ *
+ * Purpose:     Check that H5Fset_page_buffer_size() shrinks, grows,
+ *              disables and re-enables the page buffer of an open file
+ *              without losing dirty data.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_resize(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char filename[FILENAME_LEN]; /* Filename to use */
+    hid_t file_id = -1;          /* File ID */
+    hid_t fcpl = -1;
+    hid_t fapl = -1;
+    hid_t fapl2 = -1;
+    int i, j;
+    int num_pages = 10;
+    int page_elmts = 200;
+    size_t page_size = sizeof(int) * 200;
+    size_t buf_size = 0;
+    unsigned min_meta_perc = 0, min_raw_perc = 0;
+    unsigned evictions[2] = {0, 0};
+    haddr_t raw_addr = HADDR_UNDEF;
+    herr_t ret;
+    int *data = NULL;
+    H5F_t *f = NULL;
+
+    TESTING("Resizing the page buffer of an open file");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR
+
+    if(set_multi_split(env_h5_drvr, fapl, sizeof(int)*200)  != 0)
+        TEST_ERROR;
+
+    if((data = (int *)HDcalloc((size_t)(num_pages * page_elmts), sizeof(int))) == NULL)
+        TEST_ERROR
+
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+
+    if(H5Pset_file_space_page_size(fcpl, page_size) < 0)
+        TEST_ERROR;
+
+    /* keep 12 pages at max in the page buffer */
+    if(H5Pset_page_buffer_size(fapl, page_size * 12, 0, 0) < 0)
+        TEST_ERROR;
+
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if(HADDR_UNDEF == (raw_addr = H5MF_alloc(f, H5FD_MEM_DRAW, page_size * (size_t)num_pages)))
+        FAIL_STACK_ERROR;
+
+    /* Dirty the 10 pages with small writes */
+    for(i = 0; i < num_pages * page_elmts; i++)
+        data[i] = i;
+    for(i = 0; i < num_pages; i++)
+        if(H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (haddr_t)i * page_size, page_size / 2, data + i * page_elmts) < 0)
+            FAIL_STACK_ERROR;
+    if(f->shared->page_buf->raw_count != (unsigned)num_pages)
+        TEST_ERROR;
+
+    /* Sizes below one page and bad fractions are rejected */
+    H5E_BEGIN_TRY {
+        ret = H5Fset_page_buffer_size(file_id, page_size - 1, 0, 0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Fset_page_buffer_size(file_id, page_size * 4, 60, 50);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+
+    /* Shrink to 4 pages (rounding down), evicting the oldest pages */
+    if(H5Fset_page_buffer_size(file_id, page_size * 4 + 10, 50, 0) < 0)
+        FAIL_STACK_ERROR;
+    if(f->shared->page_buf->max_size != page_size * 4)
+        TEST_ERROR;
+    if(f->shared->page_buf->min_meta_count != 2)
+        TEST_ERROR;
+    if(H5SL_count(f->shared->page_buf->slist_ptr) > 4)
+        TEST_ERROR;
+    if(f->shared->page_buf->evictions[1] < (unsigned)num_pages - 4)
+        TEST_ERROR;
+    evictions[0] = f->shared->page_buf->evictions[0];
+    evictions[1] = f->shared->page_buf->evictions[1];
+
+    /* The new settings show in the file's access property list */
+    if((fapl2 = H5Fget_access_plist(file_id)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pget_page_buffer_size(fapl2, &buf_size, &min_meta_perc, &min_raw_perc) < 0)
+        FAIL_STACK_ERROR;
+    if(buf_size != page_size * 4 || min_meta_perc != 50 || min_raw_perc != 0)
+        TEST_ERROR;
+    if(H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Grow again, and check the data, including the evicted pages */
+    if(H5Fset_page_buffer_size(file_id, page_size * 20, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+    if(f->shared->page_buf->max_size != page_size * 20)
+        TEST_ERROR;
+    if(f->shared->page_buf->evictions[0] != evictions[0] ||
+            f->shared->page_buf->evictions[1] != evictions[1])
+        TEST_ERROR;
+
+    for(i = 0; i < num_pages; i++) {
+        HDmemset(data, 0, page_size);
+        if(H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (haddr_t)i * page_size, page_size / 2, data) < 0)
+            FAIL_STACK_ERROR;
+        for(j = 0; j < page_elmts / 2; j++)
+            if(data[j] != i * page_elmts + j)
+                TEST_ERROR;
+    } /* end for */
+
+    /* Disable page buffering, then enable it again */
+    if(H5Fset_page_buffer_size(file_id, 0, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL != f->shared->page_buf)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Freset_page_buffering_stats(file_id);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+
+    for(i = 0; i < num_pages; i++) {
+        HDmemset(data, 0, page_size);
+        if(H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (haddr_t)i * page_size, page_size / 2, data) < 0)
+            FAIL_STACK_ERROR;
+        for(j = 0; j < page_elmts / 2; j++)
+            if(data[j] != i * page_elmts + j)
+                TEST_ERROR;
+    } /* end for */
+
+    if(H5Fset_page_buffer_size(file_id, page_size * 3, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == f->shared->page_buf || f->shared->page_buf->max_size != page_size * 3)
+        TEST_ERROR;
+    if(H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + page_size / 2, page_size / 2, data) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Reopen without page buffering and check the data made it */
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, orig_fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if(H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, page_size, data) < 0)
+        FAIL_STACK_ERROR;
+    for(j = 0; j < page_elmts / 2; j++)
+        if(data[j] != j || data[page_elmts / 2 + j] != 9 * page_elmts + j)
+            TEST_ERROR;
+    for(i = 1; i < num_pages; i++) {
+        if(H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (haddr_t)i * page_size, page_size / 2, data) < 0)
+            FAIL_STACK_ERROR;
+        for(j = 0; j < page_elmts / 2; j++)
+            if(data[j] != i * page_elmts + j)
+                TEST_ERROR;
+    } /* end for */
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(data);
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if(data)
+            HDfree(data);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_resize */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_preload()
+ *
+ * Purpose:     Check that opening a file with page buffer preloading
+ *              loads the file's pages into the page buffer, up to its
+ *              size, and that traversing the file's metadata afterwards
+ *              doesn't miss.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_preload(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char filename[FILENAME_LEN]; /* Filename to use */
+    char name[32];               /* Group name */
+    hid_t file_id = -1;          /* File ID */
+    hid_t fcpl = -1;
+    hid_t fapl = -1;
+    hid_t gid = -1;
+    int i;
+    int num_groups = 50;
+    size_t page_size = 512;
+    hsize_t file_size = 0;
+    size_t file_pages;
+    hbool_t preload = TRUE;
+    H5G_info_t ginfo;
+    H5F_t *f = NULL;
+
+    TESTING("Preloading the page buffer on open");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR
+
+    if(set_multi_split(env_h5_drvr, fapl, (hsize_t)page_size) != 0)
+        TEST_ERROR;
+
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+    if(H5Pset_file_space_page_size(fcpl, (hsize_t)page_size) < 0)
+        TEST_ERROR;
+
+    /* Create a file with some metadata in it */
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    for(i = 0; i < num_groups; i++) {
+        HDsprintf(name, "group%03d", i);
+        if((gid = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR;
+        if(H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Fget_filesize(file_id, &file_size) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    file_pages = (size_t)((file_size + page_size - 1) / page_size);
+    if(file_pages < 8)
+        TEST_ERROR;
+
+    /* Preloading is off by default */
+    if(H5Pget_page_buffer_preload(fapl, &preload) < 0)
+        FAIL_STACK_ERROR;
+    if(preload)
+        TEST_ERROR;
+    if(H5Pset_page_buffer_preload(fapl, TRUE) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pget_page_buffer_preload(fapl, &preload) < 0)
+        FAIL_STACK_ERROR;
+    if(!preload)
+        TEST_ERROR;
+
+    /* Without a page buffer, preloading is ignored */
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* With a page buffer large enough for the file, every page is loaded */
+    if(H5Pset_page_buffer_size(fapl, page_size * (file_pages + 10), 0, 0) < 0)
+        TEST_ERROR;
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+    if(f->shared->page_buf->prefetches[0] != file_pages)
+        TEST_ERROR;
+    if(f->shared->page_buf->meta_count + f->shared->page_buf->raw_count != file_pages)
+        TEST_ERROR;
+
+    /* A full traversal of the metadata is served from memory */
+    if(H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+    for(i = 0; i < num_groups; i++) {
+        HDsprintf(name, "group%03d", i);
+        if((gid = H5Gopen2(file_id, name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR;
+        if(H5Gget_info(gid, &ginfo) < 0)
+            FAIL_STACK_ERROR;
+        if(ginfo.nlinks != 0)
+            TEST_ERROR;
+        if(H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+    if(f->shared->page_buf->misses[0] != 0)
+        TEST_ERROR;
+    if(f->shared->page_buf->hits[0] == 0)
+        TEST_ERROR;
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* With a smaller page buffer, preloading stops when it is full */
+    if(H5Pset_page_buffer_size(fapl, page_size * 4, 0, 0) < 0)
+        TEST_ERROR;
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+    if(f->shared->page_buf->prefetches[0] != 4)
+        TEST_ERROR;
+    if(f->shared->page_buf->meta_count + f->shared->page_buf->raw_count > 4)
+        TEST_ERROR;
+    if((gid = H5Gopen2(file_id, "group000", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_preload */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    visit_count_cb()
+ *
+ * Purpose:     H5Lvisit callback that counts the links visited.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+visit_count_cb(hid_t H5_ATTR_UNUSED group, const char H5_ATTR_UNUSED *name,
+    const H5L_info_t H5_ATTR_UNUSED *info, void *op_data)
+{
+    (*(unsigned *)op_data)++;
+
+    return 0;
+} /* visit_count_cb */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    visit_obj_count_cb()
+ *
+ * Purpose:     H5Ovisit callback that counts the objects visited.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+visit_obj_count_cb(hid_t H5_ATTR_UNUSED obj, const char H5_ATTR_UNUSED *name,
+    const H5O_info_t H5_ATTR_UNUSED *info, void *op_data)
+{
+    (*(unsigned *)op_data)++;
+
+    return 0;
+} /* visit_obj_count_cb */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_visit_prefetch()
+ *
+ * Purpose:     Check that visiting the links of a file with a page buffer
+ *              prefetches the pages of each group's object headers, and
+ *              that every link is still visited.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_visit_prefetch(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char filename[FILENAME_LEN]; /* Filename to use */
+    char name[32];               /* Group name */
+    hid_t file_id = -1;          /* File ID */
+    hid_t fcpl = -1;
+    hid_t fapl = -1;
+    hid_t gid = -1;
+    hid_t gid2 = -1;
+    int i, j;
+    int num_groups = 50;
+    int num_subgroups = 4;
+    size_t page_size = 512;
+    unsigned count;
+    H5F_t *f = NULL;
+
+    TESTING("Prefetching object headers when visiting links");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR
+
+    if(set_multi_split(env_h5_drvr, fapl, (hsize_t)page_size) != 0)
+        TEST_ERROR;
+
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+    if(H5Pset_file_space_page_size(fcpl, (hsize_t)page_size) < 0)
+        TEST_ERROR;
+
+    /* Create a file with groups, every other one with subgroups */
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    for(i = 0; i < num_groups; i++) {
+        HDsprintf(name, "group%03d", i);
+        if((gid = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR;
+        if(i % 2)
+            for(j = 0; j < num_subgroups; j++) {
+                HDsprintf(name, "sub%03d", j);
+                if((gid2 = H5Gcreate2(gid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                    FAIL_STACK_ERROR;
+                if(H5Gclose(gid2) < 0)
+                    FAIL_STACK_ERROR;
+            } /* end for */
+        if(H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Without a page buffer, nothing is prefetched but all links are visited */
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    count = 0;
+    if(H5Lvisit(file_id, H5_INDEX_NAME, H5_ITER_INC, visit_count_cb, &count) < 0)
+        FAIL_STACK_ERROR;
+    if(count != (unsigned)(num_groups + (num_groups / 2) * num_subgroups))
+        TEST_ERROR;
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* With a page buffer, the group's object header pages are prefetched */
+    if(H5Pset_page_buffer_size(fapl, page_size * 1000, 0, 0) < 0)
+        TEST_ERROR;
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+    if(H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+    count = 0;
+    if(H5Lvisit(file_id, H5_INDEX_NAME, H5_ITER_INC, visit_count_cb, &count) < 0)
+        FAIL_STACK_ERROR;
+    if(count != (unsigned)(num_groups + (num_groups / 2) * num_subgroups))
+        TEST_ERROR;
+    if(f->shared->page_buf->prefetches[0] == 0)
+        TEST_ERROR;
+
+    /* A second visit finds every object header in memory */
+    if(H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+    count = 0;
+    if(H5Ovisit(file_id, H5_INDEX_NAME, H5_ITER_INC, visit_obj_count_cb, &count) < 0)
+        FAIL_STACK_ERROR;
+    if(count != (unsigned)(1 + num_groups + (num_groups / 2) * num_subgroups))
+        TEST_ERROR;
+    if(f->shared->page_buf->prefetches[0] != 0)
+        TEST_ERROR;
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid2);
+        H5Gclose(gid);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_visit_prefetch */
+
+
 /*-------------------------------------------------------------------------
  * Function:    verify_page_buffering_disabled()
  *
@@ -2179,6 +2901,10 @@ main(void)
     nerrors += test_lru_processing(fapl, env_h5_drvr);
     nerrors += test_min_threshold(fapl, env_h5_drvr);
     nerrors += test_stats_collection(fapl, env_h5_drvr);
+    nerrors += test_readahead(fapl, env_h5_drvr);
+    nerrors += test_resize(fapl, env_h5_drvr);
+    nerrors += test_preload(fapl, env_h5_drvr);
+    nerrors += test_visit_prefetch(fapl, env_h5_drvr);
 
 #endif /* H5_HAVE_PARALLEL */
 
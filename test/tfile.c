@@ -1436,6 +1436,7 @@ test_obj_count_and_id(hid_t fid1, hid_t fid2, hid_t did, hid_t gid1,
                     case H5I_ERROR_CLASS:
                     case H5I_ERROR_MSG:
                     case H5I_ERROR_STACK:
+                    case H5I_DATASET_PLAN:
                     case H5I_NTYPES:
                     default:
                         ERROR("H5Fget_obj_ids");
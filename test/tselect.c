@@ -167,6 +167,25 @@
 #define SPACE13_DIM3    50
 #define SPACE13_NPOINTS 4
 
+/* Information for hyperslab list test */
+#define SPACE14_RANK	2
+#define SPACE14_DIM1    40
+#define SPACE14_DIM2    50
+#define SPACE14_NSLABS  40
+#define SPACE14_NTESTS  20
+
+/* Information for out of order point selection test */
+#define SPACE15_RANK	2
+#define SPACE15_DIM1    30
+#define SPACE15_DIM2    40
+#define SPACE15_NPOINTS 300
+#define SPACE15_NPOINTS_LARGE   20000   /* More than are sorted at once */
+
+/* Information for irregular hyperslab iteration test */
+#define SPACE16_RANK	2
+#define SPACE16_DIM1    12
+#define SPACE16_DIM2    16
+
 
 /* Location comparison function */
 static int compare_size_t(const void *s1, const void *s2);
@@ -653,6 +672,151 @@ test_select_point(hid_t xfer_plist)
     HDfree(rbuf);
 }   /* test_select_point() */
 
+/****************************************************************
+**
+**  test_select_point_unsorted(): Test I/O with element selections
+**      of NPOINTS points which are not in 'C' array order in the
+**      file, and which select some elements more than once.
+**
+****************************************************************/
+static void
+test_select_point_unsorted(hid_t xfer_plist, size_t npoints)
+{
+    hid_t       fid;            /* HDF5 File ID */
+    hid_t       dataset;        /* Dataset ID */
+    hid_t       dcpl;           /* Dataset creation property list */
+    hid_t       sid1, sid2;     /* Dataspace IDs */
+    hsize_t     dims1[] = {SPACE15_DIM1, SPACE15_DIM2};
+    hsize_t     dims2[1];
+    hsize_t     chunk_dims[] = {7, 9};
+    hsize_t    (*coord)[SPACE15_RANK];  /* Coordinates for point selection */
+    int        *wbuf;           /* Data written to dataset */
+    int        *rbuf;           /* Data read from dataset */
+    int        *pbuf;           /* Data for points */
+    int         last[SPACE15_DIM1 * SPACE15_DIM2];  /* Last point written to each element */
+    unsigned    layout;         /* Dataset layout to test */
+    size_t      u;              /* Local index variable */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Element Selections Out of Order\n"));
+
+    dims2[0] = npoints;
+    wbuf = (int *)HDmalloc(sizeof(int) * SPACE15_DIM1 * SPACE15_DIM2);
+    CHECK(wbuf, NULL, "HDmalloc");
+    rbuf = (int *)HDmalloc(sizeof(int) * MAX(npoints, SPACE15_DIM1 * SPACE15_DIM2));
+    CHECK(rbuf, NULL, "HDmalloc");
+    coord = (hsize_t (*)[SPACE15_RANK])HDmalloc(sizeof(hsize_t) * SPACE15_RANK * npoints);
+    CHECK(coord, NULL, "HDmalloc");
+    pbuf = (int *)HDmalloc(sizeof(int) * npoints);
+    CHECK(pbuf, NULL, "HDmalloc");
+
+    /* Select points scattered through the dataset, out of order, with
+     * runs of neighboring points and with some points selected twice
+     */
+    for(u = 0; u < npoints; u++) {
+        size_t off;
+
+        if(u % 10 < 4)
+            off = ((npoints - u) * 7) % (SPACE15_DIM1 * SPACE15_DIM2);
+        else if(u % 10 < 8)
+            off = ((u * 37) + 5) % (SPACE15_DIM1 * SPACE15_DIM2);
+        else
+            off = (((u - 8) * 37) + 5) % (SPACE15_DIM1 * SPACE15_DIM2);
+        coord[u][0] = off / SPACE15_DIM2;
+        coord[u][1] = off % SPACE15_DIM2;
+        pbuf[u] = (int)u + 1;
+    } /* end for */
+
+    /* Work out which point is written last to each element */
+    for(u = 0; u < SPACE15_DIM1 * SPACE15_DIM2; u++) {
+        wbuf[u] = -(int)u;
+        last[u] = wbuf[u];
+    } /* end for */
+    for(u = 0; u < npoints; u++)
+        last[(coord[u][0] * SPACE15_DIM2) + coord[u][1]] = pbuf[u];
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    sid1 = H5Screate_simple(SPACE15_RANK, dims1, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+    sid2 = H5Screate_simple(1, dims2, NULL);
+    CHECK(sid2, FAIL, "H5Screate_simple");
+
+    /* Try contiguous, chunked and compact datasets */
+    for(layout = 0; layout < 3; layout++) {
+        char dset_name[16];
+
+        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+        CHECK(dcpl, FAIL, "H5Pcreate");
+        if(layout == 1) {
+            ret = H5Pset_chunk(dcpl, SPACE15_RANK, chunk_dims);
+            CHECK(ret, FAIL, "H5Pset_chunk");
+        } /* end if */
+        else if(layout == 2) {
+            ret = H5Pset_layout(dcpl, H5D_COMPACT);
+            CHECK(ret, FAIL, "H5Pset_layout");
+        } /* end if */
+
+        HDsprintf(dset_name, "unsorted%u", layout);
+        dataset = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid1, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        CHECK(dataset, FAIL, "H5Dcreate2");
+
+        ret = H5Sselect_all(sid1);
+        CHECK(ret, FAIL, "H5Sselect_all");
+        ret = H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, xfer_plist, wbuf);
+        CHECK(ret, FAIL, "H5Dwrite");
+
+        /* Read the points, which should come back in the order selected */
+        ret = H5Sselect_elements(sid1, H5S_SELECT_SET, npoints, (const hsize_t *)coord);
+        CHECK(ret, FAIL, "H5Sselect_elements");
+        HDmemset(rbuf, 0, sizeof(int) * npoints);
+        ret = H5Dread(dataset, H5T_NATIVE_INT, sid2, sid1, xfer_plist, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+        for(u = 0; u < npoints; u++)
+            if(rbuf[u] != wbuf[(coord[u][0] * SPACE15_DIM2) + coord[u][1]])
+                TestErrPrintf("Line %d: wrong value read for point %u, layout %u\n", __LINE__, (unsigned)u, layout);
+
+        /* Write the points, the last point written to an element wins */
+        ret = H5Dwrite(dataset, H5T_NATIVE_INT, sid2, sid1, xfer_plist, pbuf);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, xfer_plist, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+        for(u = 0; u < SPACE15_DIM1 * SPACE15_DIM2; u++)
+            if(rbuf[u] != last[u])
+                TestErrPrintf("Line %d: wrong value for element %u, layout %u\n", __LINE__, (unsigned)u, layout);
+
+        /* Read the points into the same elements of a dataset-sized buffer */
+        HDmemset(rbuf, 0, sizeof(int) * SPACE15_DIM1 * SPACE15_DIM2);
+        ret = H5Dread(dataset, H5T_NATIVE_INT, sid1, sid1, xfer_plist, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+        for(u = 0; u < npoints; u++) {
+            size_t off = (coord[u][0] * SPACE15_DIM2) + coord[u][1];
+
+            if(rbuf[off] != last[off])
+                TestErrPrintf("Line %d: wrong value read for point %u, layout %u\n", __LINE__, (unsigned)u, layout);
+        } /* end for */
+
+        ret = H5Dclose(dataset);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Pclose(dcpl);
+        CHECK(ret, FAIL, "H5Pclose");
+    } /* end for */
+
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid2);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(coord);
+    HDfree(pbuf);
+}   /* test_select_point_unsorted() */
+
 /****************************************************************
 **
 **  test_select_all_iter1(): Iterator for checking all iteration
@@ -13659,6 +13823,322 @@ test_hyper_unlim(void)
     CHECK(ret, FAIL, "H5Sclose");
 } /* end test_hyper_unlim() */
 
+/****************************************************************
+**
+**  test_hyper_list_mark(): Mark the elements selected in a
+**      SPACE14 dataspace in a buffer.
+**
+****************************************************************/
+static void
+test_hyper_list_mark(hid_t sid, uint8_t *buf)
+{
+    uint8_t     one = 1;        /* Value for selected elements */
+    herr_t      ret;            /* Generic return value */
+
+    HDmemset(buf, 0, SPACE14_DIM1 * SPACE14_DIM2);
+    ret = H5Dfill(&one, H5T_NATIVE_UCHAR, buf, H5T_NATIVE_UCHAR, sid);
+    CHECK(ret, FAIL, "H5Dfill");
+} /* end test_hyper_list_mark() */
+
+/****************************************************************
+**
+**  test_hyper_list(): Tests selecting a list of hyperslabs with
+**      H5Sselect_hyperslab_list()
+**
+****************************************************************/
+static void
+test_hyper_list(void)
+{
+    hsize_t     dims[SPACE14_RANK] = {SPACE14_DIM1, SPACE14_DIM2};
+    hsize_t     start[SPACE14_NSLABS][SPACE14_RANK];    /* Hyperslab list */
+    hsize_t     stride[SPACE14_NSLABS][SPACE14_RANK];
+    hsize_t     count[SPACE14_NSLABS][SPACE14_RANK];
+    hsize_t     block[SPACE14_NSLABS][SPACE14_RANK];
+    hsize_t     base_start[SPACE14_RANK] = {5, 7};      /* Existing selection */
+    hsize_t     base_count[SPACE14_RANK] = {20, 31};
+    H5S_seloper_t ops[] = {H5S_SELECT_OR, H5S_SELECT_AND, H5S_SELECT_XOR,
+                    H5S_SELECT_NOTB, H5S_SELECT_NOTA};
+    uint8_t    *union_buf;      /* Elements in union of hyperslab list */
+    uint8_t    *base_buf;       /* Elements in existing selection */
+    uint8_t    *list_buf;       /* Elements selected with hyperslab list */
+    uint8_t    *ref_buf;        /* Expected elements */
+    hid_t       sid, ref_sid;   /* Dataspace IDs */
+    hssize_t    npoints;        /* Number of elements selected */
+    htri_t      is_regular;     /* Whether selection is regular */
+    unsigned    seed;           /* Random # seed */
+    unsigned    test_num;       /* Random test iteration */
+    size_t      n, u, v;        /* Local index variables */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Hyperslab List Selections\n"));
+
+    union_buf = (uint8_t *)HDmalloc(SPACE14_DIM1 * SPACE14_DIM2);
+    CHECK(union_buf, NULL, "HDmalloc");
+    base_buf = (uint8_t *)HDmalloc(SPACE14_DIM1 * SPACE14_DIM2);
+    CHECK(base_buf, NULL, "HDmalloc");
+    list_buf = (uint8_t *)HDmalloc(SPACE14_DIM1 * SPACE14_DIM2);
+    CHECK(list_buf, NULL, "HDmalloc");
+    ref_buf = (uint8_t *)HDmalloc(SPACE14_DIM1 * SPACE14_DIM2);
+    CHECK(ref_buf, NULL, "HDmalloc");
+
+    sid = H5Screate_simple(SPACE14_RANK, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    ref_sid = H5Screate_simple(SPACE14_RANK, dims, NULL);
+    CHECK(ref_sid, FAIL, "H5Screate_simple");
+
+    /* Get initial random # seed */
+    seed = (unsigned)HDtime(NULL) + (unsigned)HDclock();
+
+    for(test_num = 0; test_num < SPACE14_NTESTS; test_num++) {
+        /* Generate a list of random, overlapping, strided hyperslabs */
+        seed += (unsigned)HDclock();
+        HDsrandom(seed);
+        for(n = 0; n < SPACE14_NSLABS; n++)
+            for(u = 0; u < SPACE14_RANK; u++) {
+                start[n][u] = (hsize_t)HDrandom() % dims[u];
+                block[n][u] = ((hsize_t)HDrandom() % 4) + 1;
+                stride[n][u] = block[n][u] + ((hsize_t)HDrandom() % 3);
+                count[n][u] = ((dims[u] - start[n][u]) / stride[n][u]) + 1;
+                count[n][u] = ((hsize_t)HDrandom() % count[n][u]) + 1;
+                if(start[n][u] + ((count[n][u] - 1) * stride[n][u]) + block[n][u] > dims[u])
+                    count[n][u]--;
+
+                /* Keep the hyperslab in the extent */
+                if(count[n][u] == 0) {
+                    start[n][u] = 0;
+                    count[n][u] = 1;
+                } /* end if */
+            } /* end for */
+
+        /* Select the hyperslabs one at a time */
+        ret = H5Sselect_hyperslab(ref_sid, H5S_SELECT_SET, start[0], stride[0], count[0], block[0]);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        for(n = 1; n < SPACE14_NSLABS; n++) {
+            ret = H5Sselect_hyperslab(ref_sid, H5S_SELECT_OR, start[n], stride[n], count[n], block[n]);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        } /* end for */
+        test_hyper_list_mark(ref_sid, union_buf);
+
+        /* Select the hyperslabs as a list */
+        ret = H5Sselect_hyperslab_list(sid, H5S_SELECT_SET, (size_t)SPACE14_NSLABS, &start[0][0], &stride[0][0], &count[0][0], &block[0][0]);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab_list");
+        VERIFY(H5Sget_select_npoints(sid), H5Sget_select_npoints(ref_sid), "H5Sget_select_npoints");
+        test_hyper_list_mark(sid, list_buf);
+        if(HDmemcmp(list_buf, union_buf, SPACE14_DIM1 * SPACE14_DIM2))
+            TestErrPrintf("hyperslab list selection doesn't match! seed=%u, Line=%d\n", seed, __LINE__);
+
+        /* Combine the list with an existing selection */
+        for(v = 0; v < NELMTS(ops); v++) {
+            ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, base_start, NULL, base_count, NULL);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+            test_hyper_list_mark(sid, base_buf);
+
+            ret = H5Sselect_hyperslab_list(sid, ops[v], (size_t)SPACE14_NSLABS, &start[0][0], &stride[0][0], &count[0][0], &block[0][0]);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab_list");
+            test_hyper_list_mark(sid, list_buf);
+
+            for(u = 0; u < SPACE14_DIM1 * SPACE14_DIM2; u++)
+                switch(ops[v]) {
+                    case H5S_SELECT_OR:
+                        ref_buf[u] = (uint8_t)(base_buf[u] | union_buf[u]);
+                        break;
+                    case H5S_SELECT_AND:
+                        ref_buf[u] = (uint8_t)(base_buf[u] & union_buf[u]);
+                        break;
+                    case H5S_SELECT_XOR:
+                        ref_buf[u] = (uint8_t)(base_buf[u] ^ union_buf[u]);
+                        break;
+                    case H5S_SELECT_NOTB:
+                        ref_buf[u] = (uint8_t)(base_buf[u] & !union_buf[u]);
+                        break;
+                    case H5S_SELECT_NOTA:
+                    default:
+                        ref_buf[u] = (uint8_t)(!base_buf[u] & union_buf[u]);
+                        break;
+                } /* end switch */
+            if(HDmemcmp(list_buf, ref_buf, SPACE14_DIM1 * SPACE14_DIM2))
+                TestErrPrintf("hyperslab list selection doesn't match! seed=%u, op=%d, Line=%d\n", seed, (int)ops[v], __LINE__);
+        } /* end for */
+    } /* end for */
+
+    /* Adjacent blocks which form a single block give a regular selection */
+    start[0][0] = 2; start[0][1] = 3;
+    count[0][0] = 4; count[0][1] = 5;
+    start[1][0] = 6; start[1][1] = 3;
+    count[1][0] = 3; count[1][1] = 5;
+    ret = H5Sselect_hyperslab_list(sid, H5S_SELECT_SET, (size_t)2, &start[0][0], NULL, &count[0][0], NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab_list");
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, 35, "H5Sget_select_npoints");
+    is_regular = H5Sis_regular_hyperslab(sid);
+    VERIFY(is_regular, TRUE, "H5Sis_regular_hyperslab");
+
+    /* XOR with an "all" selection */
+    ret = H5Sselect_all(sid);
+    CHECK(ret, FAIL, "H5Sselect_all");
+    ret = H5Sselect_hyperslab_list(sid, H5S_SELECT_XOR, (size_t)2, &start[0][0], NULL, &count[0][0], NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab_list");
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, (SPACE14_DIM1 * SPACE14_DIM2) - 35, "H5Sget_select_npoints");
+
+    /* An empty list leaves an "or" selection alone, and empties a "set" */
+    ret = H5Sselect_hyperslab_list(sid, H5S_SELECT_OR, (size_t)0, NULL, NULL, NULL, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab_list");
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, (SPACE14_DIM1 * SPACE14_DIM2) - 35, "H5Sget_select_npoints");
+    ret = H5Sselect_hyperslab_list(sid, H5S_SELECT_SET, (size_t)0, NULL, NULL, NULL, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab_list");
+    VERIFY(H5Sget_select_type(sid), H5S_SEL_NONE, "H5Sget_select_type");
+
+    /* Overlapping blocks within a hyperslab are rejected */
+    stride[0][0] = 1; stride[0][1] = 1;
+    block[0][0] = 2; block[0][1] = 1;
+    H5E_BEGIN_TRY {
+        ret = H5Sselect_hyperslab_list(sid, H5S_SELECT_SET, (size_t)1, &start[0][0], &stride[0][0], &count[0][0], &block[0][0]);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_hyperslab_list");
+
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(ref_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    HDfree(union_buf);
+    HDfree(base_buf);
+    HDfree(list_buf);
+    HDfree(ref_buf);
+} /* end test_hyper_list() */
+
+/****************************************************************
+**
+**  test_hyper_iter_irreg_in_sel(): Check if an element is in the
+**      irregular selection used by test_hyper_iter_irreg().
+**
+****************************************************************/
+static hbool_t
+test_hyper_iter_irreg_in_sel(hssize_t i, hssize_t j)
+{
+    return((i >= 1 && i < 5 && j >= 1 && j < 7) || (i >= 3 && i < 6 && j >= 4 && j < 9));
+} /* end test_hyper_iter_irreg_in_sel() */
+
+/****************************************************************
+**
+**  test_hyper_iter_irreg(): Tests I/O with an irregular hyperslab
+**      selection whose spans change between I/O operations, and
+**      iterating over an empty hyperslab selection.
+**
+****************************************************************/
+static void
+test_hyper_iter_irreg(void)
+{
+    hid_t       fid;            /* HDF5 File ID */
+    hid_t       dataset;        /* Dataset ID */
+    hid_t       sid, mem_sid;   /* Dataspace IDs */
+    hsize_t     dims[SPACE16_RANK] = {SPACE16_DIM1, SPACE16_DIM2};
+    hsize_t     start1[SPACE16_RANK] = {1, 1};  /* Hyperslabs selected */
+    hsize_t     count1[SPACE16_RANK] = {4, 6};
+    hsize_t     start2[SPACE16_RANK] = {3, 4};
+    hsize_t     count2[SPACE16_RANK] = {3, 5};
+    hssize_t    offset[SPACE16_RANK] = {3, 5};  /* Offset of selection */
+    hssize_t    zero_offset[SPACE16_RANK] = {0, 0};
+    hsize_t     npoints;        /* Number of elements selected */
+    int         wbuf[SPACE16_DIM1 * SPACE16_DIM2];  /* Data written */
+    int         rbuf[SPACE16_DIM1 * SPACE16_DIM2];  /* Data read */
+    int         expect[SPACE16_DIM1 * SPACE16_DIM2];    /* Expected data */
+    int         fill = -1;      /* Fill value */
+    hssize_t    i, j;           /* Local index variables */
+    unsigned    u, v;           /* Local index variables */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing I/O with Irregular Hyperslab Selections which Change\n"));
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(SPACE16_RANK, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dataset = H5Dcreate2(fid, "irregular", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+
+    /* Select two overlapping blocks */
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start1, NULL, count1, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start2, NULL, count2, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    npoints = (hsize_t)H5Sget_select_npoints(sid);
+    VERIFY(npoints, 33, "H5Sget_select_npoints");
+    mem_sid = H5Screate_simple(1, &npoints, NULL);
+    CHECK(mem_sid, FAIL, "H5Screate_simple");
+
+    /* Write the selection, then write it again with the selection moved,
+     * which changes the span tree for the I/O
+     */
+    for(u = 0; u < npoints; u++)
+        wbuf[u] = (int)u + 1;
+    ret = H5Dwrite(dataset, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+    for(u = 0; u < npoints; u++)
+        wbuf[u] = (int)u + 1001;
+    ret = H5Dwrite(dataset, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Soffset_simple(sid, zero_offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+
+    /* Work out what the dataset should contain */
+    for(i = 0, u = 0, v = 0; i < SPACE16_DIM1; i++)
+        for(j = 0; j < SPACE16_DIM2; j++) {
+            expect[(i * SPACE16_DIM2) + j] = 0;
+            if(test_hyper_iter_irreg_in_sel(i, j))
+                expect[(i * SPACE16_DIM2) + j] = (int)u++ + 1;
+            if(test_hyper_iter_irreg_in_sel(i - offset[0], j - offset[1]))
+                expect[(i * SPACE16_DIM2) + j] = (int)v++ + 1001;
+        } /* end for */
+
+    ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    for(u = 0; u < SPACE16_DIM1 * SPACE16_DIM2; u++)
+        if(rbuf[u] != expect[u])
+            TestErrPrintf("Line %d: wrong value for element %u: %d, should be %d\n", __LINE__, u, rbuf[u], expect[u]);
+
+    /* Read the selection back in its original place */
+    ret = H5Dread(dataset, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    for(i = 0, u = 0; i < SPACE16_DIM1; i++)
+        for(j = 0; j < SPACE16_DIM2; j++)
+            if(test_hyper_iter_irreg_in_sel(i, j)) {
+                if(rbuf[u] != expect[(i * SPACE16_DIM2) + j])
+                    TestErrPrintf("Line %d: wrong value for point %u: %d, should be %d\n", __LINE__, u, rbuf[u], expect[(i * SPACE16_DIM2) + j]);
+                u++;
+            } /* end if */
+
+    /* Remove both blocks, leaving an empty hyperslab selection */
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_NOTB, start1, NULL, count1, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_NOTB, start2, NULL, count2, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    VERIFY(H5Sget_select_type(sid), H5S_SEL_HYPERSLABS, "H5Sget_select_type");
+    VERIFY(H5Sget_select_npoints(sid), 0, "H5Sget_select_npoints");
+
+    /* Iterating over the empty selection doesn't touch anything */
+    HDmemcpy(rbuf, expect, sizeof(rbuf));
+    ret = H5Dfill(&fill, H5T_NATIVE_INT, rbuf, H5T_NATIVE_INT, sid);
+    CHECK(ret, FAIL, "H5Dfill");
+    if(HDmemcmp(rbuf, expect, sizeof(rbuf)))
+        TestErrPrintf("Line %d: filling empty selection changed buffer\n", __LINE__);
+
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Sclose(mem_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* end test_hyper_iter_irreg() */
+
 /****************************************************************
 **
 **  test_select(): Main H5S selection testing routine.
@@ -13692,6 +14172,9 @@ test_select(void)
     test_select_hyper(plist_id);        /* Test basic H5S hyperslab selection code */
     test_select_point(H5P_DEFAULT);     /* Test basic H5S element selection code, also tests appending to existing element selections */
     test_select_point(plist_id);        /* Test basic H5S element selection code, also tests appending to existing element selections */
+    test_select_point_unsorted(H5P_DEFAULT, (size_t)SPACE15_NPOINTS);   /* Test I/O with element selections out of order */
+    test_select_point_unsorted(plist_id, (size_t)SPACE15_NPOINTS);      /* Test I/O with element selections out of order */
+    test_select_point_unsorted(H5P_DEFAULT, (size_t)SPACE15_NPOINTS_LARGE); /* Test I/O with large element selections out of order */
     test_select_all(H5P_DEFAULT);       /* Test basic all & none selection code */
     test_select_all(plist_id);          /* Test basic all & none selection code */
     test_select_all_hyper(H5P_DEFAULT);       /* Test basic all & none selection code */
@@ -13826,6 +14309,10 @@ test_select(void)
     /* Test unlimited hyperslab selections */
     test_hyper_unlim();
 
+    /* Test selecting lists of hyperslabs */
+    test_hyper_list();
+    test_hyper_iter_irreg();
+
 }   /* test_select() */
 
 
@@ -0,0 +1,183 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Stress test of ID management and independent files across threads
+ * ------------------------------------------------------------------
+ *
+ * Each thread creates its own file and repeatedly creates, writes,
+ * re-opens and closes datasets in it, while also registering and
+ * removing IDs in an application ID type shared by all threads.  This
+ * checks that ID bookkeeping stays consistent when many threads hand
+ * out and release IDs at once.
+ *
+ * Temporary files generated:
+ *   ttsafe_ids<N>.h5
+ *
+ * HDF5 APIs exercised in thread:
+ * H5Fcreate, H5Fclose, H5Screate_simple, H5Dcreate2, H5Dopen2, H5Dwrite,
+ * H5Dread, H5Dclose, H5Sclose, H5Iregister, H5Iobject_verify,
+ * H5Iremove_verify, H5Iget_type, H5Iis_valid, H5Iinc_ref, H5Idec_ref.
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME_FMT            "ttsafe_ids%d.h5"
+#define NUM_THREAD              8
+#define NUM_ITER                64
+#define NAME_LEN                32
+
+void *tts_ids_worker(void *);
+
+typedef struct ids_thread_info {
+    int id;                     /* Thread index */
+    H5I_type_t app_type;        /* Shared application ID type */
+    int nerrors;                /* Number of failures seen by the thread */
+} ids_thread_info;
+
+static ids_thread_info ids_thread_out[NUM_THREAD];
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent ID management on independent files
+ **********************************************************************
+ */
+void tts_ids(void)
+{
+    H5TS_thread_t threads[NUM_THREAD];
+    H5TS_attr_t attribute;
+    H5I_type_t app_type;
+    hsize_t nmembers;
+    herr_t ret;
+    int i;
+
+    /* set pthread attribute to perform global scheduling */
+    H5TS_attr_init(&attribute);
+
+    /* set thread scope to system */
+#ifdef H5_HAVE_SYSTEM_SCOPE_THREADS
+    H5TS_attr_setscope(&attribute, H5TS_SCOPE_SYSTEM);
+#endif /* H5_HAVE_SYSTEM_SCOPE_THREADS */
+
+    /* Application ID type shared by all the threads */
+    app_type = H5Iregister_type((size_t)0, 0, NULL);
+    assert(app_type != H5I_BADID);
+
+    for(i = 0; i < NUM_THREAD; i++) {
+        ids_thread_out[i].id = i;
+        ids_thread_out[i].app_type = app_type;
+        ids_thread_out[i].nerrors = 0;
+        threads[i] = H5TS_create_thread(tts_ids_worker, &attribute, &ids_thread_out[i]);
+    } /* end for */
+
+    for(i = 0; i < NUM_THREAD; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    for(i = 0; i < NUM_THREAD; i++)
+        if(ids_thread_out[i].nerrors)
+            TestErrPrintf("Thread %d saw %d ID failures - test failed\n", i, ids_thread_out[i].nerrors);
+
+    /* Every ID registered by the threads must have been removed again */
+    ret = H5Inmembers(app_type, &nmembers);
+    assert(ret >= 0);
+    if(nmembers != 0)
+        TestErrPrintf("%llu IDs left in shared type - test failed\n", (unsigned long long)nmembers);
+
+    ret = H5Idestroy_type(app_type);
+    assert(ret >= 0);
+
+    /* Destroy the thread attribute */
+    H5TS_attr_destroy(&attribute);
+} /* end tts_ids() */
+
+void *tts_ids_worker(void *_thread_data)
+{
+    ids_thread_info *thread_data = (ids_thread_info *)_thread_data;
+    char filename[NAME_LEN];
+    char dsetname[NAME_LEN];
+    hid_t file, space, dset, app_id;
+    hsize_t dims[1] = {1};
+    int value, rvalue;
+    int u;
+    herr_t ret;
+
+    HDsnprintf(filename, sizeof(filename), FILENAME_FMT, thread_data->id);
+    file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    assert(file >= 0);
+
+    space = H5Screate_simple(1, dims, NULL);
+    assert(space >= 0);
+
+    for(u = 0; u < NUM_ITER; u++) {
+        HDsnprintf(dsetname, sizeof(dsetname), "dset%d", u);
+        value = (thread_data->id * NUM_ITER) + u;
+
+        /* Register an ID in the shared type, pointing at this thread's data */
+        app_id = H5Iregister(thread_data->app_type, thread_data);
+        if(app_id < 0 || H5Iget_type(app_id) != thread_data->app_type)
+            thread_data->nerrors++;
+
+        /* Create & write a dataset in this thread's own file */
+        dset = H5Dcreate2(file, dsetname, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        assert(dset >= 0);
+        ret = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &value);
+        assert(ret >= 0);
+
+        /* Take & drop an extra reference on the dataset ID */
+        if(H5Iinc_ref(dset) != 2 || H5Idec_ref(dset) != 1)
+            thread_data->nerrors++;
+        ret = H5Dclose(dset);
+        assert(ret >= 0);
+        if(H5Iis_valid(dset) > 0)
+            thread_data->nerrors++;
+
+        /* Re-open the dataset & verify its contents */
+        dset = H5Dopen2(file, dsetname, H5P_DEFAULT);
+        assert(dset >= 0);
+        ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rvalue);
+        assert(ret >= 0);
+        if(rvalue != value)
+            thread_data->nerrors++;
+        ret = H5Dclose(dset);
+        assert(ret >= 0);
+
+        /* The shared ID must still map to this thread's object */
+        if(H5Iobject_verify(app_id, thread_data->app_type) != thread_data)
+            thread_data->nerrors++;
+        if(H5Iremove_verify(app_id, thread_data->app_type) != thread_data)
+            thread_data->nerrors++;
+    } /* end for */
+
+    ret = H5Sclose(space);
+    assert(ret >= 0);
+    ret = H5Fclose(file);
+    assert(ret >= 0);
+
+    return NULL;
+} /* end tts_ids_worker() */
+
+void cleanup_ids(void)
+{
+    char filename[NAME_LEN];
+    int i;
+
+    for(i = 0; i < NUM_THREAD; i++) {
+        HDsnprintf(filename, sizeof(filename), FILENAME_FMT, i);
+        HDunlink(filename);
+    } /* end for */
+} /* end cleanup_ids() */
+#endif /*H5_HAVE_THREADSAFE*/
+
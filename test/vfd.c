@@ -26,6 +26,12 @@
 #define FAMILY_SIZE2    (5*KB)
 #define MULTI_SIZE      128
 
+/* Macros for striped family tests */
+#define STRIPE_SIZE     (2*KB)
+#define STRIPE_COUNT    3
+#define STRIPE_NBYTES   (5 * STRIPE_COUNT * STRIPE_SIZE + 700)
+#define STRIPE_DSET_DIM (16*KB)
+
 #define CORE_INCREMENT  (4*KB)
 #define CORE_PAGE_SIZE  (1024*KB)
 #define CORE_DSET_NAME  "core dset"
@@ -37,6 +43,27 @@
 #define DSET1_DIM2   32
 #define DSET3_NAME   "dset3"
 
+/* Macros for mmap VFD */
+#define MMAP_DSET1_NAME "mmap dset1"
+#define MMAP_DSET2_NAME "mmap dset2"
+#define MMAP_DSET_DIM   4096
+
+/* Macros for io_uring VFD */
+#define IOURING_DSET_NAME   "iouring dset"
+#define IOURING_DSET_DIM    (64 * 1024)
+#define IOURING_NPOINTS     1024
+#define IOURING_OVL_NPIECES 48
+#define IOURING_OVL_SIZE    (4 * 4096)
+#define IOURING_OVL_MAXLEN  5000
+
+/* Macros for vector I/O tests */
+#define VEC_NPIECES     64
+#define VEC_PIECE_SIZE  16
+#define VEC_RUN         4
+#define VEC_DSET_NAME   "vector dset"
+#define VEC_DSET_DIM    4096
+#define VEC_NPOINTS     512
+
 /* Macros for Direct VFD */
 #ifdef H5_HAVE_DIRECT
 #define MBOUNDARY    512
@@ -45,6 +72,8 @@
 #define THRESHOLD    1
 #define DSET2_NAME   "dset2"
 #define DSET2_DIM    4
+#define DIRECT_SPLIT_ADDR   (FBSIZE / 2)
+#define DIRECT_SPLIT_SIZE   (FBSIZE / 2 + 3 * FBSIZE + 100)
 #endif /* H5_HAVE_DIRECT */
 
 const char *FILENAME[] = {
@@ -58,6 +87,10 @@ const char *FILENAME[] = {
     "stdio_file",        /*7*/
     "windows_file",      /*8*/
     "new_multi_file_v16",/*9*/
+    "vector_file",       /*10*/
+    "mmap_file",         /*11*/
+    "iouring_file",      /*12*/
+    "family_stripe_file",/*13*/
     NULL
 };
 
@@ -554,6 +587,7 @@ test_direct(void)
 #ifdef H5_HAVE_DIRECT
     hid_t       file=-1, fapl=-1, access_fapl = -1;
     hid_t  dset1=-1, dset2=-1, space1=-1, space2=-1;
+    H5FD_t      *lf = NULL;
     char        filename[1024];
     int         *fhandle=NULL;
     hsize_t     file_size;
@@ -722,12 +756,64 @@ test_direct(void)
 
     HDfree(points);
     HDfree(check);
+    points = check = NULL;
 
     /* Close and delete the file */
     if(H5Fclose(file) < 0)
         TEST_ERROR;
     h5_delete_test_file(FILENAME[5], fapl);
 
+    /* Transfer a request whose ends are in partial file blocks, but whose
+     * whole blocks line up with an aligned part of the buffer, so the middle
+     * of it bypasses the copy buffer.
+     */
+    if(NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(0 != HDposix_memalign((void **)&points, (size_t)FBSIZE, (size_t)(DIRECT_SPLIT_SIZE + FBSIZE)))
+        TEST_ERROR;
+    if(0 != HDposix_memalign((void **)&check, (size_t)FBSIZE, (size_t)(DIRECT_SPLIT_SIZE + FBSIZE)))
+        TEST_ERROR;
+    for(i = 0; i < (int)((DIRECT_SPLIT_SIZE + FBSIZE) / sizeof(int)); i++)
+        points[i] = i;
+    if(H5FDset_eoa(lf, H5FD_MEM_DRAW, (haddr_t)(DIRECT_SPLIT_ADDR + DIRECT_SPLIT_SIZE + FBSIZE)) < 0)
+        TEST_ERROR;
+    if(H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)DIRECT_SPLIT_ADDR, (size_t)DIRECT_SPLIT_SIZE, points) < 0)
+        TEST_ERROR;
+
+    /* Read it back into a buffer with the same alignment... */
+    HDmemset(check, 0, (size_t)DIRECT_SPLIT_SIZE);
+    if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)DIRECT_SPLIT_ADDR, (size_t)DIRECT_SPLIT_SIZE, check) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(points, check, (size_t)DIRECT_SPLIT_SIZE))
+        TEST_ERROR;
+
+    /* ...and into one which can only go through the copy buffer */
+    HDmemset(check, 0, (size_t)(DIRECT_SPLIT_SIZE + FBSIZE));
+    if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)DIRECT_SPLIT_ADDR, (size_t)DIRECT_SPLIT_SIZE, (unsigned char *)check + 1) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(points, (unsigned char *)check + 1, (size_t)DIRECT_SPLIT_SIZE))
+        TEST_ERROR;
+
+    /* Overwrite part of it from a misaligned buffer and check the data
+     * around the overwritten part survived the read-modify-write.
+     */
+    if(H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(DIRECT_SPLIT_ADDR + FBSIZE), (size_t)FBSIZE, (unsigned char *)points + 1) < 0)
+        TEST_ERROR;
+    if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)DIRECT_SPLIT_ADDR, (size_t)DIRECT_SPLIT_SIZE, check) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(points, check, (size_t)FBSIZE)
+            || HDmemcmp((unsigned char *)points + 1, (unsigned char *)check + FBSIZE, (size_t)FBSIZE)
+            || HDmemcmp((unsigned char *)points + 2 * FBSIZE, (unsigned char *)check + 2 * FBSIZE, (size_t)(DIRECT_SPLIT_SIZE - 2 * FBSIZE)))
+        TEST_ERROR;
+
+    if(H5FDclose(lf) < 0)
+        TEST_ERROR;
+    lf = NULL;
+    h5_delete_test_file(FILENAME[5], fapl);
+
+    HDfree(points);
+    HDfree(check);
+
     /* Close the fapl */
     if(H5Pclose(fapl) < 0)
         TEST_ERROR;
@@ -743,6 +829,8 @@ error:
         H5Sclose(space2);
         H5Dclose(dset2);
         H5Fclose(file);
+        if(lf)
+            H5FDclose(lf);
     } H5E_END_TRY;
 
     if(points)
@@ -1112,6 +1200,218 @@ error:
 } /* end test_family_compat() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_family_stripe
+ *
+ * Purpose:     Tests the FAMILY driver with the address space striped
+ *              round-robin over the member files.  Checks that data
+ *              lands in the member and at the offset the stripe layout
+ *              says it should, and that a striped file can only be
+ *              reopened with the same layout.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_family_stripe(void)
+{
+    hid_t       fapl = -1, memb_fapl = -1, fapl2 = -1;
+    hid_t       file = -1, space = -1, dset = -1;
+    H5FD_t      *lf = NULL;
+    char        filename[1024], memb_name[1024];
+    unsigned char *wbuf = NULL, *rbuf = NULL;
+    int         *data = NULL, *check = NULL;
+    hsize_t     dims[1] = {STRIPE_DSET_DIM};
+    hsize_t     stripe_size;
+    unsigned    stripe_count;
+    haddr_t     a;
+    unsigned    u;
+
+    TESTING("FAMILY file driver with striping");
+
+    if(NULL == (wbuf = (unsigned char *)HDmalloc(STRIPE_NBYTES)))
+        TEST_ERROR
+    if(NULL == (rbuf = (unsigned char *)HDmalloc(STRIPE_NBYTES)))
+        TEST_ERROR
+    if(NULL == (data = (int *)HDmalloc(STRIPE_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (check = (int *)HDmalloc(STRIPE_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < STRIPE_NBYTES; u++)
+        wbuf[u] = (unsigned char)((u * 7) + (u / 251));
+    for(u = 0; u < STRIPE_DSET_DIM; u++)
+        data[u] = (int)u;
+
+    /* Set property list and file name for striped FAMILY driver */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_family(fapl, (hsize_t)FAMILY_SIZE, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_family_stripe(fapl, (hsize_t)STRIPE_SIZE, STRIPE_COUNT) < 0)
+        TEST_ERROR
+    if(H5Pget_fapl_family_stripe(fapl, &stripe_size, &stripe_count) < 0)
+        TEST_ERROR
+    if(stripe_size != STRIPE_SIZE || stripe_count != STRIPE_COUNT)
+        TEST_ERROR
+    h5_fixname(FILENAME[13], fapl, filename, sizeof(filename));
+
+    /* Write through the driver, in one piece and then in a piece that
+     * starts and ends in the middle of stripes */
+    if(NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        TEST_ERROR
+    if(H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)STRIPE_NBYTES) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, STRIPE_NBYTES);
+    if(H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)STRIPE_NBYTES, rbuf) < 0)
+        TEST_ERROR
+    if(H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(STRIPE_SIZE / 2), (size_t)(STRIPE_NBYTES - STRIPE_SIZE / 2), wbuf + STRIPE_SIZE / 2) < 0)
+        TEST_ERROR
+    if(H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)(STRIPE_SIZE / 2), wbuf) < 0)
+        TEST_ERROR
+
+    /* Read it back whole and in a piece crossing several stripes */
+    if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)STRIPE_NBYTES, rbuf) < 0)
+        TEST_ERROR
+    if(HDmemcmp(rbuf, wbuf, STRIPE_NBYTES))
+        TEST_ERROR
+    HDmemset(rbuf, 0, STRIPE_NBYTES);
+    if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(STRIPE_SIZE - 1), (size_t)(4 * STRIPE_SIZE + 3), rbuf) < 0)
+        TEST_ERROR
+    if(HDmemcmp(rbuf, wbuf + STRIPE_SIZE - 1, (size_t)(4 * STRIPE_SIZE + 3)))
+        TEST_ERROR
+    if(H5FDget_eof(lf, H5FD_MEM_DEFAULT) != (haddr_t)STRIPE_NBYTES)
+        TEST_ERROR
+    if(H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Check each member file holds its stripes, back to back */
+    if((memb_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_sec2(memb_fapl) < 0)
+        TEST_ERROR
+    for(u = 0; u < STRIPE_COUNT; u++) {
+        haddr_t memb_eof;
+
+        HDsnprintf(memb_name, sizeof(memb_name), filename, u);
+        if(NULL == (lf = H5FDopen(memb_name, H5F_ACC_RDONLY, memb_fapl, HADDR_UNDEF)))
+            TEST_ERROR
+        memb_eof = H5FDget_eof(lf, H5FD_MEM_DEFAULT);
+        if(memb_eof == 0 || memb_eof > STRIPE_NBYTES)
+            TEST_ERROR
+        if(H5FDset_eoa(lf, H5FD_MEM_DEFAULT, memb_eof) < 0)
+            TEST_ERROR
+        if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)memb_eof, rbuf) < 0)
+            TEST_ERROR
+        for(a = 0; a < memb_eof; a++) {
+            haddr_t row = a / STRIPE_SIZE;
+            haddr_t logical = (row * STRIPE_COUNT + u) * STRIPE_SIZE + a % STRIPE_SIZE;
+
+            if(logical >= STRIPE_NBYTES || rbuf[a] != wbuf[logical])
+                TEST_ERROR
+        } /* end for */
+        if(H5FDclose(lf) < 0)
+            TEST_ERROR
+        lf = NULL;
+    } /* end for */
+
+    /* There is no member past the last stripe */
+    HDsnprintf(memb_name, sizeof(memb_name), filename, STRIPE_COUNT);
+    H5E_BEGIN_TRY {
+        lf = H5FDopen(memb_name, H5F_ACC_RDONLY, memb_fapl, HADDR_UNDEF);
+    } H5E_END_TRY;
+    if(lf)
+        TEST_ERROR
+
+    /* Now a whole HDF5 file */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR
+    if(H5Sclose(space) < 0)
+        TEST_ERROR
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+
+    /* Reopen it with the same layout and check the data */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR
+    if(HDmemcmp(data, check, STRIPE_DSET_DIM * sizeof(int)))
+        TEST_ERROR
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+
+    /* A different layout, or no striping at all, must be refused */
+    if((fapl2 = H5Pcopy(fapl)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_family_stripe(fapl2, (hsize_t)STRIPE_SIZE, STRIPE_COUNT + 1) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDONLY, fapl2);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR
+    if(H5Pset_fapl_family_stripe(fapl2, (hsize_t)0, 0) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDONLY, fapl2);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR
+    if(H5Pclose(fapl2) < 0)
+        TEST_ERROR
+
+    /* Close and delete the file */
+    h5_delete_test_file(FILENAME[13], fapl);
+    if(H5Pclose(memb_fapl) < 0)
+        TEST_ERROR
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(data);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(lf)
+            H5FDclose(lf);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+        H5Pclose(fapl2);
+        H5Pclose(memb_fapl);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    if(data)
+        HDfree(data);
+    if(check)
+        HDfree(check);
+    return -1;
+} /* end test_family_stripe() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_multi_opens
  *
@@ -1888,6 +2188,774 @@ error:
 } /* end test_windows() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_driver
+ *
+ * Purpose:     Writes and reads back a vector of pieces through the
+ *              H5FDwrite_vector / H5FDread_vector calls for one driver.
+ *              The pieces come in runs of VEC_RUN pieces that are adjacent
+ *              in the file, with a gap after each run, and their memory
+ *              buffers are in the reverse order of the file addresses.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_driver(hid_t fapl_id)
+{
+    H5FD_t      *file = NULL;               /* VFD file pointer             */
+    char        filename[1024];             /* filename                     */
+    H5FD_mem_t  types[VEC_NPIECES + 1];     /* Memory types of pieces       */
+    haddr_t     addrs[VEC_NPIECES + 1];     /* File addresses of pieces     */
+    size_t      sizes[VEC_NPIECES + 1];     /* Sizes of pieces              */
+    const void  *wbufs[VEC_NPIECES];        /* Buffers for writing          */
+    void        *rbufs[VEC_NPIECES + 1];    /* Buffers for reading          */
+    unsigned char wdata[VEC_NPIECES * VEC_PIECE_SIZE];
+    unsigned char rdata[(VEC_NPIECES + 1) * VEC_PIECE_SIZE];
+    unsigned char piece[VEC_PIECE_SIZE];    /* Piece read with H5FDread     */
+    haddr_t     eoa;                        /* End of allocated space       */
+    unsigned    u;                          /* Local index variable         */
+
+    h5_fixname(FILENAME[10], fapl_id, filename, sizeof(filename));
+
+    /* Set up the pieces */
+    for(u = 0; u < VEC_NPIECES; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = (haddr_t)(((u / VEC_RUN) * (VEC_RUN + 1) + (u % VEC_RUN)) * VEC_PIECE_SIZE);
+        sizes[u] = VEC_PIECE_SIZE;
+        wbufs[u] = wdata + (VEC_NPIECES - 1 - u) * VEC_PIECE_SIZE;
+        rbufs[u] = rdata + (VEC_NPIECES - 1 - u) * VEC_PIECE_SIZE;
+    } /* end for */
+    for(u = 0; u < sizeof(wdata); u++)
+        wdata[u] = (unsigned char)(u * 7 + 1);
+    eoa = addrs[VEC_NPIECES - 1] + 4 * VEC_PIECE_SIZE;
+
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if(H5FDset_eoa(file, H5FD_MEM_DRAW, eoa) < 0)
+        TEST_ERROR
+
+    /* Write the pieces */
+    if(H5FDwrite_vector(file, H5P_DEFAULT, VEC_NPIECES, types, addrs, sizes, wbufs) < 0)
+        TEST_ERROR
+
+    /* Read them back, along with a piece past the end of the file, which
+     * must come back as zeros
+     */
+    types[VEC_NPIECES] = H5FD_MEM_DRAW;
+    addrs[VEC_NPIECES] = eoa - VEC_PIECE_SIZE;
+    sizes[VEC_NPIECES] = VEC_PIECE_SIZE;
+    rbufs[VEC_NPIECES] = rdata + VEC_NPIECES * VEC_PIECE_SIZE;
+    HDmemset(rdata, 0xff, sizeof(rdata));
+    if(H5FDread_vector(file, H5P_DEFAULT, VEC_NPIECES + 1, types, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    if(HDmemcmp(wdata, rdata, sizeof(wdata)))
+        FAIL_PUTS_ERROR("data read with H5FDread_vector doesn't match data written");
+    for(u = 0; u < VEC_PIECE_SIZE; u++)
+        if(rdata[VEC_NPIECES * VEC_PIECE_SIZE + u] != 0)
+            FAIL_PUTS_ERROR("data past the end of the file not zero-filled");
+
+    /* Check the placement of a piece with a scalar read */
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, addrs[VEC_RUN], VEC_PIECE_SIZE, piece) < 0)
+        TEST_ERROR
+    if(HDmemcmp(piece, wbufs[VEC_RUN], (size_t)VEC_PIECE_SIZE))
+        FAIL_PUTS_ERROR("piece written to wrong address");
+
+    /* An empty vector is a no-op */
+    if(H5FDread_vector(file, H5P_DEFAULT, 0, NULL, NULL, NULL, NULL) < 0)
+        TEST_ERROR
+
+    /* A piece past the EOA must be rejected */
+    addrs[0] = eoa;
+    H5E_BEGIN_TRY {
+        if(H5FDwrite_vector(file, H5P_DEFAULT, 1, types, addrs, sizes, wbufs) >= 0)
+            FAIL_PUTS_ERROR("write past the EOA succeeded");
+    } H5E_END_TRY;
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR
+    file = NULL;
+    h5_delete_test_file(FILENAME[10], fapl_id);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_vector_io_driver() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests vector I/O with the SEC2 driver, which implements it
+ *              with preadv / pwritev where available, and with the CORE
+ *              driver, which falls back to one read or write per piece.
+ *              Also checks a point selection on a contiguous dataset with
+ *              the sieve buffer turned off, which the library turns into
+ *              vector I/O.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       sid = -1;                   /* file dataspace ID            */
+    hid_t       mid = -1;                   /* memory dataspace ID          */
+    hid_t       did = -1;                   /* dataset ID                   */
+    char        filename[1024];             /* filename                     */
+    hsize_t     dims[1] = {VEC_DSET_DIM};   /* dataset dimensions           */
+    hsize_t     mdims[1] = {VEC_NPOINTS};   /* memory dimensions            */
+    hsize_t     coords[VEC_NPOINTS];        /* selected points              */
+    int         *wdata = NULL;              /* data written                 */
+    int         *rdata = NULL;              /* data read                    */
+    unsigned    u;                          /* Local index variable         */
+
+    TESTING("vector I/O");
+
+    /* SEC2 driver */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    if(test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    /* CORE driver, without a backing store */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, FALSE) < 0)
+        TEST_ERROR
+    if(test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    /* Point selection on a contiguous dataset, without a sieve buffer */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    if(H5Pset_sieve_buf_size(fapl_id, (size_t)0) < 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[10], fapl_id, filename, sizeof(filename));
+
+    if(NULL == (wdata = (int *)HDmalloc(VEC_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rdata = (int *)HDmalloc(VEC_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < VEC_DSET_DIM; u++)
+        wdata[u] = (int)u;
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((did = H5Dcreate2(fid, VEC_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR
+
+    /* Overwrite every third element with its negation, then read every
+     * fifth element back
+     */
+    if((mid = H5Screate_simple(1, mdims, NULL)) < 0)
+        TEST_ERROR
+    for(u = 0; u < VEC_NPOINTS; u++) {
+        coords[u] = (hsize_t)u * 3;
+        wdata[u] = -(int)(u * 3);
+    } /* end for */
+    if(H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)VEC_NPOINTS, coords) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR
+    for(u = 0; u < VEC_NPOINTS; u++)
+        coords[u] = (hsize_t)u * 5;
+    if(H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)VEC_NPOINTS, coords) < 0)
+        TEST_ERROR
+    if(H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    for(u = 0; u < VEC_NPOINTS; u++) {
+        unsigned elmt = u * 5;
+
+        if(rdata[u] != ((elmt % 3 == 0 && elmt < VEC_NPOINTS * 3) ? -(int)elmt : (int)elmt))
+            FAIL_PUTS_ERROR("wrong value read from point selection");
+    } /* end for */
+
+    if(H5Sclose(mid) < 0)
+        TEST_ERROR
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[10], fapl_id);
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    HDfree(wdata);
+    HDfree(rdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Fclose(fid);
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+    if(wdata)
+        HDfree(wdata);
+    if(rdata)
+        HDfree(rdata);
+    return -1;
+} /* end test_vector_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the file handle interface for the mmap driver, and
+ *              reading and extending a file through the mapping.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#if defined(H5_HAVE_MMAP) && defined(H5_HAVE_SYS_MMAN_H)
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    hid_t       fapl_id_out = -1;           /* from H5Fget_access_plist     */
+    hid_t       sec2_fapl_id = -1;          /* fapl for the sec2 driver     */
+    hid_t       driver_id = -1;             /* ID for this VFD              */
+    hid_t       sid = -1;                   /* dataspace ID                 */
+    hid_t       did = -1;                   /* dataset ID                   */
+    unsigned long driver_flags = 0;         /* VFD feature flags            */
+    char        filename[1024];             /* filename                     */
+    void        *os_file_handle = NULL;     /* OS file handle               */
+    hsize_t     dims[1] = {MMAP_DSET_DIM};  /* dataset dimensions           */
+    int         *wdata = NULL;              /* data written                 */
+    int         *rdata = NULL;              /* data read                    */
+    unsigned    u;                          /* Local index variable         */
+#endif /* H5_HAVE_MMAP && H5_HAVE_SYS_MMAN_H */
+
+    TESTING("MMAP file driver");
+
+#if !defined(H5_HAVE_MMAP) || !defined(H5_HAVE_SYS_MMAN_H)
+    SKIPPED();
+    HDputs("    mmap() is not available");
+    return 0;
+#else /* H5_HAVE_MMAP && H5_HAVE_SYS_MMAN_H */
+
+    /* Set property lists and file name for MMAP driver. */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_mmap(fapl_id) < 0)
+        TEST_ERROR;
+    if((sec2_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[11], fapl_id, filename, sizeof(filename));
+
+    /* Check that the VFD feature flags are correct */
+    if((driver_id = H5Pget_driver(fapl_id)) < 0)
+        TEST_ERROR
+    if(H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR
+    if(driver_flags != (H5FD_FEAT_AGGREGATE_METADATA
+                        | H5FD_FEAT_AGGREGATE_SMALLDATA
+                        | H5FD_FEAT_POSIX_COMPAT_HANDLE
+                        | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR
+
+    if(NULL == (wdata = (int *)HDmalloc(MMAP_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rdata = (int *)HDmalloc(MMAP_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < MMAP_DSET_DIM; u++)
+        wdata[u] = (int)(u * 3 + 1);
+
+    /* Create the file with the sec2 driver */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, sec2_fapl_id)) < 0)
+        TEST_ERROR;
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((did = H5Dcreate2(fid, MMAP_DSET1_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR;
+    if(H5Dclose(did) < 0)
+        TEST_ERROR;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Open the file read-only through the mapping and check the data */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Retrieve the access property list... */
+    if((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if(H5FD_MMAP != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+
+    /* ...and close the property list */
+    if(H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+
+    /* Check that we can get an operating-system-specific handle from
+     * the library.
+     */
+    if(H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if(os_file_handle == NULL)
+        FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+    if((did = H5Dopen2(fid, MMAP_DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(rdata, 0, MMAP_DSET_DIM * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(wdata, rdata, MMAP_DSET_DIM * sizeof(int)))
+        FAIL_PUTS_ERROR("data read through the mapping doesn't match");
+    if(H5Dclose(did) < 0)
+        TEST_ERROR;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Open the file read-write, extend it with a new dataset and read
+     * both datasets back, which needs the mapping to grow
+     */
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR;
+    for(u = 0; u < MMAP_DSET_DIM; u++)
+        wdata[u] = -(int)u;
+    if((did = H5Dcreate2(fid, MMAP_DSET2_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR;
+    HDmemset(rdata, 0, MMAP_DSET_DIM * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(wdata, rdata, MMAP_DSET_DIM * sizeof(int)))
+        FAIL_PUTS_ERROR("data written past the mapping doesn't match");
+    if(H5Dclose(did) < 0)
+        TEST_ERROR;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Check the new dataset with the sec2 driver */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, sec2_fapl_id)) < 0)
+        TEST_ERROR;
+    if((did = H5Dopen2(fid, MMAP_DSET2_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(rdata, 0, MMAP_DSET_DIM * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(wdata, rdata, MMAP_DSET_DIM * sizeof(int)))
+        FAIL_PUTS_ERROR("data written through the mmap driver doesn't match");
+    if(H5Dclose(did) < 0)
+        TEST_ERROR;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Close and delete the file */
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[11], fapl_id);
+
+    /* Close the fapls */
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if(H5Pclose(sec2_fapl_id) < 0)
+        TEST_ERROR;
+
+    HDfree(wdata);
+    HDfree(rdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Pclose(sec2_fapl_id);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wdata)
+        HDfree(wdata);
+    if(rdata)
+        HDfree(rdata);
+    return -1;
+#endif /* H5_HAVE_MMAP && H5_HAVE_SYS_MMAN_H */
+} /* end test_mmap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring_dset
+ *
+ * Purpose:     Writes a dataset through the io_uring driver, checks it
+ *              with the SEC2 driver, then overwrites and reads back a
+ *              point selection through the io_uring driver again.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring_dset(hid_t fapl_id)
+{
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       sec2_fapl_id = -1;          /* fapl for the sec2 driver     */
+    hid_t       sid = -1;                   /* file dataspace ID            */
+    hid_t       mid = -1;                   /* memory dataspace ID          */
+    hid_t       did = -1;                   /* dataset ID                   */
+    char        filename[1024];             /* filename                     */
+    hsize_t     dims[1] = {IOURING_DSET_DIM};   /* dataset dimensions       */
+    hsize_t     mdims[1] = {IOURING_NPOINTS};   /* memory dimensions        */
+    hsize_t     coords[IOURING_NPOINTS];    /* selected points              */
+    int         *wdata = NULL;              /* data written                 */
+    int         *rdata = NULL;              /* data read                    */
+    unsigned    u;                          /* Local index variable         */
+
+    if((sec2_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_sec2(sec2_fapl_id) < 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[12], fapl_id, filename, sizeof(filename));
+
+    if(NULL == (wdata = (int *)HDmalloc(IOURING_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rdata = (int *)HDmalloc(IOURING_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < IOURING_DSET_DIM; u++)
+        wdata[u] = (int)(u * 7 + 3);
+
+    /* Write the dataset, in many more requests than the queue holds */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((did = H5Dcreate2(fid, IOURING_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* Check the file with the sec2 driver */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, sec2_fapl_id)) < 0)
+        TEST_ERROR
+    if((did = H5Dopen2(fid, IOURING_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    HDmemset(rdata, 0, IOURING_DSET_DIM * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if(HDmemcmp(wdata, rdata, IOURING_DSET_DIM * sizeof(int)))
+        FAIL_PUTS_ERROR("data written through the io_uring driver doesn't match");
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* Overwrite scattered elements and read them back, which goes through
+     * vector I/O since the driver doesn't sieve
+     */
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR
+    if((did = H5Dopen2(fid, IOURING_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((mid = H5Screate_simple(1, mdims, NULL)) < 0)
+        TEST_ERROR
+    for(u = 0; u < IOURING_NPOINTS; u++) {
+        coords[u] = (hsize_t)u * 61;
+        wdata[u] = -(int)u;
+    } /* end for */
+    if(H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)IOURING_NPOINTS, coords) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR
+    HDmemset(rdata, 0, IOURING_NPOINTS * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if(HDmemcmp(wdata, rdata, IOURING_NPOINTS * sizeof(int)))
+        FAIL_PUTS_ERROR("point selection read through the io_uring driver doesn't match");
+
+    /* The elements in between must be untouched */
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    for(u = 0; u < IOURING_DSET_DIM; u++)
+        if(rdata[u] != ((u % 61 == 0 && u / 61 < IOURING_NPOINTS) ? -(int)(u / 61) : (int)(u * 7 + 3)))
+            FAIL_PUTS_ERROR("wrong value read after point selection write");
+
+    if(H5Sclose(mid) < 0)
+        TEST_ERROR
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[12], fapl_id);
+    if(H5Pclose(sec2_fapl_id) < 0)
+        TEST_ERROR
+
+    HDfree(wdata);
+    HDfree(rdata);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Fclose(fid);
+        H5Pclose(sec2_fapl_id);
+    } H5E_END_TRY;
+    if(wdata)
+        HDfree(wdata);
+    if(rdata)
+        HDfree(rdata);
+    return -1;
+} /* end test_iouring_dset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring_overlap
+ *
+ * Purpose:     Writes one vector whose pieces overlap each other, some of
+ *              them exactly, through the io_uring driver, and checks that
+ *              the last write to each byte wins.  With direct I/O the
+ *              pieces mix partial-block and whole-block writes to the
+ *              same blocks.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring_overlap(hid_t fapl_id)
+{
+    H5FD_t      *file = NULL;               /* VFD file pointer             */
+    char        filename[1024];             /* filename                     */
+    H5FD_mem_t  types[IOURING_OVL_NPIECES]; /* Memory types of pieces       */
+    haddr_t     addrs[IOURING_OVL_NPIECES]; /* File addresses of pieces     */
+    size_t      sizes[IOURING_OVL_NPIECES]; /* Sizes of pieces              */
+    const void  *wbufs[IOURING_OVL_NPIECES];    /* Buffers for writing      */
+    unsigned char *wdata = NULL;            /* Data written                 */
+    unsigned char expect[IOURING_OVL_SIZE]; /* Expected file contents       */
+    unsigned char rdata[IOURING_OVL_SIZE];  /* File contents read           */
+    unsigned    u;                          /* Local index variable         */
+
+    h5_fixname(FILENAME[12], fapl_id, filename, sizeof(filename));
+
+    if(NULL == (wdata = (unsigned char *)HDmalloc(IOURING_OVL_NPIECES * IOURING_OVL_MAXLEN)))
+        TEST_ERROR
+
+    /* Set up the pieces.  Pieces 1 and 2 are both whole blocks, and piece 2
+     * repeats piece 1; the rest are scattered and mostly unaligned.
+     */
+    HDmemset(expect, 0, sizeof(expect));
+    for(u = 0; u < IOURING_OVL_NPIECES; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        if(1 == u || 2 == u) {
+            addrs[u] = 4096;
+            sizes[u] = 4096;
+        } /* end if */
+        else {
+            addrs[u] = (haddr_t)((u * 1237) % (IOURING_OVL_SIZE - IOURING_OVL_MAXLEN));
+            sizes[u] = 1 + (u * 3011) % IOURING_OVL_MAXLEN;
+        } /* end else */
+        HDmemset(wdata + u * IOURING_OVL_MAXLEN, (int)(u + 1), sizes[u]);
+        wbufs[u] = wdata + u * IOURING_OVL_MAXLEN;
+        HDmemset(expect + addrs[u], (int)(u + 1), sizes[u]);
+    } /* end for */
+
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if(H5FDset_eoa(file, H5FD_MEM_DRAW, (haddr_t)IOURING_OVL_SIZE) < 0)
+        TEST_ERROR
+
+    /* Zero the region, then write the overlapping pieces */
+    HDmemset(rdata, 0, sizeof(rdata));
+    if(H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, sizeof(rdata), rdata) < 0)
+        TEST_ERROR
+    if(H5FDwrite_vector(file, H5P_DEFAULT, IOURING_OVL_NPIECES, types, addrs, sizes, wbufs) < 0)
+        TEST_ERROR
+
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, sizeof(rdata), rdata) < 0)
+        TEST_ERROR
+    if(HDmemcmp(expect, rdata, sizeof(rdata)))
+        FAIL_PUTS_ERROR("overlapping pieces not written in order");
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR
+    file = NULL;
+    h5_delete_test_file(FILENAME[12], fapl_id);
+
+    HDfree(wdata);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+    } H5E_END_TRY;
+    if(wdata)
+        HDfree(wdata);
+    return -1;
+} /* end test_iouring_overlap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the io_uring driver, with buffered and with direct
+ *              I/O.  The queue depth and request size are kept small so
+ *              that reads and writes need many requests.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    hid_t       driver_id = -1;             /* ID for this VFD              */
+    H5FD_t      *file = NULL;               /* VFD file pointer             */
+    char        filename[1024];             /* filename                     */
+    unsigned long driver_flags = 0;         /* VFD feature flags            */
+    unsigned    queue_depth;                /* queue depth                  */
+    hbool_t     direct;                     /* whether to use direct I/O    */
+    size_t      block_size;                 /* file block size              */
+    size_t      buf_size;                   /* request size                 */
+#endif /* H5_HAVE_PREAD && H5_HAVE_PWRITE */
+
+    TESTING("IOURING file driver");
+
+#if !defined(H5_HAVE_PREAD) || !defined(H5_HAVE_PWRITE)
+    SKIPPED();
+    HDputs("    pread() and pwrite() are not available");
+    return 0;
+#else /* H5_HAVE_PREAD && H5_HAVE_PWRITE */
+
+    /* Buffered I/O */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_iouring(fapl_id, 4, FALSE, (size_t)0, (size_t)4096) < 0)
+        TEST_ERROR
+
+    /* Check the properties and the VFD feature flags */
+    if(H5Pget_fapl_iouring(fapl_id, &queue_depth, &direct, &block_size, &buf_size) < 0)
+        TEST_ERROR
+    if(queue_depth != 4 || direct || block_size != H5FD_IOURING_BLOCK_SIZE_DEF || buf_size != 4096)
+        FAIL_PUTS_ERROR("wrong io_uring driver properties");
+    if((driver_id = H5Pget_driver(fapl_id)) < 0)
+        TEST_ERROR
+    if(H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR
+    if(driver_flags != (H5FD_FEAT_AGGREGATE_METADATA
+                        | H5FD_FEAT_ACCUMULATE_METADATA
+                        | H5FD_FEAT_AGGREGATE_SMALLDATA
+                        | H5FD_FEAT_POSIX_COMPAT_HANDLE
+                        | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR
+
+    /* The request size must be a multiple of the block size */
+    H5E_BEGIN_TRY {
+        if(H5Pset_fapl_iouring(fapl_id, 4, TRUE, (size_t)4096, (size_t)6000) >= 0)
+            FAIL_PUTS_ERROR("request size not a multiple of the block size accepted");
+    } H5E_END_TRY;
+
+    if(test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+    if(test_iouring_dset(fapl_id) < 0)
+        TEST_ERROR
+    if(test_iouring_overlap(fapl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    /* Direct I/O, through registered bounce buffers */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_iouring(fapl_id, 8, TRUE, (size_t)4096, (size_t)16384) < 0)
+        TEST_ERROR
+
+    /* Not every file system supports direct I/O */
+    h5_fixname(FILENAME[12], fapl_id, filename, sizeof(filename));
+    H5E_BEGIN_TRY {
+        file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF);
+    } H5E_END_TRY;
+    if(NULL == file) {
+        if(H5Pclose(fapl_id) < 0)
+            TEST_ERROR
+        PASSED();
+        HDputs("    Direct I/O part skipped; probably the file system doesn't support it");
+        return 0;
+    } /* end if */
+    if(H5FDclose(file) < 0)
+        TEST_ERROR
+    file = NULL;
+
+    if(test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+    if(test_iouring_dset(fapl_id) < 0)
+        TEST_ERROR
+    if(test_iouring_overlap(fapl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+    return -1;
+#endif /* H5_HAVE_PREAD && H5_HAVE_PWRITE */
+} /* end test_iouring() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -1916,11 +2984,15 @@ main(void)
     nerrors += test_direct() < 0         ? 1 : 0;
     nerrors += test_family() < 0         ? 1 : 0;
     nerrors += test_family_compat() < 0  ? 1 : 0;
+    nerrors += test_family_stripe() < 0  ? 1 : 0;
     nerrors += test_multi() < 0          ? 1 : 0;
     nerrors += test_multi_compat() < 0   ? 1 : 0;
     nerrors += test_log() < 0            ? 1 : 0;
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
+    nerrors += test_vector_io() < 0      ? 1 : 0;
+    nerrors += test_mmap() < 0           ? 1 : 0;
+    nerrors += test_iouring() < 0        ? 1 : 0;
 
     if(nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n",
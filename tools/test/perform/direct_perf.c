@@ -0,0 +1,440 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Streams a large contiguous dataset through the sec2 and the
+ *              direct (O_DIRECT) file drivers and compares the bandwidth
+ *              with raw O_DIRECT reads and writes of the same amount of
+ *              data, which approximates what the device can deliver.
+ *
+ *              The dataset is aligned on file system blocks and the
+ *              application buffer on the memory boundary, so with the
+ *              direct driver the whole transfer should bypass the driver's
+ *              copy buffer.  An extra pass uses a buffer which is
+ *              deliberately misaligned by one element to show the cost of
+ *              bouncing through the copy buffer.
+ *
+ * Usage:       direct_perf [-s total_MB] [-r request_KB] [file_prefix]
+ */
+
+/* See H5private.h for how to include headers */
+#include "hdf5.h"
+
+#include "H5private.h"
+
+#define FILE_NAME       "direct_perf"
+#define DSET_NAME       "stream"
+#define HEADING         "%-24s"
+
+#define MEM_BOUNDARY    4096                /* Memory boundary for the direct driver */
+#define FS_BLOCK_SIZE   4096                /* File system block size */
+#define COPY_BUF_SIZE   (16 * 1024 * 1024)  /* Maximal copy buffer size */
+
+#define TOTAL_MB_DEF    256             /* Default amount of data to stream */
+#define REQUEST_KB_DEF  4096            /* Default size of each request */
+
+/* Which way data is moving */
+typedef enum {
+    STREAM_WRITE,
+    STREAM_READ
+} stream_op_t;
+
+
+/*-------------------------------------------------------------------------
+ * Function:    print_rate
+ *
+ * Purpose:     Prints the bandwidth for a timed transfer
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_rate(const char *label, const char *op, double elapsed, hsize_t nbytes)
+{
+    char heading[64];
+
+    HDsnprintf(heading, sizeof(heading), "%s %s", label, op);
+    if(elapsed > 0.0)
+        HDfprintf(stdout, HEADING "%8.2fs %10.2fMB/s\n", heading, elapsed,
+                ((double)nbytes / elapsed) / (1024.0 * 1024.0));
+    else
+        HDfprintf(stdout, HEADING "%8.2fs %10s\n", heading, elapsed, "-");
+} /* end print_rate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    fill_buf
+ *
+ * Purpose:     Stamps a request buffer with a pattern that depends on the
+ *              request number, so reads can be checked
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+fill_buf(unsigned char *buf, size_t size, hsize_t req)
+{
+    size_t u;
+
+    for(u = 0; u < size; u++)
+        buf[u] = (unsigned char)((req + u) & 0xff);
+} /* end fill_buf() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    check_buf
+ *
+ * Purpose:     Checks a buffer filled by fill_buf()
+ *
+ * Return:      TRUE if the buffer matches, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+check_buf(const unsigned char *buf, size_t size, hsize_t req)
+{
+    size_t u;
+
+    for(u = 0; u < size; u++)
+        if(buf[u] != (unsigned char)((req + u) & 0xff))
+            return FALSE;
+
+    return TRUE;
+} /* end check_buf() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    stream_hdf5
+ *
+ * Purpose:     Writes or reads the whole dataset in REQUEST sized pieces
+ *              through the file driver set in FAPL
+ *
+ * Return:      Success:    Elapsed time, including closing the file
+ *
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+stream_hdf5(const char *name, hid_t fapl, stream_op_t op, hsize_t total,
+    size_t request, unsigned char *buf)
+{
+    hid_t       file = -1, dset = -1, fspace = -1, mspace = -1, dcpl = -1;
+    hsize_t     dims[1], start[1], count[1];
+    hsize_t     req, nreqs = total / request;
+    double      t_start, t_stop;
+
+    dims[0] = total;
+    count[0] = request;
+
+    t_start = H5_get_time();
+
+    if(STREAM_WRITE == op) {
+        if((file = H5Fcreate(name, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            goto error;
+        if((fspace = H5Screate_simple(1, dims, NULL)) < 0)
+            goto error;
+
+        /* Allocate the dataset up front so the writes stream in order */
+        if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            goto error;
+        if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+            goto error;
+        if(H5Pset_fill_time(dcpl, H5D_FILL_TIME_NEVER) < 0)
+            goto error;
+        if((dset = H5Dcreate2(file, DSET_NAME, H5T_NATIVE_UCHAR, fspace, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            goto error;
+    } /* end if */
+    else {
+        if((file = H5Fopen(name, H5F_ACC_RDONLY, fapl)) < 0)
+            goto error;
+        if((dset = H5Dopen2(file, DSET_NAME, H5P_DEFAULT)) < 0)
+            goto error;
+        if((fspace = H5Dget_space(dset)) < 0)
+            goto error;
+    } /* end else */
+    if((mspace = H5Screate_simple(1, count, NULL)) < 0)
+        goto error;
+
+    for(req = 0; req < nreqs; req++) {
+        start[0] = req * request;
+        if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto error;
+
+        if(STREAM_WRITE == op) {
+            fill_buf(buf, request, req);
+            if(H5Dwrite(dset, H5T_NATIVE_UCHAR, mspace, fspace, H5P_DEFAULT, buf) < 0)
+                goto error;
+        } /* end if */
+        else {
+            if(H5Dread(dset, H5T_NATIVE_UCHAR, mspace, fspace, H5P_DEFAULT, buf) < 0)
+                goto error;
+            if(!check_buf(buf, request, req)) {
+                HDfprintf(stderr, "%s: data mismatch in request %Hu\n", name, req);
+                goto error;
+            } /* end if */
+        } /* end else */
+    } /* end for */
+
+    if(dcpl >= 0 && H5Pclose(dcpl) < 0)
+        goto error;
+    if(H5Sclose(mspace) < 0)
+        goto error;
+    if(H5Sclose(fspace) < 0)
+        goto error;
+    if(H5Dclose(dset) < 0)
+        goto error;
+    if(H5Fclose(file) < 0)
+        goto error;
+
+    t_stop = H5_get_time();
+
+    return t_stop - t_start;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    return -1.0;
+} /* end stream_hdf5() */
+
+#ifdef H5_HAVE_DIRECT
+
+/*-------------------------------------------------------------------------
+ * Function:    stream_raw
+ *
+ * Purpose:     Writes or reads TOTAL bytes with O_DIRECT system calls, as
+ *              a reference for the bandwidth of the device
+ *
+ * Return:      Success:    Elapsed time
+ *
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+stream_raw(const char *name, stream_op_t op, hsize_t total, size_t request,
+    unsigned char *buf)
+{
+    hsize_t     req, nreqs = total / request;
+    double      t_start, t_stop;
+    int         fd;
+
+    t_start = H5_get_time();
+
+    if(STREAM_WRITE == op)
+        fd = HDopen(name, O_RDWR | O_CREAT | O_TRUNC | O_DIRECT, H5_POSIX_CREATE_MODE_RW);
+    else
+        fd = HDopen(name, O_RDONLY | O_DIRECT);
+    if(fd < 0)
+        return -1.0;
+
+    for(req = 0; req < nreqs; req++) {
+        ssize_t nbytes;
+
+        if(STREAM_WRITE == op) {
+            fill_buf(buf, request, req);
+            nbytes = HDwrite(fd, buf, request);
+        } /* end if */
+        else
+            nbytes = HDread(fd, buf, request);
+        if(nbytes != (ssize_t)request) {
+            HDclose(fd);
+            return -1.0;
+        } /* end if */
+    } /* end for */
+
+    if(HDclose(fd) < 0)
+        return -1.0;
+
+    t_stop = H5_get_time();
+
+    return t_stop - t_start;
+} /* end stream_raw() */
+#endif /* H5_HAVE_DIRECT */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    run_driver
+ *
+ * Purpose:     Streams the dataset out and back in through one driver
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+run_driver(const char *label, const char *name, hid_t fapl, hsize_t total,
+    size_t request, unsigned char *buf)
+{
+    double elapsed;
+
+    if((elapsed = stream_hdf5(name, fapl, STREAM_WRITE, total, request, buf)) < 0.0)
+        return -1;
+    print_rate(label, "write", elapsed, total);
+
+    if((elapsed = stream_hdf5(name, fapl, STREAM_READ, total, request, buf)) < 0.0)
+        return -1;
+    print_rate(label, "read", elapsed, total);
+
+    return 0;
+} /* end run_driver() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints the command syntax
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stderr, "usage: %s [-s total_MB] [-r request_KB] [file_prefix]\n", prog);
+    HDfprintf(stderr, "  -s  amount of data to stream, in MB (default %d)\n", TOTAL_MB_DEF);
+    HDfprintf(stderr, "  -r  size of each request, in KB; a multiple of %d bytes (default %d)\n",
+            FS_BLOCK_SIZE, REQUEST_KB_DEF);
+} /* end usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Runs the streaming benchmark
+ *
+ * Return:      Success:    EXIT_SUCCESS
+ *
+ *              Failure:    EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    const char  *prefix = FILE_NAME;
+    char        name[1024];
+    unsigned long total_mb = TOTAL_MB_DEF;
+    unsigned long request_kb = REQUEST_KB_DEF;
+    hsize_t     total;
+    size_t      request;
+    void        *alloc = NULL;
+    unsigned char *buf;
+    hid_t       fapl = -1;
+    int         argno;
+
+    for(argno = 1; argno < argc; argno++) {
+        if(!HDstrcmp(argv[argno], "-s") && argno + 1 < argc)
+            total_mb = HDstrtoul(argv[++argno], NULL, 10);
+        else if(!HDstrcmp(argv[argno], "-r") && argno + 1 < argc)
+            request_kb = HDstrtoul(argv[++argno], NULL, 10);
+        else if('-' == argv[argno][0]) {
+            usage(argv[0]);
+            HDexit(EXIT_FAILURE);
+        } /* end if */
+        else
+            prefix = argv[argno];
+    } /* end for */
+
+    request = (size_t)request_kb * 1024;
+    total = ((hsize_t)total_mb * 1024 * 1024 / request) * request;
+    if(0 == request || 0 != request % FS_BLOCK_SIZE || 0 == total) {
+        usage(argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+
+    HDfprintf(stdout, "Streaming %Hu bytes in %lu byte requests\n", total, (unsigned long)request);
+
+    /* One extra element lets the misaligned pass shift the buffer */
+    if(HDposix_memalign(&alloc, MEM_BOUNDARY, request + MEM_BOUNDARY) != 0) {
+        HDfprintf(stderr, "unable to allocate aligned buffer\n");
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+    buf = (unsigned char *)alloc;
+
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+
+    /* Start all file objects on file system block boundaries, so the raw
+     * data can be transferred without touching partial blocks.
+     */
+    if(H5Pset_alignment(fapl, (hsize_t)1, (hsize_t)FS_BLOCK_SIZE) < 0)
+        goto error;
+
+    /* Default (sec2) driver */
+    HDsnprintf(name, sizeof(name), "%s_sec2.h5", prefix);
+    if(H5Pset_fapl_sec2(fapl) < 0)
+        goto error;
+    if(run_driver("sec2", name, fapl, total, request, buf) < 0)
+        goto error;
+    HDremove(name);
+
+#ifdef H5_HAVE_DIRECT
+    {
+        double elapsed;
+
+        /* Raw O_DIRECT, for reference */
+        HDsnprintf(name, sizeof(name), "%s_raw.dat", prefix);
+        if((elapsed = stream_raw(name, STREAM_WRITE, total, request, buf)) < 0.0)
+            HDfprintf(stdout, HEADING "skipped (file system may not support O_DIRECT)\n", "raw O_DIRECT");
+        else {
+            print_rate("raw O_DIRECT", "write", elapsed, total);
+            if((elapsed = stream_raw(name, STREAM_READ, total, request, buf)) < 0.0)
+                goto error;
+            print_rate("raw O_DIRECT", "read", elapsed, total);
+            HDremove(name);
+
+            /* Direct driver, with an aligned buffer */
+            HDsnprintf(name, sizeof(name), "%s_direct.h5", prefix);
+            if(H5Pset_fapl_direct(fapl, (size_t)MEM_BOUNDARY, (size_t)FS_BLOCK_SIZE, (size_t)COPY_BUF_SIZE) < 0)
+                goto error;
+            if(run_driver("direct", name, fapl, total, request, buf) < 0)
+                goto error;
+
+            /* Direct driver, with a misaligned buffer */
+            if(run_driver("direct (misaligned)", name, fapl, total, request, buf + 1) < 0)
+                goto error;
+            HDremove(name);
+        } /* end else */
+    }
+#else /* H5_HAVE_DIRECT */
+    HDfprintf(stdout, HEADING "skipped (direct driver not built)\n", "direct");
+#endif /* H5_HAVE_DIRECT */
+
+    if(H5Pclose(fapl) < 0)
+        goto error;
+
+    HDfree(alloc);
+
+    return EXIT_SUCCESS;
+
+error:
+    HDfprintf(stderr, "streaming benchmark failed\n");
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    HDfree(alloc);
+
+    return EXIT_FAILURE;
+} /* end main() */
+
@@ -0,0 +1,268 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Measures file space allocation under churn: datasets of
+ *              random sizes are created and a random half of them deleted,
+ *              round after round, so later allocations are served from a
+ *              growing set of free space sections of many sizes.
+ *
+ *              For each round, the time taken and the size of the file
+ *              compared with the space used by the live datasets are
+ *              printed.  The file space is tracked by the free space
+ *              managers of the file for the whole run, with a paged
+ *              aggregation pass showing the same workload with pages.
+ *
+ * Usage:       fspace_perf [-n datasets] [-r rounds] [-m max_KB] [file_prefix]
+ */
+
+/* See H5private.h for how to include headers */
+#include "hdf5.h"
+
+#include "H5private.h"
+
+#define FILE_NAME       "fspace_perf"
+
+#define NDSETS_DEF      2000            /* Default # of datasets per round */
+#define NROUNDS_DEF     8               /* Default # of rounds */
+#define MAX_KB_DEF      64              /* Default max. dataset size */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    churn_round
+ *
+ * Purpose:     Fills the empty slots in LIVE with new datasets of random
+ *              sizes, then deletes each dataset with a probability of 1/2
+ *
+ * Return:      Success:    Elapsed time
+ *
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+churn_round(hid_t file, hid_t dcpl, unsigned ndsets, hsize_t max_size,
+    hsize_t *live, hsize_t *live_bytes)
+{
+    char        name[32];
+    hid_t       space = -1, dset = -1;
+    hsize_t     dims[1];
+    unsigned    u;
+    double      t_start, t_stop;
+
+    t_start = H5_get_time();
+
+    /* Create datasets in the empty slots */
+    for(u = 0; u < ndsets; u++) {
+        if(live[u] > 0)
+            continue;
+
+        dims[0] = 1 + (hsize_t)HDrandom() % max_size;
+        HDsnprintf(name, sizeof(name), "d%u", u);
+        if((space = H5Screate_simple(1, dims, NULL)) < 0)
+            goto error;
+        if((dset = H5Dcreate2(file, name, H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            goto error;
+        if(H5Dclose(dset) < 0)
+            goto error;
+        if(H5Sclose(space) < 0)
+            goto error;
+        live[u] = dims[0];
+        *live_bytes += dims[0];
+    } /* end for */
+
+    /* Delete about half of them */
+    for(u = 0; u < ndsets; u++)
+        if(HDrandom() % 2) {
+            HDsnprintf(name, sizeof(name), "d%u", u);
+            if(H5Ldelete(file, name, H5P_DEFAULT) < 0)
+                goto error;
+            *live_bytes -= live[u];
+            live[u] = 0;
+        } /* end if */
+
+    t_stop = H5_get_time();
+
+    return t_stop - t_start;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(space);
+    } H5E_END_TRY;
+
+    return -1.0;
+} /* end churn_round() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    run_churn
+ *
+ * Purpose:     Runs all the rounds on a new file created with FCPL
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+run_churn(const char *label, const char *name, hid_t fcpl, unsigned ndsets,
+    unsigned nrounds, hsize_t max_size)
+{
+    hid_t       file = -1, dcpl = -1;
+    hsize_t     *live = NULL;
+    hsize_t     live_bytes = 0;
+    hsize_t     file_size;
+    double      elapsed, total = 0.0;
+    unsigned    r;
+
+    HDsrandom(ndsets);
+    if(NULL == (live = (hsize_t *)HDcalloc((size_t)ndsets, sizeof(hsize_t))))
+        goto error;
+
+    if((file = H5Fcreate(name, H5F_ACC_TRUNC, fcpl, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Allocate the raw data at creation, without writing fill values */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+        goto error;
+    if(H5Pset_fill_time(dcpl, H5D_FILL_TIME_NEVER) < 0)
+        goto error;
+
+    HDfprintf(stdout, "%s:\n", label);
+    for(r = 0; r < nrounds; r++) {
+        if((elapsed = churn_round(file, dcpl, ndsets, max_size, live, &live_bytes)) < 0.0)
+            goto error;
+        total += elapsed;
+        if(H5Fget_filesize(file, &file_size) < 0)
+            goto error;
+        HDfprintf(stdout, "  round %-3u %8.3fs %12Hu bytes, %6.2fx live data\n", r, elapsed,
+                file_size, live_bytes > 0 ? (double)file_size / (double)live_bytes : 0.0);
+    } /* end for */
+    HDfprintf(stdout, "  %-10s%8.3fs\n", "total", total);
+
+    if(H5Pclose(dcpl) < 0)
+        goto error;
+    if(H5Fclose(file) < 0)
+        goto error;
+    HDfree(live);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    HDfree(live);
+
+    return -1;
+} /* end run_churn() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints the command syntax
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stderr, "usage: %s [-n datasets] [-r rounds] [-m max_KB] [file_prefix]\n", prog);
+    HDfprintf(stderr, "  -n  number of dataset slots (default %d)\n", NDSETS_DEF);
+    HDfprintf(stderr, "  -r  number of create/delete rounds (default %d)\n", NROUNDS_DEF);
+    HDfprintf(stderr, "  -m  largest dataset size, in KB (default %d)\n", MAX_KB_DEF);
+} /* end usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Runs the churn benchmark
+ *
+ * Return:      Success:    EXIT_SUCCESS
+ *
+ *              Failure:    EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    const char  *prefix = FILE_NAME;
+    char        name[1024];
+    unsigned long ndsets = NDSETS_DEF;
+    unsigned long nrounds = NROUNDS_DEF;
+    unsigned long max_kb = MAX_KB_DEF;
+    hid_t       fcpl = -1;
+    int         argno;
+
+    for(argno = 1; argno < argc; argno++) {
+        if(!HDstrcmp(argv[argno], "-n") && argno + 1 < argc)
+            ndsets = HDstrtoul(argv[++argno], NULL, 10);
+        else if(!HDstrcmp(argv[argno], "-r") && argno + 1 < argc)
+            nrounds = HDstrtoul(argv[++argno], NULL, 10);
+        else if(!HDstrcmp(argv[argno], "-m") && argno + 1 < argc)
+            max_kb = HDstrtoul(argv[++argno], NULL, 10);
+        else if('-' == argv[argno][0]) {
+            usage(argv[0]);
+            HDexit(EXIT_FAILURE);
+        } /* end if */
+        else
+            prefix = argv[argno];
+    } /* end for */
+
+    if(0 == ndsets || 0 == nrounds || 0 == max_kb) {
+        usage(argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+
+    HDfprintf(stdout, "Churning %lu datasets of up to %lu KB for %lu rounds\n", ndsets, max_kb, nrounds);
+
+    /* Default file space strategy */
+    HDsnprintf(name, sizeof(name), "%s.h5", prefix);
+    if(run_churn("aggregators and free space managers", name, H5P_DEFAULT,
+            (unsigned)ndsets, (unsigned)nrounds, (hsize_t)max_kb * 1024) < 0)
+        goto error;
+    HDremove(name);
+
+    /* Paged aggregation */
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        goto error;
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, FALSE, (hsize_t)1) < 0)
+        goto error;
+    HDsnprintf(name, sizeof(name), "%s_paged.h5", prefix);
+    if(run_churn("paged aggregation", name, fcpl,
+            (unsigned)ndsets, (unsigned)nrounds, (hsize_t)max_kb * 1024) < 0)
+        goto error;
+    HDremove(name);
+
+    if(H5Pclose(fcpl) < 0)
+        goto error;
+
+    return EXIT_SUCCESS;
+
+error:
+    HDfprintf(stderr, "free space churn benchmark failed\n");
+    H5E_BEGIN_TRY {
+        H5Pclose(fcpl);
+    } H5E_END_TRY;
+
+    return EXIT_FAILURE;
+} /* end main() */